@@ -1,5 +1,6 @@
 #include <QtCore>
 #include <QtWidgets>
+#include <QtConcurrent/QtConcurrent>
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
 #include <parseagle/library.h>
@@ -101,6 +102,9 @@ void MainWindow::convertAllFiles(ConvertFileType_t type)
         if (mAbortConversion)
             break;
     }
+
+    // write all new UUIDs to the *.ini file at once
+    db.flush();
 }
 
 void MainWindow::convertFile(ConvertFileType_t type, eagleimport::ConverterDb& db,
@@ -109,55 +113,58 @@ void MainWindow::convertFile(ConvertFileType_t type, eagleimport::ConverterDb& d
     try {
         parseagle::Library library(filepath.toStr());
         db.setCurrentLibraryFilePath(filepath);
+        FilePath outputDir(ui->output->text());
 
+        // the elements are converted and saved in parallel, only the UI is updated from
+        // this thread (in the original order of the elements)
+        QList<QFuture<ConversionResult>> futures;
         switch (type) {
             case ConvertFileType_t::Symbols_to_Symbols:
-                ui->pbarElements->setValue(0);
-                ui->pbarElements->setMaximum(library.getSymbols().count());
                 foreach (const parseagle::Symbol& symbol, library.getSymbols()) {
-                    bool success = convertSymbol(db, symbol);
-                    mReadedElementsCount++;
-                    if (success) mConvertedElementsCount++;
-                    ui->pbarElements->setValue(ui->pbarElements->value() + 1);
-                    ui->lblConvertedElements->setText(QString("%1 of %2").arg(mConvertedElementsCount)
-                                                                         .arg(mReadedElementsCount));
+                    futures.append(QtConcurrent::run([&db, symbol, outputDir](){
+                        return convertSymbol(db, symbol, outputDir.getPathTo("sym"));
+                    }));
                 }
                 break;
             case ConvertFileType_t::Packages_to_PackagesAndDevices:
-                ui->pbarElements->setValue(0);
-                ui->pbarElements->setMaximum(library.getPackages().count());
                 foreach (const parseagle::Package& package, library.getPackages()) {
-                    bool success = convertPackage(db, package);
-                    mReadedElementsCount++;
-                    if (success) mConvertedElementsCount++;
-                    ui->pbarElements->setValue(ui->pbarElements->value() + 1);
-                    ui->lblConvertedElements->setText(QString("%1 of %2").arg(mConvertedElementsCount)
-                                                                         .arg(mReadedElementsCount));
+                    futures.append(QtConcurrent::run([&db, package, outputDir](){
+                        return convertPackage(db, package, outputDir.getPathTo("pkg"));
+                    }));
                 }
                 break;
             case ConvertFileType_t::Devices_to_Components:
-                ui->pbarElements->setValue(0);
-                ui->pbarElements->setMaximum(library.getDeviceSets().count());
                 foreach (const parseagle::DeviceSet& deviceSet, library.getDeviceSets()) {
-                    bool success = convertDevice(db, deviceSet);
-                    mReadedElementsCount++;
-                    if (success) mConvertedElementsCount++;
-                    ui->pbarElements->setValue(ui->pbarElements->value() + 1);
-                    ui->lblConvertedElements->setText(QString("%1 of %2").arg(mConvertedElementsCount)
-                                                                         .arg(mReadedElementsCount));
+                    futures.append(QtConcurrent::run([&db, deviceSet, outputDir](){
+                        return convertDevice(db, deviceSet, outputDir.getPathTo("cmp"),
+                                             outputDir.getPathTo("dev"));
+                    }));
                 }
                 break;
             default:
                 throw Exception(__FILE__, __LINE__);
         }
+
+        ui->pbarElements->setValue(0);
+        ui->pbarElements->setMaximum(futures.count());
+        for (int i = 0; i < futures.count(); ++i) {
+            ConversionResult result = futures[i].result(); // blocks until finished
+            if (!result.error.isEmpty()) addError(result.error);
+            mReadedElementsCount++;
+            if (result.success) mConvertedElementsCount++;
+            ui->pbarElements->setValue(i + 1);
+            ui->lblConvertedElements->setText(QString("%1 of %2").arg(mConvertedElementsCount)
+                                                                 .arg(mReadedElementsCount));
+        }
     } catch (const std::exception& e) {
         addError(e.what());
         return;
     }
 }
 
-bool MainWindow::convertSymbol(eagleimport::ConverterDb& db,
-                               const parseagle::Symbol& symbol)
+MainWindow::ConversionResult MainWindow::convertSymbol(eagleimport::ConverterDb& db,
+                                                      const parseagle::Symbol& symbol,
+                                                      const FilePath& outputDir) noexcept
 {
     try {
         // create symbol
@@ -169,17 +176,17 @@ bool MainWindow::convertSymbol(eagleimport::ConverterDb& db,
         polygonSimplifier.convertLineRectsToPolygonRects(false, true);
 
         // save symbol to file
-        newSymbol->saveIntoParentDirectory(FilePath(QString("%1/sym").arg(ui->output->text())));
+        newSymbol->saveIntoParentDirectory(outputDir);
     } catch (const std::exception& e) {
-        addError(e.what());
-        return false;
+        return ConversionResult{false, e.what()};
     }
 
-    return true;
+    return ConversionResult{true, QString()};
 }
 
-bool MainWindow::convertPackage(eagleimport::ConverterDb& db,
-                                const parseagle::Package& package)
+MainWindow::ConversionResult MainWindow::convertPackage(eagleimport::ConverterDb& db,
+                                                       const parseagle::Package& package,
+                                                       const FilePath& outputDir) noexcept
 {
     try {
         // create package
@@ -192,22 +199,23 @@ bool MainWindow::convertPackage(eagleimport::ConverterDb& db,
         polygonSimplifier.convertLineRectsToPolygonRects(false, true);
 
         // save package to file
-        newPackage->saveIntoParentDirectory(FilePath(QString("%1/pkg").arg(ui->output->text())));
+        newPackage->saveIntoParentDirectory(outputDir);
     } catch (const std::exception& e) {
-        addError(e.what());
-        return false;
+        return ConversionResult{false, e.what()};
     }
 
-    return true;
+    return ConversionResult{true, QString()};
 }
 
-bool MainWindow::convertDevice(eagleimport::ConverterDb& db,
-                               const parseagle::DeviceSet& deviceSet)
+MainWindow::ConversionResult MainWindow::convertDevice(eagleimport::ConverterDb& db,
+                                                      const parseagle::DeviceSet& deviceSet,
+                                                      const FilePath& cmpOutputDir,
+                                                      const FilePath& devOutputDir) noexcept
 {
     try {
         // abort if device name ends with "-US" or "-US_"
-        if (deviceSet.getName().endsWith("-US")) return false;
-        if (deviceSet.getName().endsWith("-US_")) return false;
+        if (deviceSet.getName().endsWith("-US")) return ConversionResult{false, QString()};
+        if (deviceSet.getName().endsWith("-US_")) return ConversionResult{false, QString()};
 
         // create component
         eagleimport::DeviceSetConverter converter(deviceSet, db);
@@ -221,17 +229,16 @@ bool MainWindow::convertDevice(eagleimport::ConverterDb& db,
             std::unique_ptr<Device> newDevice = devConverter.generate();
 
             // save device
-            newDevice->saveIntoParentDirectory(FilePath(QString("%1/dev").arg(ui->output->text())));
+            newDevice->saveIntoParentDirectory(devOutputDir);
         }
 
         // save component to file
-        newComponent->saveIntoParentDirectory(FilePath(QString("%1/cmp").arg(ui->output->text())));
+        newComponent->saveIntoParentDirectory(cmpOutputDir);
     } catch (const std::exception& e) {
-        addError(e.what());
-        return false;
+        return ConversionResult{false, e.what()};
     }
 
-    return true;
+    return ConversionResult{true, QString()};
 }
 
 void MainWindow::on_inputBtn_clicked()
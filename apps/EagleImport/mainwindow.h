@@ -52,17 +52,27 @@ class MainWindow : public QMainWindow
             Devices_to_Components
         };
 
+        struct ConversionResult {
+            bool success;
+            QString error;  ///< empty if there was no error
+        };
+
         void reset();
         void addError(const QString& msg, const librepcb::FilePath& inputFile = librepcb::FilePath(), int inputLine = 0);
         void convertAllFiles(ConvertFileType_t type);
         void convertFile(ConvertFileType_t type, eagleimport::ConverterDb& db,
                          const librepcb::FilePath& filepath);
-        bool convertSymbol(eagleimport::ConverterDb& db,
-                           const parseagle::Symbol& symbol);
-        bool convertPackage(eagleimport::ConverterDb& db,
-                            const parseagle::Package& package);
-        bool convertDevice(eagleimport::ConverterDb& db,
-                           const parseagle::DeviceSet& deviceSet);
+        // the following methods are called from worker threads
+        static ConversionResult convertSymbol(eagleimport::ConverterDb& db,
+                                              const parseagle::Symbol& symbol,
+                                              const librepcb::FilePath& outputDir) noexcept;
+        static ConversionResult convertPackage(eagleimport::ConverterDb& db,
+                                               const parseagle::Package& package,
+                                               const librepcb::FilePath& outputDir) noexcept;
+        static ConversionResult convertDevice(eagleimport::ConverterDb& db,
+                                              const parseagle::DeviceSet& deviceSet,
+                                              const librepcb::FilePath& cmpOutputDir,
+                                              const librepcb::FilePath& devOutputDir) noexcept;
 
         // Attributes
         Ui::MainWindow *ui;
@@ -0,0 +1,63 @@
+#-------------------------------------------------
+#
+# Headless command line interface of LibrePCB
+#
+#-------------------------------------------------
+
+TEMPLATE = app
+TARGET = librepcb-cli
+
+# Set the path for the generated binary
+GENERATED_DIR = ../../generated
+
+# Use common project definitions
+include(../../common.pri)
+
+QT += core widgets opengl network xml printsupport sql concurrent
+
+CONFIG += console
+CONFIG -= app_bundle
+
+unix:!macx {
+    # Linux/UNIX-specific configurations
+    target.path = $${PREFIX}/bin
+    INSTALLS += target
+}
+
+# Note: The order of the libraries is very important for the linker!
+# Another order could end up in "undefined reference" errors!
+LIBS += \
+    -L$${DESTDIR} \
+    -llibrepcbproject \
+    -llibrepcblibrary \
+    -llibrepcbcommon \
+    -lsexpresso \
+    -lclipper \
+    -lquazip -lz
+
+INCLUDEPATH += \
+    ../../libs/quazip \
+    ../../libs
+
+DEPENDPATH += \
+    ../../libs/librepcb/project \
+    ../../libs/librepcb/library \
+    ../../libs/librepcb/common \
+    ../../libs/quazip \
+    ../../libs/sexpresso \
+    ../../libs/clipper \
+
+PRE_TARGETDEPS += \
+    $${DESTDIR}/liblibrepcbproject.a \
+    $${DESTDIR}/liblibrepcblibrary.a \
+    $${DESTDIR}/liblibrepcbcommon.a \
+    $${DESTDIR}/libquazip.a \
+    $${DESTDIR}/libsexpresso.a \
+    $${DESTDIR}/libclipper.a \
+
+SOURCES += \
+    main.cpp \
+    projectexporter.cpp \
+
+HEADERS += \
+    projectexporter.h \
@@ -0,0 +1,137 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/application.h>
+#include <librepcb/common/debug.h>
+#include <librepcb/common/fileio/filepath.h>
+#include "projectexporter.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+using namespace librepcb;
+using namespace librepcb::cli;
+
+/*****************************************************************************************
+ *  Function Prototypes
+ ****************************************************************************************/
+
+static void setApplicationMetadata() noexcept;
+static void printResult(const ProjectExporter::Result& result) noexcept;
+
+/*****************************************************************************************
+ *  main()
+ ****************************************************************************************/
+
+int main(int argc, char* argv[])
+{
+    // No windows are shown at all, so don't require a display server (e.g. on CI servers)
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    Application app(argc, argv);
+    setApplicationMetadata();
+
+    // Parse command line arguments
+    QCommandLineParser parser;
+    parser.setApplicationDescription(Application::translate("Cli",
+        "Export fabrication data of LibrePCB projects without the graphical user interface."));
+    parser.addHelpOption();
+    QCommandLineOption gerberOption({"g", "export-gerber"},
+        Application::translate("Cli", "Export Gerber and Excellon files of all boards."));
+    QCommandLineOption schematicsOption({"s", "export-schematics"},
+        Application::translate("Cli", "Export all schematic pages as PDF."));
+    QCommandLineOption jobsOption({"j", "jobs"},
+        Application::translate("Cli", "Number of boards exported in parallel."),
+        Application::translate("Cli", "count"), QString::number(QThread::idealThreadCount()));
+    QCommandLineOption verboseOption({"v", "verbose"},
+        Application::translate("Cli", "Print debug messages to stderr."));
+    parser.addOption(gerberOption);
+    parser.addOption(schematicsOption);
+    parser.addOption(jobsOption);
+    parser.addOption(verboseOption);
+    parser.addPositionalArgument("projects", Application::translate("Cli",
+        "Project files (*.lpp) to export."), "<project.lpp>...");
+    parser.process(app); // exits the application on invalid arguments
+
+    // Creates the Debug object which installs the message handler
+    Debug::instance()->setDebugLevelStderr(parser.isSet(verboseOption) ?
+        Debug::DebugLevel_t::All : Debug::DebugLevel_t::Warning);
+
+    bool jobsValid = false;
+    int jobs = parser.value(jobsOption).toInt(&jobsValid);
+    if ((!jobsValid) || (jobs < 1) || parser.positionalArguments().isEmpty()) {
+        parser.showHelp(1); // exits the application
+    }
+
+    if ((!parser.isSet(gerberOption)) && (!parser.isSet(schematicsOption))) {
+        QTextStream(stderr) << Application::translate("Cli",
+            "Nothing to export, please specify at least one of the options -g and -s.")
+            << endl;
+        return 1;
+    }
+
+    ProjectExporter exporter;
+    exporter.setExportGerber(parser.isSet(gerberOption));
+    exporter.setExportSchematics(parser.isSet(schematicsOption));
+    exporter.setMaxParallelJobs(jobs);
+
+    // Projects contain GUI objects, so they are exported one after the other in the main
+    // thread (the boards of each project are exported in parallel)
+    int failedProjects = 0;
+    foreach (const QString& arg, parser.positionalArguments()) {
+        FilePath projectFile(QFileInfo(arg).absoluteFilePath());
+        ProjectExporter::Result result = exporter.exportProject(projectFile);
+        printResult(result);
+        if (!result.success) ++failedProjects;
+    }
+
+    return (failedProjects > 0) ? 1 : 0;
+}
+
+/*****************************************************************************************
+ *  setApplicationMetadata()
+ ****************************************************************************************/
+
+static void setApplicationMetadata() noexcept
+{
+    Application::setOrganizationName("LibrePCB");
+    Application::setOrganizationDomain("librepcb.org");
+    Application::setApplicationName("LibrePCB CLI");
+}
+
+/*****************************************************************************************
+ *  printResult()
+ ****************************************************************************************/
+
+static void printResult(const ProjectExporter::Result& result) noexcept
+{
+    QTextStream out(result.success ? stdout : stderr);
+    out << result.projectFile.toNative() << ": "
+        << (result.success ? "OK" : "FAILED") << endl;
+    foreach (const QString& message, result.messages) {
+        out << "  " << message << endl;
+    }
+}
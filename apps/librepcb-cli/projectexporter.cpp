@@ -0,0 +1,170 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtConcurrent/QtConcurrent>
+#include "projectexporter.h"
+#include <librepcb/common/exceptions.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/font/strokefontpool.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/metadata/projectmetadata.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardgerberexport.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace cli {
+
+using namespace project;
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+ProjectExporter::ProjectExporter() noexcept :
+    mExportGerber(false), mExportSchematics(false)
+{
+}
+
+ProjectExporter::~ProjectExporter() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+ProjectExporter::Result ProjectExporter::exportProject(const FilePath& projectFile) noexcept
+{
+    Q_ASSERT(QThread::currentThread() == QCoreApplication::instance()->thread());
+
+    Result result = {projectFile, false, QStringList()};
+    try
+    {
+        // open the project in read-only mode without showing any message boxes
+        Project project(projectFile, true, false); // can throw
+
+        // texts are stroked in the main thread as soon as their font is loaded, which
+        // must be done before the boards are exported in the worker threads
+        project.getStrokeFonts().waitUntilAllLoaded();
+
+        result.success = true;
+        if (mExportGerber) {
+            if (!exportGerber(project, result.messages)) {
+                result.success = false;
+            }
+        }
+
+        // Exported only after all boards are exported because stroking the texts of the
+        // schematics uses the caches of the fonts, which are not thread-safe.
+        if (mExportSchematics) {
+            try {
+                exportSchematics(project, result.messages); // can throw
+            } catch (const Exception& e) {
+                result.success = false;
+                result.messages.append(QString(tr("ERROR: %1")).arg(e.getMsg()));
+            }
+        }
+    }
+    catch (const Exception& e)
+    {
+        result.success = false;
+        result.messages.append(QString(tr("ERROR: %1")).arg(e.getMsg()));
+    }
+    return result;
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+bool ProjectExporter::exportGerber(Project& project, QStringList& messages) noexcept
+{
+    // rebuild planes because they may be outdated! (modifies the boards, so it must be
+    // done in the main thread)
+    foreach (Board* board, project.getBoards()) {
+        board->rebuildAllPlanes();
+    }
+
+    QList<QPair<bool, QString>> results;
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 4, 0)) // QtConcurrent::run(QThreadPool*, ...) requires Qt>=5.4
+    QList<QFuture<QPair<bool, QString>>> futures;
+    foreach (Board* board, project.getBoards()) {
+        futures.append(QtConcurrent::run(&mPool, [board]() -> QPair<bool, QString> {
+            return exportBoardGerber(*board);
+        }));
+    }
+    // the project must not be closed before all boards are exported
+    for (int i = 0; i < futures.count(); ++i) {
+        results.append(futures[i].result());
+    }
+#else
+    // export the boards one after another in the main thread
+    foreach (Board* board, project.getBoards()) {
+        results.append(exportBoardGerber(*board));
+    }
+#endif
+
+    bool success = true;
+    for (const QPair<bool, QString>& boardResult : results) {
+        if (!boardResult.first) success = false;
+        messages.append(boardResult.second);
+    }
+    return success;
+}
+
+QPair<bool, QString> ProjectExporter::exportBoardGerber(Board& board) noexcept
+{
+    try {
+        BoardGerberExport grbExport(board);
+        grbExport.exportAllLayers(); // can throw
+        return qMakePair(true, QString(tr("Exported Gerber files of board \"%1\"."))
+                         .arg(board.getName()));
+    } catch (const Exception& e) {
+        return qMakePair(false, QString(tr("ERROR: %1")).arg(e.getMsg()));
+    }
+}
+
+void ProjectExporter::exportSchematics(Project& project, QStringList& messages) const
+{
+    // use the same default output path as the schematic editor
+    QString projectName = FilePath::cleanFileName(project.getMetadata().getName(),
+                          FilePath::ReplaceSpaces | FilePath::KeepCase);
+    QString projectVersion = FilePath::cleanFileName(project.getMetadata().getVersion(),
+                             FilePath::ReplaceSpaces | FilePath::KeepCase);
+    FilePath filepath = project.getPath().getPathTo(QString("output/%1/%2_Schematics.pdf")
+                                                    .arg(projectVersion, projectName));
+    FileUtils::makePath(filepath.getParentDir()); // can throw
+    project.exportSchematicsAsPdf(filepath); // can throw
+    messages.append(QString(tr("Exported schematics to \"%1\".")).arg(filepath.toNative()));
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace cli
+} // namespace librepcb
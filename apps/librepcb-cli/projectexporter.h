@@ -0,0 +1,120 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LIBREPCB_CLI_PROJECTEXPORTER_H
+#define LIBREPCB_CLI_PROJECTEXPORTER_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/fileio/filepath.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+namespace project {
+class Project;
+class Board;
+}
+
+namespace cli {
+
+/*****************************************************************************************
+ *  Class ProjectExporter
+ ****************************************************************************************/
+
+/**
+ * @brief The ProjectExporter class exports fabrication data of projects without any GUI
+ *
+ * The projects are opened in read-only and non-interactive mode, so no message boxes are
+ * shown and the projects are not modified.
+ *
+ * Projects and schematics contain GUI objects (e.g. graphics scenes), so #exportProject()
+ * must be called from the main thread. Only the Gerber/Excellon export (which just reads
+ * the boards) runs in a thread pool, i.e. all boards are exported in parallel. The
+ * schematics are exported afterwards in the main thread.
+ *
+ * @note With Qt<5.4, the boards are exported one after another in the main thread
+ *       because QtConcurrent::run() does not support custom thread pools.
+ */
+class ProjectExporter final
+{
+        Q_DECLARE_TR_FUNCTIONS(ProjectExporter)
+
+    public:
+
+        // Types
+        struct Result {
+            FilePath projectFile;
+            bool success;
+            QStringList messages;
+        };
+
+        // Constructors / Destructor
+        ProjectExporter() noexcept;
+        ProjectExporter(const ProjectExporter& other) = delete;
+        ~ProjectExporter() noexcept;
+
+        // Setters
+        void setExportGerber(bool exportGerber) noexcept {mExportGerber = exportGerber;}
+        void setExportSchematics(bool exportSchematics) noexcept {mExportSchematics = exportSchematics;}
+        void setMaxParallelJobs(int jobs) noexcept {mPool.setMaxThreadCount(jobs);}
+
+        // General Methods
+
+        /**
+         * @brief Open a project and export all requested outputs
+         *
+         * @param projectFile   The *.lpp file of the project to export
+         *
+         * @return The result of the export, including all log messages
+         */
+        Result exportProject(const FilePath& projectFile) noexcept;
+
+        // Operator Overloadings
+        ProjectExporter& operator=(const ProjectExporter& rhs) = delete;
+
+
+    private: // Methods
+        bool exportGerber(project::Project& project, QStringList& messages) noexcept;
+        static QPair<bool, QString> exportBoardGerber(project::Board& board) noexcept;
+        void exportSchematics(project::Project& project, QStringList& messages) const;
+
+
+    private: // Data
+        bool mExportGerber;
+        bool mExportSchematics;
+
+        /// Separate pool because the global thread pool is used by the projects itself
+        /// to load files in parallel
+        QThreadPool mPool;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace cli
+} // namespace librepcb
+
+#endif // LIBREPCB_CLI_PROJECTEXPORTER_H
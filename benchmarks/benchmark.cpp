@@ -0,0 +1,72 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "benchmark.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+bool Benchmark::registerBenchmark(const QString& name, const Factory& factory) noexcept
+{
+    Q_ASSERT(!registry().contains(name));
+    registry().insert(name, factory);
+    return true;
+}
+
+const QMap<QString, Benchmark::Factory>& Benchmark::getRegisteredBenchmarks() noexcept
+{
+    return registry();
+}
+
+void Benchmark::processDeferredWork() noexcept
+{
+    // timers with zero interval are processed in the next event loop iteration
+    QCoreApplication::sendPostedEvents();
+    QCoreApplication::processEvents();
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+QMap<QString, Benchmark::Factory>& Benchmark::registry() noexcept
+{
+    // constructed on first use because the registration happens during static
+    // initialization, where the initialization order of translation units is undefined
+    static QMap<QString, Factory> benchmarks;
+    return benchmarks;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace benchmarks
+} // namespace librepcb
@@ -0,0 +1,131 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_BENCHMARKS_BENCHMARK_H
+#define LIBREPCB_BENCHMARKS_BENCHMARK_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <functional>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*****************************************************************************************
+ *  Macros
+ ****************************************************************************************/
+
+/**
+ * @brief Register a benchmark class (derived from librepcb::benchmarks::Benchmark)
+ *
+ * @param cls       The class name of the benchmark
+ * @param name      The unique name of the benchmark, e.g. "sexpression/parse". It is used
+ *                  in the results and for filtering.
+ */
+#define LIBREPCB_REGISTER_BENCHMARK(cls, name) \
+    static const bool sBenchmarkRegistered_##cls Q_DECL_UNUSED = \
+        ::librepcb::benchmarks::Benchmark::registerBenchmark(name, [](){return new cls();});
+
+/*****************************************************************************************
+ *  Class Benchmark
+ ****************************************************************************************/
+
+/**
+ * @brief The Benchmark class is the base class of all benchmarks
+ *
+ * The librepcb::benchmarks::BenchmarkRunner calls #setUp() once, then #prepareIteration()
+ * and #runIteration() for every iteration, and finally #tearDown(). Only the time spent
+ * in #runIteration() is measured, so expensive preparations (like generating synthetic
+ * data) should be done in #setUp() or #prepareIteration().
+ *
+ * All methods except #tearDown() may throw a librepcb::Exception to abort the benchmark.
+ */
+class Benchmark
+{
+    public:
+
+        // Types
+        typedef std::function<Benchmark*()> Factory;
+
+        // Constructors / Destructor
+        Benchmark() noexcept {}
+        Benchmark(const Benchmark& other) = delete;
+        virtual ~Benchmark() noexcept {}
+
+        // General Methods
+
+        /**
+         * @brief Prepare the benchmark (not measured)
+         *
+         * @param scale     The size factor of the synthetic data (1 = default size)
+         */
+        virtual void setUp(int scale) {Q_UNUSED(scale);}
+
+        /**
+         * @brief Prepare the next iteration (not measured)
+         */
+        virtual void prepareIteration() {}
+
+        /**
+         * @brief Run one iteration of the measured operation
+         */
+        virtual void runIteration() = 0;
+
+        /**
+         * @brief Clean up all resources allocated by #setUp()
+         */
+        virtual void tearDown() noexcept {}
+
+        // Operator Overloadings
+        Benchmark& operator=(const Benchmark& rhs) = delete;
+
+        // Static Methods
+        static bool registerBenchmark(const QString& name, const Factory& factory) noexcept;
+        static const QMap<QString, Factory>& getRegisteredBenchmarks() noexcept;
+
+
+    protected:
+
+        /**
+         * @brief Process all pending events of the event loop
+         *
+         * Some work is deferred to the event loop (e.g. airwires and ERC messages are
+         * updated by timers). Benchmarks of operations which trigger such work should call
+         * this at the end of #runIteration() to measure the whole cost of the operation.
+         */
+        static void processDeferredWork() noexcept;
+
+
+    private:
+        static QMap<QString, Factory>& registry() noexcept;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace benchmarks
+} // namespace librepcb
+
+#endif // LIBREPCB_BENCHMARKS_BENCHMARK_H
@@ -0,0 +1,192 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <algorithm>
+#include "benchmarkrunner.h"
+#include <librepcb/common/exceptions.h>
+#include <librepcb/common/application.h>
+#if defined(Q_OS_UNIX)
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*****************************************************************************************
+ *  Local Helpers
+ ****************************************************************************************/
+
+static qreal toMilliseconds(qint64 ns) noexcept
+{
+    return ns / 1000000.0;
+}
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BenchmarkRunner::BenchmarkRunner(int scale, int warmupIterations, int iterations) noexcept :
+    mScale(scale), mWarmupIterations(warmupIterations), mIterations(iterations)
+{
+    Q_ASSERT(mScale > 0);
+    Q_ASSERT(mWarmupIterations >= 0);
+    Q_ASSERT(mIterations > 0);
+}
+
+BenchmarkRunner::~BenchmarkRunner() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+bool BenchmarkRunner::hasFailures() const noexcept
+{
+    foreach (const BenchmarkResult& result, mResults) {
+        if (!result.error.isEmpty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+const BenchmarkResult& BenchmarkRunner::run(const QString& name, Benchmark& benchmark) noexcept
+{
+    BenchmarkResult result;
+    result.name = name;
+    qint64 memoryBefore = getCurrentMemoryUsageKib();
+    try {
+        benchmark.setUp(mScale); // can throw
+        for (int i = 0; i < mWarmupIterations + mIterations; ++i) {
+            benchmark.prepareIteration(); // can throw
+            QElapsedTimer timer;
+            timer.start();
+            benchmark.runIteration(); // can throw
+            qint64 duration = timer.nsecsElapsed();
+            if (i >= mWarmupIterations) {
+                result.durationsNs.append(duration);
+            }
+        }
+    } catch (const Exception& e) {
+        result.error = e.getMsg();
+    } catch (const std::exception& e) {
+        result.error = QString::fromLocal8Bit(e.what());
+    }
+    qint64 memoryAfter = getCurrentMemoryUsageKib();
+    benchmark.tearDown();
+    result.memoryDeltaKib = ((memoryBefore >= 0) && (memoryAfter >= 0))
+                            ? (memoryAfter - memoryBefore) : -1;
+    result.peakMemoryKib = getPeakMemoryUsageKib();
+    mResults.append(result);
+    return mResults.last();
+}
+
+QJsonDocument BenchmarkRunner::toJson() const noexcept
+{
+    QJsonArray benchmarks;
+    foreach (const BenchmarkResult& result, mResults) {
+        QVector<qint64> durations = result.durationsNs;
+        std::sort(durations.begin(), durations.end());
+        qint64 sum = 0;
+        foreach (qint64 duration, durations) {
+            sum += duration;
+        }
+        QJsonObject obj;
+        obj.insert("name", result.name);
+        obj.insert("iterations", durations.count());
+        if (!durations.isEmpty()) {
+            qint64 median = (durations.count() % 2)
+                ? durations.at(durations.count() / 2)
+                : (durations.at(durations.count() / 2 - 1) + durations.at(durations.count() / 2)) / 2;
+            obj.insert("min_ms", toMilliseconds(durations.first()));
+            obj.insert("median_ms", toMilliseconds(median));
+            obj.insert("mean_ms", toMilliseconds(sum / durations.count()));
+            obj.insert("max_ms", toMilliseconds(durations.last()));
+        }
+        obj.insert("memory_delta_kib", result.memoryDeltaKib);
+        obj.insert("peak_memory_kib", result.peakMemoryKib);
+        obj.insert("error", result.error);
+        benchmarks.append(obj);
+    }
+
+    QJsonObject root;
+    root.insert("version", qApp->applicationVersion());
+    root.insert("qt_version", QString(qVersion()));
+    root.insert("timestamp", QDateTime::currentDateTimeUtc().toString(Qt::ISODate));
+    root.insert("scale", mScale);
+    root.insert("iterations", mIterations);
+    root.insert("benchmarks", benchmarks);
+    return QJsonDocument(root);
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+qint64 BenchmarkRunner::getCurrentMemoryUsageKib() noexcept
+{
+#if defined(Q_OS_LINUX)
+    // the second value of /proc/self/statm is the resident set size in pages
+    QFile file("/proc/self/statm");
+    if (file.open(QIODevice::ReadOnly)) {
+        QList<QByteArray> values = file.readAll().split(' ');
+        bool ok = false;
+        qint64 pages = (values.count() > 1) ? values.at(1).toLongLong(&ok) : 0;
+        if (ok) {
+            return pages * sysconf(_SC_PAGESIZE) / 1024;
+        }
+    }
+#endif
+    return -1;
+}
+
+qint64 BenchmarkRunner::getPeakMemoryUsageKib() noexcept
+{
+#if defined(Q_OS_UNIX)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined(Q_OS_MAC)
+        return usage.ru_maxrss / 1024; // bytes on Mac OS
+#else
+        return usage.ru_maxrss; // kilobytes on Linux and BSD
+#endif
+    }
+#endif
+    return -1;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace benchmarks
+} // namespace librepcb
@@ -0,0 +1,119 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_BENCHMARKS_BENCHMARKRUNNER_H
+#define LIBREPCB_BENCHMARKS_BENCHMARKRUNNER_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "benchmark.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*****************************************************************************************
+ *  Struct BenchmarkResult
+ ****************************************************************************************/
+
+/**
+ * @brief The result of running a single benchmark
+ */
+struct BenchmarkResult
+{
+    QString name;
+    QVector<qint64> durationsNs;    ///< the measured time of each iteration
+    qint64 memoryDeltaKib;          ///< resident memory growth, or -1 if not available
+    qint64 peakMemoryKib;           ///< peak resident memory of the process, or -1
+    QString error;                  ///< empty on success
+};
+
+/*****************************************************************************************
+ *  Class BenchmarkRunner
+ ****************************************************************************************/
+
+/**
+ * @brief The BenchmarkRunner class runs benchmarks and reports their results
+ *
+ * Each benchmark runs some warmup iterations (not reported) followed by the measured
+ * iterations. The results are written as JSON document which is intended to be stored
+ * by the CI to track the performance over time:
+ *
+ * @code
+ * {
+ *   "version": "0.1.0", "qt_version": "5.9.1", "timestamp": "2017-11-04T13:00:00Z",
+ *   "scale": 1, "iterations": 5,
+ *   "benchmarks": [
+ *     {"name": "sexpression/parse", "iterations": 5, "min_ms": 10.1, "median_ms": 10.4,
+ *      "mean_ms": 10.5, "max_ms": 11.0, "memory_delta_kib": 512,
+ *      "peak_memory_kib": 40960, "error": ""},
+ *     ...
+ *   ]
+ * }
+ * @endcode
+ *
+ * @note The peak memory is the high-water mark of the whole process, so it only
+ *       belongs to a single benchmark if each benchmark is run in its own process
+ *       (use the "--filter" option).
+ */
+class BenchmarkRunner final
+{
+    public:
+
+        // Constructors / Destructor
+        BenchmarkRunner() = delete;
+        BenchmarkRunner(const BenchmarkRunner& other) = delete;
+        BenchmarkRunner(int scale, int warmupIterations, int iterations) noexcept;
+        ~BenchmarkRunner() noexcept;
+
+        // Getters
+        const QList<BenchmarkResult>& getResults() const noexcept {return mResults;}
+        bool hasFailures() const noexcept;
+
+        // General Methods
+        const BenchmarkResult& run(const QString& name, Benchmark& benchmark) noexcept;
+        QJsonDocument toJson() const noexcept;
+
+        // Operator Overloadings
+        BenchmarkRunner& operator=(const BenchmarkRunner& rhs) = delete;
+
+        // Static Methods
+        static qint64 getCurrentMemoryUsageKib() noexcept;
+        static qint64 getPeakMemoryUsageKib() noexcept;
+
+
+    private: // Data
+        int mScale;
+        int mWarmupIterations;
+        int mIterations;
+        QList<BenchmarkResult> mResults;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace benchmarks
+} // namespace librepcb
+
+#endif // LIBREPCB_BENCHMARKS_BENCHMARKRUNNER_H
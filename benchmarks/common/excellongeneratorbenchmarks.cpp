@@ -0,0 +1,83 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/cam/excellongenerator.h>
+#include "../benchmark.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*****************************************************************************************
+ *  Benchmark Classes
+ ****************************************************************************************/
+
+/**
+ * @brief Generate an Excellon file with many randomly placed hits of the same tool
+ */
+class ExcellonGenerateBenchmark : public Benchmark
+{
+    public:
+        explicit ExcellonGenerateBenchmark(bool optimize = false) noexcept :
+            mOptimize(optimize) {}
+        void setUp(int scale) override {
+            mGenerator.reset(new ExcellonGenerator());
+            mGenerator->setOptimizeDrillOrder(mOptimize);
+            qsrand(42); // fixed seed to get reproducible results
+            for (int i = 0; i < 10000 * scale; ++i) {
+                Point pos(Length::fromMm(qrand() % 100000 / 1000.0),
+                          Length::fromMm(qrand() % 100000 / 1000.0));
+                mGenerator->drill(pos, Length::fromMm(0.3));
+            }
+        }
+        void runIteration() override {
+            mGenerator->generate(); // can throw
+        }
+        void tearDown() noexcept override {
+            mGenerator.reset();
+        }
+
+    private:
+        bool mOptimize;
+        QScopedPointer<ExcellonGenerator> mGenerator;
+};
+LIBREPCB_REGISTER_BENCHMARK(ExcellonGenerateBenchmark, "excellon/generate")
+
+/**
+ * @brief Same as ExcellonGenerateBenchmark, but with optimized drill order
+ */
+class ExcellonGenerateOptimizedBenchmark final : public ExcellonGenerateBenchmark
+{
+    public:
+        ExcellonGenerateOptimizedBenchmark() noexcept : ExcellonGenerateBenchmark(true) {}
+};
+LIBREPCB_REGISTER_BENCHMARK(ExcellonGenerateOptimizedBenchmark, "excellon/generate_optimized")
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace benchmarks
+} // namespace librepcb
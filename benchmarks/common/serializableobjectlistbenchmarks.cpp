@@ -0,0 +1,104 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/exceptions.h>
+#include <librepcb/library/pkg/packagepad.h>
+#include "../benchmark.h"
+#include "../syntheticdata.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*****************************************************************************************
+ *  Benchmark Classes
+ ****************************************************************************************/
+
+/**
+ * @brief Look up every element of a big librepcb::SerializableObjectList by its UUID
+ *
+ * The default implementation uses librepcb::SerializableObjectList::find(), i.e. the
+ * UUID index. It is built in #setUp(), so only the lookups are measured.
+ */
+class SerializableObjectListFindBenchmark : public Benchmark
+{
+    public:
+        void setUp(int scale) override {
+            SyntheticData data;
+            for (int i = 0; i < 2000 * scale; ++i) {
+                Uuid uuid = data.createUuid();
+                mList.append(std::make_shared<library::PackagePad>(uuid, QString::number(i)));
+                mUuids.append(uuid);
+            }
+            qsrand(42); // fixed seed to get reproducible results
+            for (int i = mUuids.count() - 1; i > 0; --i) { // look up in random order
+                qSwap(mUuids[i], mUuids[qrand() % (i + 1)]);
+            }
+            mList.find(mUuids.first()); // build the index
+        }
+        void runIteration() override {
+            foreach (const Uuid& uuid, mUuids) {
+                if (!find(uuid)) throw LogicError(__FILE__, __LINE__);
+            }
+        }
+        void tearDown() noexcept override {
+            mList.clear();
+            mUuids.clear();
+        }
+
+    protected:
+        virtual const library::PackagePad* find(const Uuid& uuid) const noexcept {
+            return mList.find(uuid).get();
+        }
+
+        library::PackagePadList mList;
+        QVector<Uuid> mUuids;
+};
+LIBREPCB_REGISTER_BENCHMARK(SerializableObjectListFindBenchmark, "serializableobjectlist/find_indexed")
+
+/**
+ * @brief Same as SerializableObjectListFindBenchmark, but with a linear search
+ *
+ * This is how librepcb::SerializableObjectList looked up elements before the UUID index
+ * was introduced, so it serves as baseline for the indexed lookups.
+ */
+class SerializableObjectListFindLinearBenchmark final : public SerializableObjectListFindBenchmark
+{
+    protected:
+        const library::PackagePad* find(const Uuid& uuid) const noexcept override {
+            for (const library::PackagePad& pad : mList) {
+                if (pad.getUuid() == uuid) return &pad;
+            }
+            return nullptr;
+        }
+};
+LIBREPCB_REGISTER_BENCHMARK(SerializableObjectListFindLinearBenchmark, "serializableobjectlist/find_linear")
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace benchmarks
+} // namespace librepcb
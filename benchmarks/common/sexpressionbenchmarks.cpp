@@ -0,0 +1,88 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/fileio/filepath.h>
+#include <librepcb/common/fileio/sexpression.h>
+#include "../benchmark.h"
+#include "../syntheticdata.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*****************************************************************************************
+ *  Benchmark Classes
+ ****************************************************************************************/
+
+/**
+ * @brief Parse a big S-Expression document from a string
+ */
+class SExpressionParseBenchmark final : public Benchmark
+{
+    public:
+        void setUp(int scale) override {
+            mContent = SyntheticData().createSExpression(scale).toString(0);
+        }
+        void runIteration() override {
+            SExpression root = SExpression::parse(mContent, FilePath()); // can throw
+            Q_UNUSED(root);
+        }
+        void tearDown() noexcept override {
+            mContent.clear();
+        }
+
+    private:
+        QString mContent;
+};
+LIBREPCB_REGISTER_BENCHMARK(SExpressionParseBenchmark, "sexpression/parse")
+
+/**
+ * @brief Serialize a big S-Expression document to a string
+ */
+class SExpressionSerializeBenchmark final : public Benchmark
+{
+    public:
+        void setUp(int scale) override {
+            mRoot.reset(new SExpression(SyntheticData().createSExpression(scale)));
+        }
+        void runIteration() override {
+            QString content = mRoot->toString(0);
+            Q_UNUSED(content);
+        }
+        void tearDown() noexcept override {
+            mRoot.reset();
+        }
+
+    private:
+        QScopedPointer<SExpression> mRoot;
+};
+LIBREPCB_REGISTER_BENCHMARK(SExpressionSerializeBenchmark, "sexpression/serialize")
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace benchmarks
+} // namespace librepcb
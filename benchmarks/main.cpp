@@ -0,0 +1,120 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/application.h>
+#include <librepcb/common/debug.h>
+#include "benchmark.h"
+#include "benchmarkrunner.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+using namespace librepcb;
+using namespace librepcb::benchmarks;
+
+/*****************************************************************************************
+ *  The Benchmark Program
+ ****************************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    // many classes rely on a QApplication instance, so we create it here
+    Application app(argc, argv);
+    Application::setOrganizationName("LibrePCB");
+    Application::setOrganizationDomain("librepcb.org");
+    Application::setApplicationName("LibrePCB-Benchmarks");
+
+    // disable the whole debug output (it would distort the measurements)
+    Debug::instance()->setDebugLevelLogFile(Debug::DebugLevel_t::Nothing);
+    Debug::instance()->setDebugLevelStderr(Debug::DebugLevel_t::Nothing);
+
+    // parse command line arguments
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Runs the LibrePCB benchmarks and prints the "
+                                     "results as JSON document.");
+    parser.addHelpOption();
+    QCommandLineOption listOption("list", "List all benchmarks and exit.");
+    QCommandLineOption filterOption("filter", "Only run benchmarks whose name matches "
+                                    "the regular expression <regex>.", "regex");
+    QCommandLineOption scaleOption("scale", "Size factor of the synthetic data "
+                                   "(default: 1).", "factor", "1");
+    QCommandLineOption iterationsOption("iterations", "Number of measured iterations "
+                                        "(default: 5).", "count", "5");
+    QCommandLineOption warmupOption("warmup", "Number of warmup iterations "
+                                    "(default: 1).", "count", "1");
+    QCommandLineOption outputOption("output", "Write the JSON results to <file> "
+                                    "instead of stdout.", "file");
+    parser.addOption(listOption);
+    parser.addOption(filterOption);
+    parser.addOption(scaleOption);
+    parser.addOption(iterationsOption);
+    parser.addOption(warmupOption);
+    parser.addOption(outputOption);
+    parser.process(app);
+
+    QTextStream out(stdout);
+    QTextStream err(stderr);
+    int scale = parser.value(scaleOption).toInt();
+    int iterations = parser.value(iterationsOption).toInt();
+    int warmup = parser.value(warmupOption).toInt();
+    QRegularExpression filter(parser.value(filterOption));
+    if ((scale < 1) || (iterations < 1) || (warmup < 0) || (!filter.isValid())) {
+        err << "Invalid arguments, see --help." << endl;
+        return 2;
+    }
+
+    // run all (matching) benchmarks
+    BenchmarkRunner runner(scale, warmup, iterations);
+    const QMap<QString, Benchmark::Factory>& benchmarks = Benchmark::getRegisteredBenchmarks();
+    foreach (const QString& name, benchmarks.keys()) {
+        if (!filter.match(name).hasMatch()) {
+            continue;
+        }
+        if (parser.isSet(listOption)) {
+            out << name << endl;
+            continue;
+        }
+        err << "Running " << name << "..." << endl;
+        QScopedPointer<Benchmark> benchmark(benchmarks.value(name)());
+        const BenchmarkResult& result = runner.run(name, *benchmark);
+        if (!result.error.isEmpty()) {
+            err << "  FAILED: " << result.error << endl;
+        }
+    }
+    if (parser.isSet(listOption)) {
+        return 0;
+    }
+
+    // write results
+    QByteArray json = runner.toJson().toJson(QJsonDocument::Indented);
+    if (parser.isSet(outputOption)) {
+        QFile file(parser.value(outputOption));
+        if ((!file.open(QIODevice::WriteOnly)) || (file.write(json) != json.size())) {
+            err << "Could not write " << file.fileName() << ": " << file.errorString() << endl;
+            return 1;
+        }
+    } else {
+        out << json;
+    }
+    return runner.hasFailures() ? 1 : 0;
+}
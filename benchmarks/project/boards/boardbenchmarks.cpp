@@ -0,0 +1,193 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/undostack.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardgerberexport.h>
+#include <librepcb/project/boards/items/bi_via.h>
+#include <librepcb/project/boards/cmd/cmdboardnetsegmentadd.h>
+#include <librepcb/project/boards/cmd/cmdboardnetsegmentaddelements.h>
+#include "../projectbenchmarkbase.h"
+#include "../../syntheticdata.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+using namespace project;
+
+/*****************************************************************************************
+ *  Local Helpers
+ ****************************************************************************************/
+
+/**
+ * @brief Add a new net segment with some vias to each net signal, within one command group
+ */
+static void execBulkCommands(UndoStack& stack, Board& board, SyntheticData& data)
+{
+    stack.beginCmdGroup("Add net segments"); // can throw
+    foreach (NetSignal* netsignal, board.getProject().getCircuit().getNetSignals()) {
+        CmdBoardNetSegmentAdd* cmdAddSegment = new CmdBoardNetSegmentAdd(board, *netsignal);
+        stack.appendToCmdGroup(cmdAddSegment); // can throw
+        QScopedPointer<CmdBoardNetSegmentAddElements> cmdAddElements(
+            new CmdBoardNetSegmentAddElements(*cmdAddSegment->getNetSegment()));
+        for (int i = 0; i < 5; ++i) {
+            Point pos(data.createLength(0, 25000000), data.createLength(0, 100000000));
+            cmdAddElements->addVia(pos, BI_Via::Shape::Round, Length(700000),
+                                   Length(300000)); // can throw
+        }
+        stack.appendToCmdGroup(cmdAddElements.take()); // can throw
+    }
+    stack.commitCmdGroup(); // can throw
+}
+
+/*****************************************************************************************
+ *  Benchmark Classes
+ ****************************************************************************************/
+
+/**
+ * @brief Rebuild the fragments of all planes of the board
+ */
+class BoardPlaneFillBenchmark final : public ProjectBenchmarkBase
+{
+    public:
+        void runIteration() override {
+            mBoard->rebuildAllPlanes();
+        }
+};
+LIBREPCB_REGISTER_BENCHMARK(BoardPlaneFillBenchmark, "board/plane_fill")
+
+/**
+ * @brief Export all Gerber and Excellon files of the board
+ */
+class BoardGerberExportBenchmark final : public ProjectBenchmarkBase
+{
+    public:
+        void runIteration() override {
+            BoardGerberExport grbExport(*mBoard);
+            grbExport.exportAllLayers(); // can throw
+        }
+};
+LIBREPCB_REGISTER_BENCHMARK(BoardGerberExportBenchmark, "board/gerber_export")
+
+/**
+ * @brief Determine the items at many positions of the board (as done on mouse events)
+ */
+class BoardHitTestBenchmark final : public ProjectBenchmarkBase
+{
+    public:
+        void setUp(int scale) override {
+            ProjectBenchmarkBase::setUp(scale); // can throw
+            mBoard->initGraphicsScene(); // hit-testing requires the graphics items
+            SyntheticData data;
+            for (int i = 0; i < 1000; ++i) {
+                mPositions.append(Point(data.createLength(0, 30000000),
+                                        data.createLength(0, Length(100000000) * scale)));
+            }
+        }
+        void runIteration() override {
+            int count = 0;
+            foreach (const Point& pos, mPositions) {
+                count += mBoard->getItemsAtScenePos(pos).count();
+            }
+            Q_UNUSED(count);
+        }
+        void tearDown() noexcept override {
+            mPositions.clear();
+            ProjectBenchmarkBase::tearDown();
+        }
+
+    private:
+        QList<Point> mPositions;
+};
+LIBREPCB_REGISTER_BENCHMARK(BoardHitTestBenchmark, "board/hit_test")
+
+/**
+ * @brief Execute a command group which adds many board items at once
+ *
+ * Includes the deferred work triggered by the command (e.g. airwires and ERC messages).
+ */
+class BoardBulkCommandExecBenchmark final : public ProjectBenchmarkBase
+{
+    public:
+        void prepareIteration() override {
+            // revert the previous iteration to always start with the same board
+            if (mStack && mStack->canUndo()) {
+                mStack->undo(); // can throw
+            }
+            mStack.reset(new UndoStack());
+            processDeferredWork();
+        }
+        void runIteration() override {
+            execBulkCommands(*mStack, *mBoard, mData); // can throw
+            processDeferredWork();
+        }
+        void tearDown() noexcept override {
+            mStack.reset();
+            ProjectBenchmarkBase::tearDown();
+        }
+
+    private:
+        SyntheticData mData;
+        QScopedPointer<UndoStack> mStack;
+};
+LIBREPCB_REGISTER_BENCHMARK(BoardBulkCommandExecBenchmark, "board/bulk_command_exec")
+
+/**
+ * @brief Undo a command group which has added many board items at once
+ *
+ * Includes the deferred work triggered by the undo (e.g. airwires and ERC messages).
+ */
+class BoardBulkCommandUndoBenchmark final : public ProjectBenchmarkBase
+{
+    public:
+        void prepareIteration() override {
+            mStack.reset(new UndoStack()); // deletes the items of the previous iteration
+            execBulkCommands(*mStack, *mBoard, mData); // can throw
+            processDeferredWork();
+        }
+        void runIteration() override {
+            mStack->undo(); // can throw
+            processDeferredWork();
+        }
+        void tearDown() noexcept override {
+            mStack.reset();
+            ProjectBenchmarkBase::tearDown();
+        }
+
+    private:
+        SyntheticData mData;
+        QScopedPointer<UndoStack> mStack;
+};
+LIBREPCB_REGISTER_BENCHMARK(BoardBulkCommandUndoBenchmark, "board/bulk_command_undo")
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace benchmarks
+} // namespace librepcb
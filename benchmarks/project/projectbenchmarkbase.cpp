@@ -0,0 +1,79 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "projectbenchmarkbase.h"
+#include "../syntheticdata.h"
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/boards/board.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+ProjectBenchmarkBase::ProjectBenchmarkBase() noexcept :
+    mBoard(nullptr)
+{
+}
+
+ProjectBenchmarkBase::~ProjectBenchmarkBase() noexcept
+{
+    Q_ASSERT(!mProject);
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void ProjectBenchmarkBase::setUp(int scale)
+{
+    mTmpDir = FilePath::getRandomTempPath();
+    mProjectFile = mTmpDir.getPathTo("benchmark/benchmark.lpp");
+    mProject.reset(project::Project::create(mProjectFile)); // can throw
+    mBoard = &SyntheticData().createBoard(*mProject, scale); // can throw
+    mProject->save(true); // can throw
+}
+
+void ProjectBenchmarkBase::tearDown() noexcept
+{
+    mBoard = nullptr;
+    mProject.reset();
+    try {
+        FileUtils::removeDirRecursively(mTmpDir);
+    } catch (const Exception& e) {
+        qWarning() << "Could not remove temporary directory:" << e.getMsg();
+    }
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace benchmarks
+} // namespace librepcb
@@ -0,0 +1,83 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_BENCHMARKS_PROJECTBENCHMARKBASE_H
+#define LIBREPCB_BENCHMARKS_PROJECTBENCHMARKBASE_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/fileio/filepath.h>
+#include "../benchmark.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+namespace project {
+class Project;
+class Board;
+}
+
+namespace benchmarks {
+
+/*****************************************************************************************
+ *  Class ProjectBenchmarkBase
+ ****************************************************************************************/
+
+/**
+ * @brief Base class for benchmarks which need a project with a synthetic board
+ *
+ * #setUp() creates a new project in a temporary directory, adds a board generated by
+ * librepcb::benchmarks::SyntheticData and saves the project. The project stays open
+ * (#mProject) until #tearDown() is called, which also removes the temporary directory.
+ */
+class ProjectBenchmarkBase : public Benchmark
+{
+    public:
+
+        // Constructors / Destructor
+        ProjectBenchmarkBase() noexcept;
+        ~ProjectBenchmarkBase() noexcept;
+
+        // General Methods
+        void setUp(int scale) override;
+        void tearDown() noexcept override;
+
+
+    protected: // Data
+        FilePath mProjectFile;
+        QScopedPointer<project::Project> mProject;
+        project::Board* mBoard;
+
+
+    private: // Data
+        FilePath mTmpDir;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace benchmarks
+} // namespace librepcb
+
+#endif // LIBREPCB_BENCHMARKS_PROJECTBENCHMARKBASE_H
@@ -0,0 +1,73 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/project/project.h>
+#include "projectbenchmarkbase.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+using namespace project;
+
+/*****************************************************************************************
+ *  Benchmark Classes
+ ****************************************************************************************/
+
+/**
+ * @brief Open (and close) a project in read-only mode
+ */
+class ProjectOpenBenchmark final : public ProjectBenchmarkBase
+{
+    public:
+        void setUp(int scale) override {
+            ProjectBenchmarkBase::setUp(scale); // can throw
+            mBoard = nullptr;
+            mProject.reset(); // release the directory lock
+        }
+        void runIteration() override {
+            Project project(mProjectFile, true, false); // can throw
+        }
+};
+LIBREPCB_REGISTER_BENCHMARK(ProjectOpenBenchmark, "project/open")
+
+/**
+ * @brief Save an opened project to the original files
+ */
+class ProjectSaveBenchmark final : public ProjectBenchmarkBase
+{
+    public:
+        void runIteration() override {
+            mProject->save(true); // can throw
+        }
+};
+LIBREPCB_REGISTER_BENCHMARK(ProjectSaveBenchmark, "project/save")
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace benchmarks
+} // namespace librepcb
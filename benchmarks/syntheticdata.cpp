@@ -0,0 +1,271 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "syntheticdata.h"
+#include <librepcb/common/exceptions.h>
+#include <librepcb/common/version.h>
+#include <librepcb/common/fileio/filepath.h>
+#include <librepcb/common/geometry/path.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/library/library.h>
+#include <librepcb/library/sym/symbol.h>
+#include <librepcb/library/pkg/package.h>
+#include <librepcb/library/cmp/component.h>
+#include <librepcb/library/dev/device.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/netclass.h>
+#include <librepcb/project/circuit/netsignal.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardlayerstack.h>
+#include <librepcb/project/boards/items/bi_netsegment.h>
+#include <librepcb/project/boards/items/bi_netpoint.h>
+#include <librepcb/project/boards/items/bi_netline.h>
+#include <librepcb/project/boards/items/bi_via.h>
+#include <librepcb/project/boards/items/bi_plane.h>
+#include <librepcb/project/boards/items/bi_polygon.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+using namespace project;
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+SyntheticData::SyntheticData(quint32 seed) noexcept :
+    mRandom(seed)
+{
+}
+
+SyntheticData::~SyntheticData() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+Uuid SyntheticData::createUuid() noexcept
+{
+    // build a valid version 4 UUID from the random number generator
+    quint32 values[4] = {mRandom(), mRandom(), mRandom(), mRandom()};
+    values[1] = (values[1] & 0xFFFF0FFFu) | 0x00004000u; // version 4
+    values[2] = (values[2] & 0x3FFFFFFFu) | 0x80000000u; // variant DCE
+    QString str = QString("%1-%2-%3-%4-%5%6")
+        .arg(values[0], 8, 16, QChar('0'))
+        .arg(values[1] >> 16, 4, 16, QChar('0'))
+        .arg(values[1] & 0xFFFFu, 4, 16, QChar('0'))
+        .arg(values[2] >> 16, 4, 16, QChar('0'))
+        .arg(values[2] & 0xFFFFu, 4, 16, QChar('0'))
+        .arg(values[3], 8, 16, QChar('0'));
+    Uuid uuid(str);
+    Q_ASSERT(!uuid.isNull());
+    return uuid;
+}
+
+Length SyntheticData::createLength(const Length& min, const Length& max) noexcept
+{
+    // note: std::uniform_int_distribution is implementation-defined, thus not used
+    Q_ASSERT(max >= min);
+    quint64 range = static_cast<quint64>((max - min).toNm()) + 1;
+    quint64 value = (static_cast<quint64>(mRandom()) << 32) | mRandom();
+    return min + Length(static_cast<LengthBase_t>(value % range));
+}
+
+SExpression SyntheticData::createSExpression(int scale) noexcept
+{
+    SExpression root = SExpression::createList("librepcb_board");
+    root.appendToken(createUuid());
+    root.appendStringChild("name", QString("Synthetic Board"), true);
+    for (int i = 0; i < 1000 * scale; ++i) {
+        SExpression& segment = root.appendList("netsegment", true);
+        segment.appendToken(createUuid());
+        segment.appendTokenChild("net", createUuid(), true);
+        QList<Uuid> viaUuids;
+        for (int k = 0; k < 5; ++k) {
+            viaUuids.append(createUuid());
+            SExpression& via = segment.appendList("via", true);
+            via.appendToken(viaUuids.last());
+            Point pos(createLength(0, 100000000), createLength(0, 100000000));
+            via.appendChild(pos.serializeToDomElement("position"), false);
+            via.appendTokenChild("size", Length(700000), false);
+            via.appendTokenChild("drill", Length(300000), false);
+            via.appendTokenChild("shape", QString("round"), false);
+        }
+        for (int k = 1; k < viaUuids.count(); ++k) {
+            SExpression& line = segment.appendList("netline", true);
+            line.appendToken(createUuid());
+            line.appendTokenChild("width", Length(250000), false);
+            line.appendTokenChild("from", viaUuids.at(k - 1), true);
+            line.appendTokenChild("to", viaUuids.at(k), true);
+        }
+    }
+    return root;
+}
+
+Board& SyntheticData::createBoard(Project& project, int scale)
+{
+    const int netCount = 40 * scale;
+    const int viasPerNet = 10;
+    const Length pitch(2540000);
+    const Length jitter(500000);
+    const Length width = pitch * (viasPerNet + 1);
+    const Length height = pitch * (netCount + 1);
+    const int boardIndex = project.getBoards().count();
+
+    QScopedPointer<Board> boardGuard(project.createBoard(
+        QString("Synthetic Board %1").arg(boardIndex + 1))); // can throw
+    project.addBoard(*boardGuard); // can throw
+    Board& board = *boardGuard.take();
+
+    // board outline
+    QScopedPointer<BI_Polygon> outline(new BI_Polygon(board, createUuid(),
+        GraphicsLayer::sBoardOutlines, Length(0), false, false,
+        Path::rect(Point(0, 0), Point(width, height)))); // can throw
+    board.addPolygon(*outline); // can throw
+    outline.take();
+
+    // net signals
+    Circuit& circuit = project.getCircuit();
+    if (circuit.getNetClasses().isEmpty()) throw LogicError(__FILE__, __LINE__);
+    NetClass& netclass = *circuit.getNetClasses().first();
+    QList<NetSignal*> netsignals;
+    for (int i = 0; i < netCount; ++i) {
+        QScopedPointer<NetSignal> netsignal(new NetSignal(circuit, netclass,
+            QString("B%1_N%2").arg(boardIndex + 1).arg(i + 1), false)); // can throw
+        circuit.addNetSignal(*netsignal); // can throw
+        netsignals.append(netsignal.take());
+    }
+
+    // net segments: one row of vias per net, connected by traces on alternating layers
+    for (int i = 0; i < netCount; ++i) {
+        GraphicsLayer* layer = board.getLayerStack().getLayer(
+            (i % 2) ? GraphicsLayer::sBotCopper : GraphicsLayer::sTopCopper);
+        if (!layer) throw LogicError(__FILE__, __LINE__);
+        QScopedPointer<BI_NetSegment> segmentGuard(
+            new BI_NetSegment(board, *netsignals.at(i))); // can throw
+        board.addNetSegment(*segmentGuard); // can throw
+        BI_NetSegment& segment = *segmentGuard.take();
+        QList<BI_Via*> vias;
+        QList<BI_NetPoint*> netpoints;
+        QList<BI_NetLine*> netlines;
+        for (int k = 0; k < viasPerNet; ++k) {
+            Point pos(pitch * (k + 1) + createLength(-jitter, jitter),
+                      pitch * (i + 1) + createLength(-jitter, jitter) / 2);
+            vias.append(new BI_Via(segment, pos, BI_Via::Shape::Round,
+                                   Length(700000), Length(300000))); // can throw
+            netpoints.append(new BI_NetPoint(segment, *layer, *vias.last())); // can throw
+            if (k > 0) {
+                netlines.append(new BI_NetLine(*netpoints.at(k - 1), *netpoints.at(k),
+                                               Length(250000))); // can throw
+            }
+        }
+        segment.addElements(vias, netpoints, netlines); // can throw
+    }
+
+    // planes of the first two nets, which have to keep clearance to all other nets
+    Path planeOutline = Path::rect(Point(pitch / 2, pitch / 2),
+                                   Point(width - pitch / 2, height - pitch / 2));
+    for (int i = 0; i < 2; ++i) {
+        QScopedPointer<BI_Plane> plane(new BI_Plane(board, createUuid(),
+            i ? GraphicsLayer::sBotCopper : GraphicsLayer::sTopCopper,
+            *netsignals.at(i), planeOutline)); // can throw
+        board.addPlane(*plane); // can throw
+        plane.take();
+    }
+
+    return board;
+}
+
+void SyntheticData::createLibrary(const FilePath& libDir, int scale)
+{
+    const Version version("0.1");
+    const QString author("LibrePCB Benchmarks");
+
+    library::Library lib(createUuid(), version, author, "Synthetic Library",
+                         "Generated library for benchmarks", "benchmark");
+    lib.saveTo(libDir); // can throw
+
+    QList<Uuid> packages;
+    for (int i = 0; i < 50 * scale; ++i) {
+        library::Package element(createUuid(), version, author, createName(i),
+                                 QString(), SyntheticData::getWords().at(i % 10));
+        element.saveIntoParentDirectory(lib.getElementsDirectory<library::Package>()); // can throw
+        packages.append(element.getUuid());
+    }
+    for (int i = 0; i < 50 * scale; ++i) {
+        library::Symbol element(createUuid(), version, author, createName(i),
+                                QString(), SyntheticData::getWords().at(i % 10));
+        element.saveIntoParentDirectory(lib.getElementsDirectory<library::Symbol>()); // can throw
+    }
+    QList<Uuid> components;
+    for (int i = 0; i < 100 * scale; ++i) {
+        library::Component element(createUuid(), version, author, createName(i),
+                                   QString(), SyntheticData::getWords().at(i % 10));
+        element.getPrefixes().setDefaultValue("U");
+        element.saveIntoParentDirectory(lib.getElementsDirectory<library::Component>()); // can throw
+        components.append(element.getUuid());
+    }
+    for (int i = 0; i < 200 * scale; ++i) {
+        library::Device element(createUuid(), version, author, createName(i),
+                                QString(), SyntheticData::getWords().at(i % 10));
+        element.setComponentUuid(components.at(i % components.count()));
+        element.setPackageUuid(packages.at(i % packages.count()));
+        element.saveIntoParentDirectory(lib.getElementsDirectory<library::Device>()); // can throw
+    }
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+QStringList SyntheticData::getWords() noexcept
+{
+    return QStringList() << "Resistor" << "Capacitor" << "Inductor" << "Diode"
+                         << "Transistor" << "Regulator" << "Amplifier" << "Connector"
+                         << "Crystal" << "Microcontroller";
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+QString SyntheticData::createName(int index) noexcept
+{
+    QStringList words = getWords();
+    return QString("%1 %2 %3").arg(words.at(index % words.count()))
+                              .arg(words.at(mRandom() % words.count()))
+                              .arg(index + 1);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace benchmarks
+} // namespace librepcb
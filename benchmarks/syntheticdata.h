@@ -0,0 +1,138 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_BENCHMARKS_SYNTHETICDATA_H
+#define LIBREPCB_BENCHMARKS_SYNTHETICDATA_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <random>
+#include <librepcb/common/uuid.h>
+#include <librepcb/common/units/all_length_units.h>
+#include <librepcb/common/fileio/sexpression.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class FilePath;
+
+namespace project {
+class Project;
+class Board;
+}
+
+namespace benchmarks {
+
+/*****************************************************************************************
+ *  Class SyntheticData
+ ****************************************************************************************/
+
+/**
+ * @brief The SyntheticData class generates reproducible data for benchmarks
+ *
+ * All generated data only depends on the seed passed to the constructor and on the
+ * scale factor passed to the generator methods, so consecutive benchmark runs (e.g. on
+ * different commits) always work with the same amount and structure of data. The size of
+ * the generated data grows linearly with the scale factor.
+ *
+ * @note The UUIDs of board items are generated by the board items themselves, so they
+ *       are random. All other values (positions, names, library UUIDs, ...) are
+ *       reproducible.
+ */
+class SyntheticData final
+{
+    public:
+
+        // Constructors / Destructor
+        SyntheticData() = delete;
+        SyntheticData(const SyntheticData& other) = delete;
+        explicit SyntheticData(quint32 seed = 42) noexcept;
+        ~SyntheticData() noexcept;
+
+        // General Methods
+        Uuid createUuid() noexcept;
+        Length createLength(const Length& min, const Length& max) noexcept;
+
+        /**
+         * @brief Create an S-Expression document similar to a board file
+         *
+         * @param scale     Size factor (1 = about 2.5 MB of text)
+         */
+        SExpression createSExpression(int scale) noexcept;
+
+        /**
+         * @brief Create a board and add it to a project
+         *
+         * The board contains a board outline, net segments with vias and traces on both
+         * copper layers, and two planes (top and bottom) which need to keep clearance to
+         * all items of other nets.
+         *
+         * @param project   The project to add the board to
+         * @param scale     Size factor (1 = 40 nets with 10 vias each)
+         *
+         * @return The created board (already added to the project)
+         *
+         * @throw Exception on error
+         */
+        project::Board& createBoard(project::Project& project, int scale);
+
+        /**
+         * @brief Create a library with symbols, packages, components and devices
+         *
+         * @param libDir    The directory of the library to create (must have the suffix
+         *                  ".lplib" and must not exist yet)
+         * @param scale     Size factor (1 = 400 library elements)
+         *
+         * @throw Exception on error
+         */
+        void createLibrary(const FilePath& libDir, int scale);
+
+        // Operator Overloadings
+        SyntheticData& operator=(const SyntheticData& rhs) = delete;
+
+        // Static Methods
+
+        /**
+         * @brief Get the words used for names and keywords of generated library elements
+         *
+         * Useful to search for generated library elements.
+         */
+        static QStringList getWords() noexcept;
+
+
+    private: // Methods
+        QString createName(int index) noexcept;
+
+
+    private: // Data
+        std::mt19937 mRandom; ///< produces the same sequence on all platforms
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace benchmarks
+} // namespace librepcb
+
+#endif // LIBREPCB_BENCHMARKS_SYNTHETICDATA_H
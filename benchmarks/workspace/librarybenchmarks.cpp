@@ -0,0 +1,127 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/application.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/workspace/workspace.h>
+#include <librepcb/workspace/library/workspacelibrarydb.h>
+#include "../benchmark.h"
+#include "../syntheticdata.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+using namespace workspace;
+
+/*****************************************************************************************
+ *  Benchmark Classes
+ ****************************************************************************************/
+
+/**
+ * @brief Base class for benchmarks which need a workspace with a synthetic library
+ */
+class LibraryBenchmarkBase : public Benchmark
+{
+    public:
+        void setUp(int scale) override {
+            mTmpDir = FilePath::getRandomTempPath();
+            FilePath wsDir = mTmpDir.getPathTo("workspace");
+            Workspace::createNewWorkspace(wsDir); // can throw
+            FilePath libDir = wsDir.getPathTo("v" % qApp->getFileFormatVersion().toStr())
+                              .getPathTo("libraries/local/Synthetic.lplib");
+            SyntheticData().createLibrary(libDir, scale); // can throw
+            mWorkspace.reset(new Workspace(wsDir)); // can throw
+        }
+        void tearDown() noexcept override {
+            mWorkspace.reset();
+            try {
+                FileUtils::removeDirRecursively(mTmpDir);
+            } catch (const Exception& e) {
+                qWarning() << "Could not remove temporary directory:" << e.getMsg();
+            }
+        }
+
+    protected:
+        void scanLibraries() {
+            // the scan runs in a worker thread, so wait until it is finished
+            QString error;
+            QEventLoop loop;
+            WorkspaceLibraryDb& db = mWorkspace->getLibraryDb();
+            QObject::connect(&db, &WorkspaceLibraryDb::scanSucceeded, &loop, &QEventLoop::quit);
+            QObject::connect(&db, &WorkspaceLibraryDb::scanFailed, &loop,
+                             [&loop, &error](const QString& msg){error = msg; loop.quit();});
+            db.startLibraryRescan();
+            loop.exec();
+            if (!error.isEmpty()) {
+                throw RuntimeError(__FILE__, __LINE__, error);
+            }
+        }
+
+        QScopedPointer<Workspace> mWorkspace;
+
+    private:
+        FilePath mTmpDir;
+};
+
+/**
+ * @brief Scan all workspace libraries and fill the library database
+ */
+class LibraryScanBenchmark final : public LibraryBenchmarkBase
+{
+    public:
+        void runIteration() override {
+            scanLibraries(); // can throw
+        }
+};
+LIBREPCB_REGISTER_BENCHMARK(LibraryScanBenchmark, "library/scan")
+
+/**
+ * @brief Search components by keywords in the library database
+ */
+class LibrarySearchBenchmark final : public LibraryBenchmarkBase
+{
+    public:
+        void setUp(int scale) override {
+            LibraryBenchmarkBase::setUp(scale); // can throw
+            scanLibraries(); // can throw
+        }
+        void runIteration() override {
+            const WorkspaceLibraryDb& db = mWorkspace->getLibraryDb();
+            foreach (const QString& keyword, SyntheticData::getWords()) {
+                foreach (const Uuid& uuid, db.getComponentsBySearchKeyword(keyword)) {
+                    db.getLatestComponent(uuid); // can throw
+                }
+            }
+        }
+};
+LIBREPCB_REGISTER_BENCHMARK(LibrarySearchBenchmark, "library/search")
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace benchmarks
+} // namespace librepcb
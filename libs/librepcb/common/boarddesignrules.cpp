@@ -90,6 +90,13 @@ BoardDesignRules::BoardDesignRules(const SExpression& node) :
     if (const SExpression* e = node.tryGetChildByPath("restring_via_max")) {
         mRestringViaMax = e->getValueOfFirstChild<Length>(true);
     }
+    // clearance
+    if (const SExpression* e = node.tryGetChildByPath("clearance_copper_copper")) {
+        mCopperClearance = e->getValueOfFirstChild<Length>(true);
+    }
+    if (const SExpression* e = node.tryGetChildByPath("clearance_copper_board")) {
+        mCopperBoardClearance = e->getValueOfFirstChild<Length>(true);
+    }
 }
 
 BoardDesignRules::~BoardDesignRules() noexcept
@@ -121,6 +128,9 @@ void BoardDesignRules::restoreDefaults() noexcept
     mRestringViaRatio = Ratio(250000);              // 25%
     mRestringViaMin = Length(200000);               // 0.2mm
     mRestringViaMax = Length(2000000);              // 2.0mm
+    // clearance
+    mCopperClearance = Length(200000);              // 0.2mm
+    mCopperBoardClearance = Length(300000);         // 0.3mm
 }
 
 void BoardDesignRules::serialize(SExpression& root) const
@@ -146,6 +156,9 @@ void BoardDesignRules::serialize(SExpression& root) const
     root.appendTokenChild("restring_via_ratio",                  mRestringViaRatio, true);
     root.appendTokenChild("restring_via_min",                    mRestringViaMin, true);
     root.appendTokenChild("restring_via_max",                    mRestringViaMax, true);
+    // clearance
+    root.appendTokenChild("clearance_copper_copper",             mCopperClearance, true);
+    root.appendTokenChild("clearance_copper_board",              mCopperBoardClearance, true);
 }
 
 /*****************************************************************************************
@@ -210,6 +223,9 @@ BoardDesignRules& BoardDesignRules::operator=(const BoardDesignRules& rhs) noexc
     mRestringViaRatio               = rhs.mRestringViaRatio;
     mRestringViaMin                 = rhs.mRestringViaMin;
     mRestringViaMax                 = rhs.mRestringViaMax;
+    // clearance
+    mCopperClearance                = rhs.mCopperClearance;
+    mCopperBoardClearance           = rhs.mCopperBoardClearance;
     return *this;
 }
 
@@ -237,6 +253,9 @@ bool BoardDesignRules::checkAttributesValidity() const noexcept
     if (mRestringViaRatio < 0)                              return false;
     if (mRestringViaMin < 0)                                return false;
     if (mRestringViaMax < mRestringViaMin)                  return false;
+    // clearance
+    if (mCopperClearance < 0)                               return false;
+    if (mCopperBoardClearance < 0)                          return false;
     return true;
 }
 
@@ -78,6 +78,10 @@ class BoardDesignRules final : public SerializableObject
         const Length& getRestringViaMin() const noexcept {return mRestringViaMin;}
         const Length& getRestringViaMax() const noexcept {return mRestringViaMax;}
 
+        // Getters: Clearance
+        const Length& getCopperClearance() const noexcept {return mCopperClearance;}
+        const Length& getCopperBoardClearance() const noexcept {return mCopperBoardClearance;}
+
 
         // Setters: General Attributes
         void setName(const QString& name) noexcept {if (!name.isEmpty()) mName = name;}
@@ -102,6 +106,10 @@ class BoardDesignRules final : public SerializableObject
         void setRestringViaMin(const Length& min) noexcept {if (min >= 0) mRestringViaMin = min;}
         void setRestringViaMax(const Length& max) noexcept {if (max >= 0) mRestringViaMax = max;}
 
+        // Setters: Clearance
+        void setCopperClearance(const Length& clr) noexcept {if (clr >= 0) mCopperClearance = clr;}
+        void setCopperBoardClearance(const Length& clr) noexcept {if (clr >= 0) mCopperBoardClearance = clr;}
+
         // General Methods
         void restoreDefaults() noexcept;
 
@@ -145,6 +153,10 @@ class BoardDesignRules final : public SerializableObject
         Ratio mRestringViaRatio;
         Length mRestringViaMin;
         Length mRestringViaMax;
+
+        // Clearance
+        Length mCopperClearance;        ///< between copper objects of different nets
+        Length mCopperBoardClearance;   ///< between copper and board outline or NPTH
 };
 
 /*****************************************************************************************
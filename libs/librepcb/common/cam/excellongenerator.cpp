@@ -21,6 +21,7 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QtConcurrent/QtConcurrent>
 #include "excellongenerator.h"
 #include "../fileio/smarttextfile.h"
 #include "../application.h"
@@ -35,7 +36,7 @@ namespace librepcb {
  ****************************************************************************************/
 
 ExcellonGenerator::ExcellonGenerator() noexcept :
-    mOutput()
+    mOutput(), mOptimizeDrillOrder(false)
 {
 }
 
@@ -49,7 +50,7 @@ ExcellonGenerator::~ExcellonGenerator() noexcept
 
 void ExcellonGenerator::drill(const Point& pos, const Length& dia) noexcept
 {
-    mDrillList.insert(dia, pos);
+    mDrillList[dia].append(pos);
 }
 
 void ExcellonGenerator::generate()
@@ -98,21 +99,26 @@ void ExcellonGenerator::printHeader() noexcept
 
 void ExcellonGenerator::printToolList() noexcept
 {
-    for (int i = 0; i < mDrillList.uniqueKeys().count(); ++i) {
-        Length dia = mDrillList.uniqueKeys().value(i);
-        mOutput.append(QString("T%1C%2\n").arg(i+1).arg(dia.toMmString()));
+    int tool = 1;
+    for (auto it = mDrillList.constBegin(); it != mDrillList.constEnd(); ++it) {
+        mOutput.append(QString("T%1C%2\n").arg(tool++).arg(it.key().toMmString()));
     }
 }
 
 void ExcellonGenerator::printDrills() noexcept
 {
-    for (int i = 0; i < mDrillList.uniqueKeys().count(); ++i) {
+    // sorting and formatting the hits is the expensive part, so it's done for all tools
+    // in parallel (the order of the tools in the output is still deterministic)
+    QList<QFuture<QString>> futures;
+    bool optimize = mOptimizeDrillOrder;
+    foreach (const QVector<Point>& positions, mDrillList) {
+        futures.append(QtConcurrent::run([positions, optimize](){
+            return formatDrills(optimize ? optimizeDrillOrder(positions) : positions);
+        }));
+    }
+    for (int i = 0; i < futures.count(); ++i) {
         mOutput.append(QString("T%1\n").arg(i+1)); // Select Tool
-        Length dia = mDrillList.uniqueKeys().value(i);
-        foreach (const Point& pos, mDrillList.values(dia)) {
-            mOutput.append(QString("X%1Y%2\n").arg(pos.getX().toMmString(),
-                                                   pos.getY().toMmString()));
-        }
+        mOutput.append(futures[i].result());
     }
 }
 
@@ -122,6 +128,142 @@ void ExcellonGenerator::printFooter() noexcept
     mOutput.append("M30\n");        // End of Program Rewind
 }
 
+QString ExcellonGenerator::formatDrills(const QVector<Point>& positions) noexcept
+{
+    QString output;
+    output.reserve(positions.count() * 24); // avoid reallocations, ~24 chars per line
+    foreach (const Point& pos, positions) {
+        output.append(QString("X%1Y%2\n").arg(pos.getX().toMmString(),
+                                              pos.getY().toMmString()));
+    }
+    return output;
+}
+
+/**
+ * The tour starts at the hit closest to the origin and is built with the nearest
+ * neighbour heuristic, using a uniform grid to find the next hit without scanning all
+ * of them. Afterwards, 2-opt moves (reversing a part of the tour) are applied as long as
+ * they shorten the tour. To keep the runtime linear for boards with many thousands of
+ * vias, only moves between hits which are at most sTwoOptWindow positions apart in the
+ * tour are considered.
+ */
+QVector<Point> ExcellonGenerator::optimizeDrillOrder(const QVector<Point>& positions) noexcept
+{
+    static const int sTwoOptWindow = 64;
+    static const int sTwoOptMaxPasses = 8;
+
+    int count = positions.count();
+    if (count < 3) {
+        return positions;
+    }
+
+    // use floating point coordinates in millimeters to avoid integer overflows
+    QVector<QPointF> points;
+    points.reserve(count);
+    foreach (const Point& pos, positions) {
+        points.append(QPointF(pos.getX().toMm(), pos.getY().toMm()));
+    }
+    qreal minX = points.first().x(), maxX = minX, minY = points.first().y(), maxY = minY;
+    foreach (const QPointF& p, points) {
+        minX = qMin(minX, p.x()); maxX = qMax(maxX, p.x());
+        minY = qMin(minY, p.y()); maxY = qMax(maxY, p.y());
+    }
+    auto distance = [&points](int a, int b) {
+        return qSqrt(qPow(points[a].x() - points[b].x(), 2) +
+                     qPow(points[a].y() - points[b].y(), 2));
+    };
+
+    // sort all hits into a grid with roughly one hit per cell
+    qreal width = maxX - minX, height = maxY - minY;
+    qreal cellSize = qMax(qSqrt((width * height) / count), qMax(width, height) / count);
+    cellSize = qMax(cellSize, qreal(0.001));
+    int cols = qFloor(width / cellSize) + 1;
+    int rows = qFloor(height / cellSize) + 1;
+    QVector<QVector<int>> cells(cols * rows);
+    QVector<int> cellOfPoint(count);
+    for (int i = 0; i < count; ++i) {
+        int col = qFloor((points[i].x() - minX) / cellSize);
+        int row = qFloor((points[i].y() - minY) / cellSize);
+        cellOfPoint[i] = qBound(0, row, rows - 1) * cols + qBound(0, col, cols - 1);
+        cells[cellOfPoint[i]].append(i);
+    }
+
+    // nearest neighbour tour, starting at the hit closest to the origin
+    QVector<int> order;
+    order.reserve(count);
+    int current = 0;
+    for (int i = 1; i < count; ++i) {
+        if (points[i].manhattanLength() < points[current].manhattanLength()) {
+            current = i;
+        }
+    }
+    while (true) {
+        order.append(current);
+        QVector<int>& cell = cells[cellOfPoint[current]];
+        cell.remove(cell.indexOf(current)); // QVector::removeOne() requires Qt>=5.4
+        if (order.count() == count) {
+            break;
+        }
+        int col = cellOfPoint[current] % cols;
+        int row = cellOfPoint[current] / cols;
+        int nearest = -1;
+        qreal nearestDistance = 0;
+        for (int ring = 0; ring < qMax(cols, rows); ++ring) {
+            // The rings 0..(ring-1) are already searched. Since the current hit may lie
+            // anywhere within its cell, all remaining hits are at least
+            // ((ring - 1) * cellSize) away.
+            if ((nearest >= 0) && (nearestDistance <= (ring - 1) * cellSize)) {
+                break;
+            }
+            for (int r = row - ring; r <= row + ring; ++r) {
+                if ((r < 0) || (r >= rows)) continue;
+                for (int c = col - ring; c <= col + ring; ++c) {
+                    if ((c < 0) || (c >= cols)) continue;
+                    if ((qAbs(r - row) != ring) && (qAbs(c - col) != ring)) continue;
+                    foreach (int candidate, cells[r * cols + c]) {
+                        qreal d = distance(current, candidate);
+                        if ((nearest < 0) || (d < nearestDistance)) {
+                            nearest = candidate;
+                            nearestDistance = d;
+                        }
+                    }
+                }
+            }
+        }
+        Q_ASSERT(nearest >= 0);
+        current = nearest;
+    }
+
+    // improve the tour with 2-opt moves: reversing the part order[i+1..j] replaces the
+    // edges (i, i+1) and (j, j+1) by the edges (i, j) and (i+1, j+1)
+    bool improved = true;
+    for (int pass = 0; improved && (pass < sTwoOptMaxPasses); ++pass) {
+        improved = false;
+        for (int i = 0; i < count - 2; ++i) {
+            int last = qMin(count - 1, i + sTwoOptWindow);
+            for (int j = i + 2; j <= last; ++j) {
+                qreal oldLength = distance(order[i], order[i+1]);
+                qreal newLength = distance(order[i], order[j]);
+                if (j < count - 1) {
+                    oldLength += distance(order[j], order[j+1]);
+                    newLength += distance(order[i+1], order[j+1]);
+                }
+                if (newLength < oldLength - 1e-9) {
+                    std::reverse(order.begin() + i + 1, order.begin() + j + 1);
+                    improved = true;
+                }
+            }
+        }
+    }
+
+    QVector<Point> result;
+    result.reserve(count);
+    foreach (int index, order) {
+        result.append(positions[index]);
+    }
+    return result;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
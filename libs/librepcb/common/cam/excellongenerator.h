@@ -58,6 +58,19 @@ class ExcellonGenerator final
         // Getters
         const QString& toStr() const noexcept {return mOutput;}
 
+        // Setters
+
+        /**
+         * @brief Enable or disable the optimization of the drill order (default: disabled)
+         *
+         * If enabled, the hits of each tool are sorted to keep the travel distance of
+         * the drilling machine short (nearest neighbour tour, improved by 2-opt moves).
+         * Otherwise they are written in the order they were added with #drill().
+         *
+         * @param optimize  Whether the drill order should be optimized or not
+         */
+        void setOptimizeDrillOrder(bool optimize) noexcept {mOptimizeDrillOrder = optimize;}
+
         // General Methods
         void drill(const Point& pos, const Length& dia) noexcept;
         void generate();
@@ -74,11 +87,14 @@ class ExcellonGenerator final
         void printToolList() noexcept;
         void printDrills() noexcept;
         void printFooter() noexcept;
+        static QString formatDrills(const QVector<Point>& positions) noexcept;
+        static QVector<Point> optimizeDrillOrder(const QVector<Point>& positions) noexcept;
 
 
         // Excellon Data
         QString mOutput;
-        QMultiMap<Length, Point> mDrillList;
+        QMap<Length, QVector<Point>> mDrillList;
+        bool mOptimizeDrillOrder;
 };
 
 /*****************************************************************************************
@@ -58,6 +58,7 @@ SOURCES += \
     exceptions.cpp \
     fileio/directorylock.cpp \
     fileio/filepath.cpp \
+    fileio/filesavetransaction.cpp \
     fileio/fileutils.cpp \
     fileio/sexpression.cpp \
     fileio/smartfile.cpp \
@@ -159,6 +160,7 @@ HEADERS += \
     fileio/cmd/cmdlistelementsswap.h \
     fileio/directorylock.h \
     fileio/filepath.h \
+    fileio/filesavetransaction.h \
     fileio/fileutils.h \
     fileio/serializablekeyvaluemap.h \
     fileio/serializableobject.h \
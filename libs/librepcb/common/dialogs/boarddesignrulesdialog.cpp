@@ -96,6 +96,9 @@ void BoardDesignRulesDialog::updateWidgets() noexcept
     mUi->spbxRestringViasRatio->setValue(mDesignRules.getRestringViaRatio().toPercent());
     mUi->spbxRestringViasMin->setValue(mDesignRules.getRestringViaMin().toMm());
     mUi->spbxRestringViasMax->setValue(mDesignRules.getRestringViaMax().toMm());
+    // clearance
+    mUi->spbxCopperClearance->setValue(mDesignRules.getCopperClearance().toMm());
+    mUi->spbxCopperBoardClearance->setValue(mDesignRules.getCopperBoardClearance().toMm());
 }
 
 void BoardDesignRulesDialog::applyRules() noexcept
@@ -119,6 +122,9 @@ void BoardDesignRulesDialog::applyRules() noexcept
     mDesignRules.setRestringViaRatio(Ratio::fromPercent(mUi->spbxRestringViasRatio->value()));
     mDesignRules.setRestringViaMin(Length::fromMm(mUi->spbxRestringViasMin->value()));
     mDesignRules.setRestringViaMax(Length::fromMm(mUi->spbxRestringViasMax->value()));
+    // clearance
+    mDesignRules.setCopperClearance(Length::fromMm(mUi->spbxCopperClearance->value()));
+    mDesignRules.setCopperBoardClearance(Length::fromMm(mUi->spbxCopperBoardClearance->value()));
 }
 
 /*****************************************************************************************
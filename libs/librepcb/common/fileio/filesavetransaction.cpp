@@ -0,0 +1,307 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "filesavetransaction.h"
+#include "fileutils.h"
+#include "../uuid.h"
+
+#if defined(Q_OS_UNIX) // UNIX/Linux/Mac OS X
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/types.h>
+#elif defined(Q_OS_WIN32) || defined(Q_OS_WIN64) // Windows
+#include <io.h>
+#include <windows.h>
+#else
+#error "Unknown operating system!"
+#endif
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+QThreadStorage<QList<FileSaveTransaction*>> FileSaveTransaction::sCurrentTransactions;
+
+/*****************************************************************************************
+ *  Class FileSaveTransaction::Scope
+ ****************************************************************************************/
+
+FileSaveTransaction::Scope::Scope(FileSaveTransaction& transaction) noexcept
+{
+    sCurrentTransactions.localData().append(&transaction);
+}
+
+FileSaveTransaction::Scope::Scope(std::nullptr_t) noexcept
+{
+    sCurrentTransactions.localData().append(nullptr); // see getCurrent()
+}
+
+FileSaveTransaction::Scope::~Scope() noexcept
+{
+    sCurrentTransactions.localData().removeLast();
+}
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+FileSaveTransaction::FileSaveTransaction() noexcept :
+    mCommitted(false)
+{
+}
+
+FileSaveTransaction::~FileSaveTransaction() noexcept
+{
+    if (!mCommitted) {
+        rollback();
+    }
+}
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+bool FileSaveTransaction::isEmpty() const noexcept
+{
+    QMutexLocker locker(&mMutex);
+    return mTmpFiles.isEmpty() && mRemovedFiles.isEmpty();
+}
+
+bool FileSaveTransaction::isCommitted() const noexcept
+{
+    QMutexLocker locker(&mMutex);
+    return mCommitted;
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void FileSaveTransaction::writeFile(const FilePath& filepath, const QByteArray& content)
+{
+    FileUtils::makePath(filepath.getParentDir()); // can throw
+
+    // write the content to a new temporary file in the same directory (renaming is only
+    // atomic within the same filesystem)
+    FilePath tmpFilePath(QString("%1.tmp-%2").arg(filepath.toStr(),
+                                                  Uuid::createRandom().toStr().left(8)));
+    QFile file(tmpFilePath.toStr());
+    if (!file.open(QIODevice::WriteOnly)) {
+        throw RuntimeError(__FILE__, __LINE__,
+            QString(tr("Could not open or create file \"%1\": %2"))
+            .arg(tmpFilePath.toNative(), file.errorString()));
+    }
+    qint64 written = file.write(content);
+    file.close(); // flushes the buffer
+    if ((written != content.size()) || (file.error() != QFileDevice::NoError)) {
+        QString msg = QString(tr("Could not write to file \"%1\": %2"))
+                      .arg(tmpFilePath.toNative(), file.errorString());
+        file.remove();
+        throw RuntimeError(__FILE__, __LINE__, msg);
+    }
+    if (filepath.isExistingFile()) {
+        // keep the permissions of the file to overwrite (like QSaveFile does)
+        file.setPermissions(QFile::permissions(filepath.toStr()));
+    }
+
+    QMutexLocker locker(&mMutex);
+    if (mCommitted) {
+        file.remove();
+        throw LogicError(__FILE__, __LINE__,
+            tr("Cannot write files into an already committed transaction."));
+    }
+    FilePath previousTmpFilePath = mTmpFiles.value(filepath);
+    if (previousTmpFilePath.isValid()) {
+        QFile::remove(previousTmpFilePath.toStr()); // the file was written again
+    }
+    mTmpFiles.insert(filepath, tmpFilePath);
+    mRemovedFiles.remove(filepath);
+}
+
+void FileSaveTransaction::removeFile(const FilePath& filepath) noexcept
+{
+    QMutexLocker locker(&mMutex);
+    FilePath tmpFilePath = mTmpFiles.take(filepath);
+    if (tmpFilePath.isValid()) {
+        QFile::remove(tmpFilePath.toStr()); // the file was written before
+    }
+    mRemovedFiles.insert(filepath);
+}
+
+void FileSaveTransaction::addRollbackHandler(const std::function<void()>& callback) noexcept
+{
+    QMutexLocker locker(&mMutex);
+    mRollbackHandlers.append(callback);
+}
+
+void FileSaveTransaction::addCommitHandler(const std::function<void()>& callback) noexcept
+{
+    QMutexLocker locker(&mMutex);
+    mCommitHandlers.append(callback);
+}
+
+void FileSaveTransaction::commit()
+{
+    QMutexLocker locker(&mMutex);
+    if (mCommitted) {
+        throw LogicError(__FILE__, __LINE__, tr("The transaction is already committed."));
+    }
+
+    try {
+        // first make sure all new contents are on the disk, then replace the files
+        syncFilesToDisk(mTmpFiles.values()); // can throw
+        QSet<FilePath> directories;
+        for (auto it = mTmpFiles.begin(); it != mTmpFiles.end(); it = mTmpFiles.erase(it)) {
+            renameFile(it.value(), it.key()); // can throw
+            directories.insert(it.key().getParentDir());
+        }
+        for (auto it = mRemovedFiles.begin(); it != mRemovedFiles.end();
+             it = mRemovedFiles.erase(it)) {
+            // Note: FileUtils::removeFile() would remove it within this transaction again
+            if (it->isExistingFile() && (!QFile::remove(it->toStr()))) {
+                throw RuntimeError(__FILE__, __LINE__,
+                    QString(tr("Could not remove file \"%1\".")).arg(it->toNative()));
+            }
+            directories.insert(it->getParentDir());
+        }
+        // persist the renames and removals (the directory entries) as well
+        foreach (const FilePath& dir, directories) {
+            syncDirectory(dir);
+        }
+    } catch (...) {
+        locker.unlock();
+        rollback();
+        throw;
+    }
+
+    QList<std::function<void()>> handlers = mCommitHandlers;
+    mRollbackHandlers.clear();
+    mCommitHandlers.clear();
+    mCommitted = true;
+    locker.unlock();
+    foreach (const std::function<void()>& handler, handlers) {
+        handler();
+    }
+}
+
+void FileSaveTransaction::rollback() noexcept
+{
+    QList<std::function<void()>> handlers;
+    {
+        QMutexLocker locker(&mMutex);
+        foreach (const FilePath& tmpFilePath, mTmpFiles) {
+            if (!QFile::remove(tmpFilePath.toStr())) {
+                qWarning() << "Could not remove temporary file:" << tmpFilePath.toNative();
+            }
+        }
+        mTmpFiles.clear();
+        mRemovedFiles.clear();
+        handlers = mRollbackHandlers;
+        mRollbackHandlers.clear();
+        mCommitHandlers.clear();
+    }
+    foreach (const std::function<void()>& handler, handlers) {
+        handler();
+    }
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+FileSaveTransaction* FileSaveTransaction::getCurrent() noexcept
+{
+    if (!sCurrentTransactions.hasLocalData()) {
+        return nullptr;
+    }
+    const QList<FileSaveTransaction*>& transactions = sCurrentTransactions.localData();
+    return transactions.isEmpty() ? nullptr : transactions.last();
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void FileSaveTransaction::syncFilesToDisk(const QList<FilePath>& files)
+{
+    foreach (const FilePath& filepath, files) {
+        QFile file(filepath.toStr());
+        if (!file.open(QIODevice::ReadWrite)) {
+            throw RuntimeError(__FILE__, __LINE__,
+                QString(tr("Could not open file \"%1\": %2"))
+                .arg(filepath.toNative(), file.errorString()));
+        }
+#if defined(Q_OS_UNIX)
+        bool success = (::fsync(file.handle()) == 0);
+#else
+        bool success = (::_commit(file.handle()) == 0);
+#endif
+        if (!success) {
+            throw RuntimeError(__FILE__, __LINE__,
+                QString(tr("Could not write file \"%1\" to the disk: %2"))
+                .arg(filepath.toNative(), qt_error_string(errno)));
+        }
+    }
+}
+
+void FileSaveTransaction::renameFile(const FilePath& source, const FilePath& dest)
+{
+    // Note: QFile::rename() does not overwrite existing files, so the native functions
+    // are used to atomically replace the destination file.
+#if defined(Q_OS_UNIX)
+    bool success = (::rename(QFile::encodeName(source.toStr()).constData(),
+                             QFile::encodeName(dest.toStr()).constData()) == 0);
+    QString error = success ? QString() : qt_error_string(errno);
+#else
+    bool success = ::MoveFileExW(reinterpret_cast<const wchar_t*>(source.toNative().utf16()),
+                                 reinterpret_cast<const wchar_t*>(dest.toNative().utf16()),
+                                 MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+    QString error = success ? QString() : qt_error_string(-1);
+#endif
+    if (!success) {
+        throw RuntimeError(__FILE__, __LINE__,
+            QString(tr("Could not move \"%1\" to \"%2\": %3"))
+            .arg(source.toNative(), dest.toNative(), error));
+    }
+}
+
+void FileSaveTransaction::syncDirectory(const FilePath& dir) noexcept
+{
+#if defined(Q_OS_UNIX)
+    int fd = ::open(QFile::encodeName(dir.toStr()).constData(), O_RDONLY);
+    if (fd >= 0) {
+        ::fsync(fd);
+        ::close(fd);
+    }
+#else
+    Q_UNUSED(dir); // not needed thanks to MOVEFILE_WRITE_THROUGH
+#endif
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
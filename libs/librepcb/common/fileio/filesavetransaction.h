@@ -0,0 +1,218 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_FILESAVETRANSACTION_H
+#define LIBREPCB_FILESAVETRANSACTION_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <cstddef>
+#include <functional>
+#include "../exceptions.h"
+#include "filepath.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class FileSaveTransaction
+ ****************************************************************************************/
+
+/**
+ * @brief The FileSaveTransaction class writes a set of files crash-consistently
+ *
+ * Instead of overwriting the files one by one, all files are first written to temporary
+ * files next to the target files. Only #commit() flushes each of them to the disk, then
+ * atomically renames them to the target files and finally flushes the modified
+ * directories. So after a crash or power loss, each file contains either its old or its new
+ * content. If the transaction is destroyed without committing it, all temporary files
+ * are removed and the target files remain untouched.
+ *
+ * While a #Scope object exists, FileUtils::writeFile() and FileUtils::removeFile() write
+ * into the transaction instead of modifying the file immediately. This way, existing save
+ * methods (e.g. of librepcb::SmartFile) can be used within a transaction without changing
+ * them. Files can be written from multiple threads in parallel, each thread just needs
+ * its own #Scope object.
+ *
+ * @note    Only single files are covered. Other file system operations (e.g. copying or
+ *          moving whole directories) are still executed immediately, so code which mixes
+ *          them with writing files should suspend the transaction with a #Scope
+ *          constructed from `nullptr`. In addition, a
+ *          commit is not atomic across files: If it fails in the middle, the files
+ *          which were already moved keep their new content.
+ *
+ * Example:
+ * @code
+ * FileSaveTransaction transaction;
+ * {
+ *     FileSaveTransaction::Scope scope(transaction);
+ *     file1.save(true); // can throw
+ *     file2.save(true); // can throw
+ * }
+ * transaction.commit(); // can throw
+ * @endcode
+ */
+class FileSaveTransaction final
+{
+        Q_DECLARE_TR_FUNCTIONS(FileSaveTransaction)
+
+    public:
+
+        /**
+         * @brief Makes a transaction the current one of the calling thread
+         *
+         * @see FileSaveTransaction::getCurrent()
+         */
+        class Scope final
+        {
+            public:
+                Scope() = delete;
+                Scope(const Scope& other) = delete;
+                explicit Scope(FileSaveTransaction& transaction) noexcept;
+                /// Suspends the current transaction, i.e. files are written immediately
+                explicit Scope(std::nullptr_t) noexcept;
+                ~Scope() noexcept;
+                Scope& operator=(const Scope& rhs) = delete;
+        };
+
+        // Constructors / Destructor
+        FileSaveTransaction(const FileSaveTransaction& other) = delete;
+        FileSaveTransaction() noexcept;
+
+        /**
+         * @brief The destructor
+         *
+         * Rolls back the transaction if it was not committed.
+         */
+        ~FileSaveTransaction() noexcept;
+
+        // Getters
+        bool isEmpty() const noexcept;
+        bool isCommitted() const noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Write a file within this transaction (thread-safe)
+         *
+         * The content is written to a temporary file which will replace the file when
+         * committing the transaction. Parent directories are created immediately. If the
+         * same file is written multiple times, the last content wins.
+         *
+         * @param filepath      The file to (over)write
+         * @param content       The content to write
+         *
+         * @throws Exception    If an error occurs.
+         */
+        void writeFile(const FilePath& filepath, const QByteArray& content);
+
+        /**
+         * @brief Remove a file within this transaction (thread-safe)
+         *
+         * The file is removed after all written files were moved to their target paths
+         * when committing the transaction. A pending write of the same file is discarded.
+         *
+         * @param filepath      The file to remove (may or may not exist)
+         */
+        void removeFile(const FilePath& filepath) noexcept;
+
+        /**
+         * @brief Register a function to be called if the transaction is rolled back
+         *
+         * This allows objects to forget about state which they assumed to be written to
+         * the disk (thread-safe).
+         *
+         * @note The callback may be called after the registering object was destroyed,
+         *       so it must not capture raw pointers to objects with a shorter lifetime
+         *       than the transaction.
+         *
+         * @param callback      The function to call in #rollback().
+         */
+        void addRollbackHandler(const std::function<void()>& callback) noexcept;
+
+        /**
+         * @brief Register a function to be called after a successful #commit()
+         *
+         * The function is called in the thread calling #commit(). The same lifetime
+         * considerations as for #addRollbackHandler() apply.
+         *
+         * @param callback      The function to call in #commit().
+         */
+        void addCommitHandler(const std::function<void()>& callback) noexcept;
+
+        /**
+         * @brief Flush all written files to the disk and move them to their target paths
+         *
+         * @attention Must not be called while other threads are still writing files into
+         *            this transaction.
+         *
+         * @throws Exception    If an error occurs. Files which were already moved are
+         *                      not restored, all other temporary files are removed.
+         */
+        void commit();
+
+        /**
+         * @brief Discard all written files and removals
+         *
+         * The rollback handlers are called in the calling thread.
+         */
+        void rollback() noexcept;
+
+        // Operator Overloadings
+        FileSaveTransaction& operator=(const FileSaveTransaction& rhs) = delete;
+
+        // Static Methods
+
+        /**
+         * @brief Get the transaction of the innermost #Scope of the calling thread
+         *
+         * @return The current transaction or nullptr if there is none
+         */
+        static FileSaveTransaction* getCurrent() noexcept;
+
+
+    private: // Methods
+        void syncFilesToDisk(const QList<FilePath>& files);
+        static void renameFile(const FilePath& source, const FilePath& dest);
+        static void syncDirectory(const FilePath& dir) noexcept;
+
+
+    private: // Data
+        mutable QMutex mMutex;
+        QHash<FilePath, FilePath> mTmpFiles; ///< key: target file, value: temporary file
+        QSet<FilePath> mRemovedFiles;
+        QList<std::function<void()>> mRollbackHandlers;
+        QList<std::function<void()>> mCommitHandlers;
+        bool mCommitted;
+
+        /// stack of the transactions of all #Scope objects, per thread
+        static QThreadStorage<QList<FileSaveTransaction*>> sCurrentTransactions;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_FILESAVETRANSACTION_H
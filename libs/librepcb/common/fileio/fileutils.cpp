@@ -23,12 +23,64 @@
 #include <QtCore>
 #include "fileutils.h"
 #include "filepath.h"
+#include "filesavetransaction.h"
+#include <QtConcurrent/QtConcurrent>
+
+#if defined(Q_OS_LINUX)
+#include <fcntl.h>
+#include <unistd.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#endif
 
 /*****************************************************************************************
  *  Namespace
  ****************************************************************************************/
 namespace librepcb {
 
+/*****************************************************************************************
+ *  Local Helpers
+ ****************************************************************************************/
+
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 4, 0)) // QtConcurrent::run(QThreadPool*, ...) requires Qt>=5.4
+// copyDirRecursively() blocks until all files are copied, so it must not use the global
+// thread pool: if it was called from tasks of that pool, these tasks could occupy all of
+// its threads and then wait for copy jobs which never start
+Q_GLOBAL_STATIC(QThreadPool, sCopyThreadPool)
+#endif
+
+#if defined(Q_OS_LINUX)
+// let the kernel copy the file content without transferring it through user space,
+// returns false if not supported (e.g. by the kernel or the filesystem)
+static bool copyFileContentInKernel(int srcFd, int dstFd, qint64 size) noexcept
+{
+#ifdef FICLONE
+    // on copy-on-write filesystems (btrfs, xfs, ...), just share the data blocks
+    if (::ioctl(dstFd, FICLONE, srcFd) == 0) {
+        return true;
+    }
+#endif
+#ifdef SYS_copy_file_range
+    while (size > 0) {
+        ssize_t copied = ::syscall(SYS_copy_file_range, srcFd, nullptr, dstFd, nullptr,
+                                   static_cast<size_t>(size), 0u);
+        if (copied <= 0) {
+            return false;
+        }
+        size -= copied;
+    }
+    return true;
+#else
+    Q_UNUSED(srcFd);
+    Q_UNUSED(dstFd);
+    return size == 0;
+#endif
+}
+#endif
+
 /*****************************************************************************************
  *  Static Methods
  ****************************************************************************************/
@@ -50,6 +102,11 @@ QByteArray FileUtils::readFile(const FilePath& filepath)
 
 void FileUtils::writeFile(const FilePath& filepath, const QByteArray& content)
 {
+    if (FileSaveTransaction* transaction = FileSaveTransaction::getCurrent()) {
+        transaction->writeFile(filepath, content); // can throw
+        return;
+    }
+
     makePath(filepath.getParentDir()); // can throw
     QSaveFile file(filepath.toStr());
     if (!file.open(QIODevice::WriteOnly)) {
@@ -82,14 +139,11 @@ void FileUtils::copyFile(const FilePath& source, const FilePath& dest)
             QString(tr("The file or directory \"%1\" exists already."))
             .arg(dest.toNative()));
     }
-    if (!QFile::copy(source.toStr(), dest.toStr())) {
-        throw RuntimeError(__FILE__, __LINE__,
-            QString(tr("Could not copy file \"%1\" to \"%2\"."))
-            .arg(source.toNative(), dest.toNative()));
-    }
+    copyFileContent(source, dest); // can throw
 }
 
-void FileUtils::copyDirRecursively(const FilePath& source, const FilePath& dest)
+void FileUtils::copyDirRecursively(const FilePath& source, const FilePath& dest,
+                                   const CopyProgressCallback& progressCallback)
 {
     if (!source.isExistingDir()) {
         throw LogicError(__FILE__, __LINE__,
@@ -101,13 +155,64 @@ void FileUtils::copyDirRecursively(const FilePath& source, const FilePath& dest)
             QString(tr("The file or directory \"%1\" exists already."))
             .arg(dest.toNative()));
     }
+
+    // enumerate the whole tree first, so all directories can be created before copying
+    // the files in any order, and the total size is known for the progress
+    QStringList dirs;
+    QList<QPair<QString, qint64>> files;
+    collectDirectoryEntries(source, QString(), dirs, files);
+    qint64 totalBytes = 0;
+    for (int i = 0; i < files.count(); ++i) {
+        totalBytes += files.at(i).second;
+    }
+
     makePath(dest); // can throw
-    QDir sourceDir(source.toStr());
-    foreach (const QString& file, sourceDir.entryList(QDir::Files | QDir::Hidden)) {
-        copyFile(source.getPathTo(file), dest.getPathTo(file));
+    foreach (const QString& dir, dirs) {
+        makePath(dest.getPathTo(dir)); // can throw
     }
-    foreach (const QString& dir, sourceDir.entryList(QDir::AllDirs | QDir::NoDotAndDotDot)) {
-        copyDirRecursively(source.getPathTo(dir), dest.getPathTo(dir));
+
+    auto copyFile = [](const FilePath& sourceFile, const FilePath& destFile) -> QString {
+        try {
+            copyFileContent(sourceFile, destFile); // can throw
+        } catch (const Exception& e) {
+            return e.getMsg();
+        }
+        return QString();
+    };
+
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 4, 0)) // QtConcurrent::run(QThreadPool*, ...) requires Qt>=5.4
+    // copy the files in parallel (on a dedicated thread pool, see sCopyThreadPool), but
+    // report the progress in the calling thread
+    QList<QFuture<QString>> futures;
+    for (int i = 0; i < files.count(); ++i) {
+        FilePath sourceFile = source.getPathTo(files.at(i).first);
+        FilePath destFile = dest.getPathTo(files.at(i).first);
+        futures.append(QtConcurrent::run(sCopyThreadPool(),
+            [copyFile, sourceFile, destFile]() -> QString {
+                return copyFile(sourceFile, destFile);
+            }));
+    }
+#endif
+    QString error;
+    qint64 copiedBytes = 0;
+    for (int i = 0; i < files.count(); ++i) {
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 4, 0))
+        QString fileError = futures[i].result(); // blocks until finished
+#else
+        // copy the files one after another in the calling thread
+        QString fileError = copyFile(source.getPathTo(files.at(i).first),
+                                     dest.getPathTo(files.at(i).first));
+#endif
+        if (error.isEmpty()) {
+            error = fileError; // keep the first error, but wait for all files anyway
+        }
+        copiedBytes += files.at(i).second;
+        if (progressCallback) {
+            progressCallback(copiedBytes, totalBytes);
+        }
+    }
+    if (!error.isEmpty()) {
+        throw RuntimeError(__FILE__, __LINE__, error);
     }
 }
 
@@ -131,6 +236,11 @@ void FileUtils::move(const FilePath& source, const FilePath& dest)
 
 void FileUtils::removeFile(const FilePath& file)
 {
+    if (FileSaveTransaction* transaction = FileSaveTransaction::getCurrent()) {
+        transaction->removeFile(file);
+        return;
+    }
+
     if (!QFile::remove(file.toStr())) {
         throw RuntimeError(__FILE__, __LINE__,
             QString(tr("Could not remove file \"%1\".")).arg(file.toNative()));
@@ -173,6 +283,77 @@ QList<FilePath> FileUtils::getFilesInDirectory(const FilePath& dir, const QStrin
     return files;
 }
 
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void FileUtils::copyFileContent(const FilePath& source, const FilePath& dest)
+{
+#if defined(Q_OS_LINUX)
+    int srcFd = ::open(QFile::encodeName(source.toStr()).constData(), O_RDONLY | O_CLOEXEC);
+    if (srcFd >= 0) {
+        bool success = false;
+        struct stat srcStat;
+        if (::fstat(srcFd, &srcStat) == 0) {
+            QByteArray dstPath = QFile::encodeName(dest.toStr());
+            int dstFd = ::open(dstPath.constData(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC,
+                               srcStat.st_mode & 07777);
+            if (dstFd >= 0) {
+                success = copyFileContentInKernel(srcFd, dstFd, srcStat.st_size);
+                if (::close(dstFd) != 0) success = false;
+                if (!success) ::unlink(dstPath.constData()); // use the fallback below
+            }
+        }
+        ::close(srcFd);
+        if (success) return;
+    }
+#endif
+
+    // portable fallback: map the source file into memory and write it at once
+    QFile sourceFile(source.toStr());
+    if (!sourceFile.open(QIODevice::ReadOnly)) {
+        throw RuntimeError(__FILE__, __LINE__, QString(tr("Cannot "
+            "open file \"%1\": %2")).arg(source.toNative(), sourceFile.errorString()));
+    }
+    QFile destFile(dest.toStr());
+    if (!destFile.open(QIODevice::WriteOnly)) {
+        throw RuntimeError(__FILE__, __LINE__,
+            QString(tr("Could not open or create file \"%1\": %2"))
+            .arg(dest.toNative(), destFile.errorString()));
+    }
+    qint64 size = sourceFile.size();
+    uchar* data = (size > 0) ? sourceFile.map(0, size) : nullptr;
+    QByteArray content;
+    if (!data) {
+        content = sourceFile.readAll(); // mapping not possible, read it instead
+        size = content.size();
+    }
+    qint64 written = data ? destFile.write(reinterpret_cast<const char*>(data), size)
+                          : destFile.write(content);
+    destFile.close(); // flushes the buffer
+    if ((written != size) || (destFile.error() != QFileDevice::NoError)) {
+        destFile.remove();
+        throw RuntimeError(__FILE__, __LINE__,
+            QString(tr("Could not copy file \"%1\" to \"%2\"."))
+            .arg(source.toNative(), dest.toNative()));
+    }
+    destFile.setPermissions(sourceFile.permissions());
+}
+
+void FileUtils::collectDirectoryEntries(const FilePath& dir, const QString& prefix,
+                                        QStringList& dirs,
+                                        QList<QPair<QString, qint64>>& files) noexcept
+{
+    QDir qDir(dir.toStr());
+    foreach (const QFileInfo& info, qDir.entryInfoList(QDir::Files | QDir::Hidden)) {
+        files.append(qMakePair(QString(prefix % info.fileName()), info.size()));
+    }
+    foreach (const QString& subdir, qDir.entryList(QDir::AllDirs | QDir::NoDotAndDotDot)) {
+        dirs.append(QString(prefix % subdir));
+        collectDirectoryEntries(dir.getPathTo(subdir), prefix % subdir % '/', dirs, files);
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
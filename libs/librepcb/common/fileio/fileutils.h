@@ -24,6 +24,7 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <functional>
 #include "../exceptions.h"
 
 /*****************************************************************************************
@@ -49,6 +50,11 @@ class FileUtils final
 
     public:
 
+        // Types
+
+        /// Called with the number of bytes copied so far and the total number of bytes
+        typedef std::function<void(qint64 copiedBytes, qint64 totalBytes)> CopyProgressCallback;
+
         // Constructors / Destructor
         FileUtils() = delete;
         FileUtils(const FileUtils& other) = delete;
@@ -71,6 +77,10 @@ class FileUtils final
          * @brief Write the content of a QByteArray into a file
          *
          * If the file does not exist, it will be created (with all parent directories).
+         * The file is replaced atomically, i.e. it always contains either the old or the
+         * new content. If a librepcb::FileSaveTransaction is active in the calling thread
+         * (see librepcb::FileSaveTransaction::Scope), the file is written within that
+         * transaction, i.e. only when committing it.
          *
          * @param filepath      The file to (over)write
          * @param content       The content to write
@@ -93,13 +103,22 @@ class FileUtils final
         /**
          * @brief Copy a directory recursively
          *
-         * @param source        Filepath to an existing directory.
-         * @param dest          Filepath to a non-existing directory (if it exists
-         *                      already, an exception will be thrown).
+         * The directory tree is enumerated once, then the files are copied in parallel
+         * on a dedicated thread pool (not the global one, so this method can also be
+         * called from tasks running on the global thread pool). On Linux, the files are copied by the kernel
+         * (reflink or copy_file_range()) if the filesystem supports it.
+         *
+         * @param source            Filepath to an existing directory.
+         * @param dest              Filepath to a non-existing directory (if it exists
+         *                          already, an exception will be thrown).
+         * @param progressCallback  Optional callback to report the progress. It is
+         *                          called from the calling thread after each file.
          *
          * @throws Exception    If an error occurs.
          */
-        static void copyDirRecursively(const FilePath& source, const FilePath& dest);
+        static void copyDirRecursively(const FilePath& source, const FilePath& dest,
+                                       const CopyProgressCallback& progressCallback =
+                                       CopyProgressCallback());
 
         /**
          * @brief Move/rename a file or directory
@@ -115,6 +134,9 @@ class FileUtils final
         /**
          * @brief Remove a single file
          *
+         * If a librepcb::FileSaveTransaction is active in the calling thread, the file is
+         * removed within that transaction, i.e. only when committing it.
+         *
          * @param file          Filepath to a file (may or may not exist).
          *
          * @throws Exception    If an error occurs.
@@ -151,6 +173,13 @@ class FileUtils final
 
         // Operator Overloadings
         FileUtils& operator=(const FileUtils& rhs) = delete;
+
+
+    private:
+        static void copyFileContent(const FilePath& source, const FilePath& dest);
+        static void collectDirectoryEntries(const FilePath& dir, const QString& prefix,
+                                            QStringList& dirs,
+                                            QList<QPair<QString, qint64>>& files) noexcept;
 };
 
 } // namespace librepcb
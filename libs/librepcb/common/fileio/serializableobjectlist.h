@@ -48,6 +48,7 @@ namespace librepcb {
  * - Methods to find elements by UUID and/or name (if supported by template type `T`).
  * - Method #sortedByUuid() to create a copy of the list with elements sorted by UUID.
  * - Observer pattern to get notified about added and removed elements.
+ * - A lazily built hash index to find elements by UUID in constant time.
  * - Undo commands librepcb::CmdListElementInsert, librepcb::CmdListElementRemove and
  *   ibrepcb::CmdListElementsSwap.
  * - Const correctness: A const list always returns pointers/references to const elements.
@@ -74,6 +75,14 @@ namespace librepcb {
  * @warning Using Qt's `foreach` keyword on a #SerializableObjectList is not recommended
  *          because it always creates a deep copy of the list! You should use range based
  *          for loops (since C++11) instead.
+ *
+ * @note    For lists with more than a few elements, #indexOf(const Uuid&) uses a hash
+ *          index which is built on the first lookup and then kept up to date by all
+ *          methods which add, remove or move elements. The index relies on the UUIDs of
+ *          the elements not being changed while they are in the list (a found element is
+ *          still verified, but a UUID which is not in the index is reported as missing).
+ *          Names can be changed at any time, so #indexOf(const QString&) always searches
+ *          linearly.
  */
 template <typename T, typename P>
 class SerializableObjectList : public SerializableObject
@@ -105,7 +114,9 @@ class SerializableObjectList : public SerializableObject
                 std::shared_ptr<O> ptr() noexcept {return std::const_pointer_cast<O>(*it);}
                 ~Iterator() {}
         };
-        using iterator = Iterator<typename QVector<std::shared_ptr<T>>::iterator, T>;
+        // Note: Non-const iterators only give write access to the elements, not to the
+        // pointers in the list, since replacing them would bypass the UUID index.
+        using iterator = Iterator<typename QVector<std::shared_ptr<T>>::const_iterator, T>;
         using const_iterator = Iterator<typename QVector<std::shared_ptr<T>>::const_iterator, const T>;
 
         // Constructors / Destructor
@@ -155,6 +166,16 @@ class SerializableObjectList : public SerializableObject
             return -1;
         }
         int indexOf(const Uuid& key) const noexcept {
+            if ((!mUuidIndex.isBuilt.loadAcquire()) && (count() >= sMinCountForIndex)) {
+                buildUuidIndex();
+            }
+            if (mUuidIndex.isBuilt.loadAcquire()) {
+                int i = mUuidIndex.indices.value(key, -1);
+                if ((i < 0) || (mObjects[i]->getUuid() == key)) {
+                    return i;
+                }
+                Q_ASSERT(false); // the UUID of an element was modified
+            }
             for (int i = 0; i < count(); ++i) {if (mObjects[i]->getUuid() == key) {return i;}}
             return -1;
         }
@@ -185,9 +206,9 @@ class SerializableObjectList : public SerializableObject
 
         // "Hard" Element Access (assertion or exception if not found!)
         std::shared_ptr<const T> at(int index) const noexcept {return std::const_pointer_cast<const T>(mObjects.at(index));} // always read-only!
-        std::shared_ptr<T>& first() noexcept {return mObjects.first();}
+        const std::shared_ptr<T>& first() noexcept {return mObjects.first();}
         std::shared_ptr<const T> first() const noexcept {return mObjects.first();}
-        std::shared_ptr<T>& last() noexcept {return mObjects.last();}
+        const std::shared_ptr<T>& last() noexcept {return mObjects.last();}
         std::shared_ptr<const T> last() const noexcept {return mObjects.last();}
         std::shared_ptr<T> get(const Uuid& key) {
             std::shared_ptr<T> ptr = find(key);
@@ -215,8 +236,8 @@ class SerializableObjectList : public SerializableObject
         const_iterator end() const noexcept {return mObjects.end();}
         const_iterator cbegin() noexcept {return mObjects.cbegin();}
         const_iterator cend() noexcept {return mObjects.cend();}
-        iterator begin() noexcept {return mObjects.begin();}
-        iterator end() noexcept {return mObjects.end();}
+        iterator begin() noexcept {return mObjects.cbegin();}
+        iterator end() noexcept {return mObjects.cend();}
 
         // General Methods
         int loadFromDomElement(const SExpression& node) {
@@ -241,6 +262,7 @@ class SerializableObjectList : public SerializableObject
             Q_ASSERT(obj);
             qBound(0, index, count());
             mObjects.insert(index, obj);
+            updateUuidIndexAfterInsert(index);
             notifyObjectAdded(index, obj);
             return index;
         }
@@ -250,6 +272,7 @@ class SerializableObjectList : public SerializableObject
         std::shared_ptr<T> take(int index) noexcept {
             Q_ASSERT(contains(index));
             std::shared_ptr<T> obj = mObjects.takeAt(index);
+            updateUuidIndexAfterRemove(index, *obj);
             notifyObjectRemoved(index, obj);
             return std::move(obj);
         }
@@ -343,7 +366,60 @@ class SerializableObjectList : public SerializableObject
         }
 
 
+    protected: // Types
+        struct UuidIndex {
+            QAtomicInt isBuilt;         ///< Set after #indices was built
+            QHash<Uuid, int> indices;   ///< UUID -> index of the first element
+            Uuid (*getUuid)(const T&) = nullptr;    ///< Set by #buildUuidIndex()
+        };
+
+
     protected: // Methods
+        void buildUuidIndex() const noexcept {
+            // Only building the index needs to be synchronized since lookups are const
+            // methods which may be called from multiple threads. Once built, the index
+            // is only modified by non-const methods.
+            QMutexLocker locker(&mUuidIndexMutex);
+            if (mUuidIndex.isBuilt.loadAcquire()) return; // built by another thread
+            // Note: The function pointer allows insert() and take() to update the index
+            // without requiring the method getUuid() for every type T.
+            mUuidIndex.getUuid = [](const T& obj){return Uuid(obj.getUuid());};
+            for (int i = count() - 1; i >= 0; --i) {
+                mUuidIndex.indices.insert(mObjects[i]->getUuid(), i); // keep the first
+            }
+            mUuidIndex.isBuilt.storeRelease(1);
+        }
+        void updateUuidIndexAfterInsert(int index) noexcept {
+            if (!mUuidIndex.isBuilt.loadAcquire()) return;
+            if (index < count() - 1) { // nothing to shift when appending
+                for (auto it = mUuidIndex.indices.begin(); it != mUuidIndex.indices.end(); ++it) {
+                    if (it.value() >= index) ++it.value();
+                }
+            }
+            Uuid uuid = mUuidIndex.getUuid(*mObjects[index]);
+            if (mUuidIndex.indices.value(uuid, index) >= index) {
+                mUuidIndex.indices.insert(uuid, index);
+            }
+        }
+        void updateUuidIndexAfterRemove(int index, const T& obj) noexcept {
+            if (!mUuidIndex.isBuilt.loadAcquire()) return;
+            Uuid uuid = mUuidIndex.getUuid(obj);
+            bool wasFirst = (mUuidIndex.indices.value(uuid, -1) == index);
+            if (wasFirst) mUuidIndex.indices.remove(uuid);
+            if (index < count()) { // nothing to shift when removing the last element
+                for (auto it = mUuidIndex.indices.begin(); it != mUuidIndex.indices.end(); ++it) {
+                    if (it.value() > index) --it.value();
+                }
+            }
+            if (wasFirst) { // another element with the same UUID may follow
+                for (int i = index; i < count(); ++i) {
+                    if (mUuidIndex.getUuid(*mObjects[i]) == uuid) {
+                        mUuidIndex.indices.insert(uuid, i);
+                        break;
+                    }
+                }
+            }
+        }
         void notifyObjectAdded(int index, const std::shared_ptr<T>& obj) noexcept {
             foreach (IF_Observer* observer, mObservers) {
                 observer->listObjectAdded(*this, index, obj);
@@ -369,6 +445,11 @@ class SerializableObjectList : public SerializableObject
     protected: // Data
         QVector<std::shared_ptr<T>> mObjects;
         QList<IF_Observer*> mObservers;
+
+        // UUID lookup index (see class description)
+        static constexpr int sMinCountForIndex = 16;
+        mutable UuidIndex mUuidIndex;
+        mutable QMutex mUuidIndexMutex;
 };
 
 } // namespace librepcb
@@ -23,6 +23,7 @@
 #include <QtCore>
 #include "smartfile.h"
 #include "fileutils.h"
+#include "filesavetransaction.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -36,8 +37,10 @@ namespace librepcb {
 SmartFile::SmartFile(const FilePath& filepath, bool restore, bool readOnly, bool create) :
     mFilePath(filepath), mTmpFilePath(filepath.toStr() % '~'),
     mOpenedFilePath(filepath), mIsRestored(restore), mIsReadOnly(readOnly),
-    mIsCreated(create)
+    mIsCreated(create), mLifetimeGuard(std::make_shared<LifetimeGuard>())
 {
+    mLifetimeGuard->alive = true;
+
     if (create)
     {
         Q_ASSERT(mIsRestored == false);
@@ -68,6 +71,12 @@ SmartFile::SmartFile(const FilePath& filepath, bool restore, bool readOnly, bool
 
 SmartFile::~SmartFile() noexcept
 {
+    {
+        // wait for running transaction handlers and disable them
+        QMutexLocker locker(&mLifetimeGuard->mutex);
+        mLifetimeGuard->alive = false;
+    }
+
     // remove temporary file, if required
     if ((!mIsRestored) && (!mIsReadOnly) && (mTmpFilePath.isExistingFile())) {
         try {
@@ -89,6 +98,8 @@ void SmartFile::removeFile(bool original)
     }
 
     FilePath filepath(original ? mFilePath : mTmpFilePath);
+    QByteArray& hash = original ? mOriginalFileHash : mTmpFileHash;
+    hash.clear();
     if (filepath.isExistingFile()) {
         FileUtils::removeFile(filepath);
     }
@@ -109,6 +120,17 @@ const FilePath& SmartFile::prepareSaveAndReturnFilePath(bool toOriginal)
 
 void SmartFile::updateMembersAfterSaving(bool toOriginal) noexcept
 {
+    if (FileSaveTransaction* transaction = FileSaveTransaction::getCurrent()) {
+        // the file is not written before the transaction is committed
+        if (toOriginal && (mIsRestored || mIsCreated)) {
+            transaction->addCommitHandler(guardedCallback([this](){
+                mIsRestored = false;
+                mIsCreated = false;
+            }));
+        }
+        return;
+    }
+
     if (toOriginal && mIsRestored)
         mIsRestored = false;
 
@@ -116,6 +138,56 @@ void SmartFile::updateMembersAfterSaving(bool toOriginal) noexcept
         mIsCreated = false;
 }
 
+void SmartFile::saveContent(bool toOriginal, const QByteArray& content)
+{
+    const FilePath& filepath = prepareSaveAndReturnFilePath(toOriginal); // can throw
+    QByteArray& knownHash = toOriginal ? mOriginalFileHash : mTmpFileHash;
+    QByteArray hash = calcHash(content);
+    if ((hash != knownHash) || (!filepath.isExistingFile())) {
+        knownHash.clear(); // content is unknown if writing the file fails
+        FileUtils::writeFile(filepath, content); // can throw
+        knownHash = hash;
+        if (FileSaveTransaction* transaction = FileSaveTransaction::getCurrent()) {
+            // the file is written only when committing the transaction, so the content
+            // is unknown again if the transaction is rolled back
+            transaction->addRollbackHandler(guardedCallback([this, toOriginal](){
+                (toOriginal ? mOriginalFileHash : mTmpFileHash).clear();
+            }));
+        }
+    }
+    updateMembersAfterSaving(toOriginal);
+}
+
+void SmartFile::setOpenedFileContent(const QByteArray& content) noexcept
+{
+    if (mOpenedFilePath == mFilePath) {
+        mOriginalFileHash = calcHash(content);
+    } else {
+        mTmpFileHash = calcHash(content);
+    }
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+std::function<void()> SmartFile::guardedCallback(const std::function<void()>& callback) const noexcept
+{
+    std::shared_ptr<LifetimeGuard> guard = mLifetimeGuard;
+    return [guard, callback](){
+        QMutexLocker locker(&guard->mutex);
+        if (guard->alive) {
+            callback();
+        }
+    };
+}
+
+QByteArray SmartFile::calcHash(const QByteArray& content) noexcept
+{
+    // only used to detect changes, so a fast hash function is good enough
+    return QCryptographicHash::hash(content, QCryptographicHash::Md5);
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
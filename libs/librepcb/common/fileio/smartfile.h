@@ -24,6 +24,8 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <functional>
+#include <memory>
 #include "../exceptions.h"
 #include "filepath.h"
 
@@ -137,6 +139,18 @@ class SmartFile
          */
         void removeFile(bool original);
 
+        /**
+         * @brief Remember the content which was read from the opened file
+         *
+         * Subclasses which read the whole file content should call this method to avoid
+         * writing the file again if its content didn't change. If the file was read by
+         * another object (e.g. in a worker thread), the owner of this object should
+         * call this method instead.
+         *
+         * @param content       The content read from the file
+         */
+        void setOpenedFileContent(const QByteArray& content) noexcept;
+
 
         // Operator Overloadings
         SmartFile& operator=(const SmartFile& rhs) = delete;
@@ -176,6 +190,23 @@ class SmartFile
          */
         void updateMembersAfterSaving(bool toOriginal) noexcept;
 
+        /**
+         * @brief Write the content to the original or backup file, if it has changed
+         *
+         * This method calls #prepareSaveAndReturnFilePath() and
+         * #updateMembersAfterSaving(), so subclasses can use it instead of writing the
+         * file on their own. If the file already contains exactly the same content
+         * (because it was written or read by this object before), writing the file is
+         * skipped. So saving a big project writes only the files which have changed.
+         *
+         * @param toOriginal    Specifies whether the original or the backup file should
+         *                      be overwritten/created.
+         * @param content       The new content of the file
+         *
+         * @throw Exception If an error occurs
+         */
+        void saveContent(bool toOriginal, const QByteArray& content);
+
 
         // General Attributes
 
@@ -221,6 +252,45 @@ class SmartFile
          */
         bool mIsCreated;
 
+        /**
+         * @brief Hash of the content the original file is known to have, or empty if
+         *        unknown (see #saveContent())
+         */
+        QByteArray mOriginalFileHash;
+
+        /**
+         * @brief Hash of the content the backup file is known to have, or empty if
+         *        unknown (see #saveContent())
+         */
+        QByteArray mTmpFileHash;
+
+        /**
+         * @brief Allows handlers of librepcb::FileSaveTransaction to detect whether this
+         *        object still exists (see #guardedCallback())
+         */
+        struct LifetimeGuard {
+            QMutex mutex;   ///< Locked while a handler runs and while destroying
+            bool alive;
+        };
+        std::shared_ptr<LifetimeGuard> mLifetimeGuard;
+
+
+    private:
+
+        /**
+         * @brief Wrap a callback to call it only if this object still exists
+         *
+         * Used for handlers of librepcb::FileSaveTransaction, which may be called from
+         * another thread or after this object was destroyed. The destructor waits until
+         * a running callback has finished.
+         *
+         * @param callback      The function to wrap
+         *
+         * @return A function which calls the callback if this object still exists
+         */
+        std::function<void()> guardedCallback(const std::function<void()>& callback) const noexcept;
+
+        static QByteArray calcHash(const QByteArray& content) noexcept;
 };
 
 /*****************************************************************************************
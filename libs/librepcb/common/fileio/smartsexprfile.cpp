@@ -47,20 +47,22 @@ SmartSExprFile::~SmartSExprFile() noexcept
  *  General Methods
  ****************************************************************************************/
 
-SExpression SmartSExprFile::parseFileAndBuildDomTree() const
+SExpression SmartSExprFile::parseFileAndBuildDomTree(QByteArray* content)
 {
-    return SExpression::parse(FileUtils::readFile(mOpenedFilePath), mOpenedFilePath);
+    QByteArray fileContent = FileUtils::readFile(mOpenedFilePath); // can throw
+    SExpression root = SExpression::parse(fileContent, mOpenedFilePath); // can throw
+    setOpenedFileContent(fileContent);
+    if (content) *content = fileContent;
+    return root;
 }
 
 void SmartSExprFile::save(const SExpression& domDocument, bool toOriginal)
 {
-    FilePath filepath = prepareSaveAndReturnFilePath(toOriginal); // can throw
     QString content = domDocument.toString(0); // can throw
     if (!content.endsWith('\n')) {
         content.append('\n');
     }
-    FileUtils::writeFile(filepath, content.toUtf8()); // can throw
-    updateMembersAfterSaving(toOriginal);
+    saveContent(toOriginal, content.toUtf8()); // can throw
 }
 
 /*****************************************************************************************
@@ -87,10 +87,17 @@ class SmartSExprFile final : public SmartFile
         /**
          * @brief Open and parse the S-Expressions file and build the whole DOM tree
          *
+         * The file content is remembered, so #save() does not write the file again if
+         * the DOM tree was not modified.
+         *
+         * @param content   If not nullptr, the raw content of the file is returned too
+         *                  (e.g. to pass it to SmartFile#setOpenedFileContent() of
+         *                  another object which opens the same file)
+         *
          * @return  A pointer to the created DOM tree. The caller takes the ownership of
          *          the DOM document.
          */
-        SExpression parseFileAndBuildDomTree() const;
+        SExpression parseFileAndBuildDomTree(QByteArray* content = nullptr);
 
         /**
          * @brief Write the S-Expressions DOM tree to the file system
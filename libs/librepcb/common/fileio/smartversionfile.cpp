@@ -42,7 +42,9 @@ SmartVersionFile::SmartVersionFile(const FilePath& filepath, bool restore, bool
     }
     else {
         // read the content of the file
-        QString content = QString(FileUtils::readFile(mOpenedFilePath));
+        QByteArray fileContent = FileUtils::readFile(mOpenedFilePath);
+        setOpenedFileContent(fileContent);
+        QString content = QString(fileContent);
         QStringList lines = content.split("\n", QString::KeepEmptyParts);
         mVersion.setVersion((lines.count() > 0) ? lines.first() : QString());
         if (!mVersion.isValid()) {
@@ -64,9 +66,7 @@ SmartVersionFile::~SmartVersionFile() noexcept
 void SmartVersionFile::save(bool toOriginal)
 {
     if (mVersion.isValid()) {
-        const FilePath& filepath = prepareSaveAndReturnFilePath(toOriginal);
-        FileUtils::writeFile(filepath, QString("%1\n").arg(mVersion.toStr()).toUtf8());
-        updateMembersAfterSaving(toOriginal);
+        saveContent(toOriginal, QString("%1\n").arg(mVersion.toStr()).toUtf8()); // can throw
     } else {
         qDebug() << mVersion.toStr();
         throw LogicError(__FILE__, __LINE__, tr("Invalid version number"));
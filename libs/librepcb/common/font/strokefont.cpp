@@ -39,7 +39,8 @@ namespace fb = fontobene;
  ****************************************************************************************/
 
 StrokeFont::StrokeFont(const FilePath& fontFilePath) noexcept :
-    QObject(nullptr), mFilePath(fontFilePath)
+    QObject(nullptr), mFilePath(fontFilePath), mLoadedSignalEmitted(false),
+    mGlyphCache(50000), mTextCache(100000)
 {
     // load the font in another thread because it takes some time to load it
     qDebug() << "Start loading font" << mFilePath.toNative();
@@ -72,11 +73,98 @@ Ratio StrokeFont::getLineSpacing() const noexcept
  *  General Methods
  ****************************************************************************************/
 
+void StrokeFont::waitUntilLoaded() noexcept
+{
+    if (QThread::currentThread() != thread()) {
+        // the caches are not thread-safe and the texts connected to loaded() must be
+        // updated in their own thread, so leave that up to fontLoaded()
+        mFuture.waitForFinished();
+        return;
+    }
+
+    accessor(); // block until the font is loaded
+    if (!mLoadedSignalEmitted.loadAcquire()) {
+        mLoadedSignalEmitted.storeRelease(1);
+        emit loaded();
+    }
+}
+
 QVector<Path> StrokeFont::stroke(const QString& text, const Length& height,
     const Length& letterSpacing, const Length& lineSpacing, const Alignment& align,
     Point& bottomLeft, Point& topRight) const noexcept
 {
-    accessor(); // block until the font is loaded. TODO: abort instead of waiting?
+    TextCacheKey key{text, height, letterSpacing, lineSpacing, align};
+    if (const CachedText* cached = mTextCache.object(key)) {
+        bottomLeft = cached->bottomLeft;
+        topRight = cached->topRight;
+        return cached->paths;
+    }
+
+    CachedText* entry = new CachedText();
+    entry->paths = strokeUncached(text, height, letterSpacing, lineSpacing, align,
+                                  entry->bottomLeft, entry->topRight);
+    bottomLeft = entry->bottomLeft;
+    topRight = entry->topRight;
+    QVector<Path> paths = entry->paths;
+    mTextCache.insert(key, entry, qMax(paths.count(), 1)); // takes ownership
+    return paths;
+}
+
+QVector<QPair<QVector<Path>, Length>> StrokeFont::strokeLines(const QString& text,
+    const Length& height, const Length& letterSpacing, Length& width) const noexcept
+{
+    QVector<QPair<QVector<Path>, Length>> result;
+    foreach (const QString& line, text.split('\n')) {
+        QPair<QVector<Path>, Length> pair;
+        pair.first = strokeLine(line, height, letterSpacing, pair.second);
+        result.append(pair);
+        if (pair.second > width) width = pair.second;
+    }
+    return result;
+}
+
+QVector<Path> StrokeFont::strokeLine(const QString& text, const Length& height,
+    const Length& letterSpacing, Length& width) const noexcept
+{
+    QVector<Path> paths;
+    Length offset = 0;
+    width = 0; // same as offset, but without last letter spacing
+    for (int i = 0; i < text.length(); ++i) {
+        CachedGlyph glyph = getCachedGlyph(text.at(i), height);
+        if (!glyph.paths.isEmpty()) {
+            Length shift = (i == 0) ? -glyph.left : 0; // left-align first character
+            Point translation(offset + shift, Length(0));
+            foreach (const Path& p, glyph.paths) {
+                paths.append(p.translated(translation));
+            }
+            width = offset + glyph.right + shift; // do *not* count glyph spacing as width!
+            offset = width + glyph.spacing + letterSpacing;
+        } else if (glyph.spacing != 0) {
+            // it's a whitespace-only glyph -> count additional glyph spacing as width
+            width = offset + glyph.spacing;
+            offset = width + letterSpacing;
+        }
+    }
+    return paths;
+}
+
+QVector<Path> StrokeFont::strokeGlyph(const QChar& glyph, const Length& height,
+                                      Length& spacing) const noexcept
+{
+    CachedGlyph cached = getCachedGlyph(glyph, height);
+    spacing = cached.spacing;
+    return cached.paths;
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+QVector<Path> StrokeFont::strokeUncached(const QString& text, const Length& height,
+    const Length& letterSpacing, const Length& lineSpacing, const Alignment& align,
+    Point& bottomLeft, Point& topRight) const noexcept
+{
+    accessor(); // block until the font is loaded (use isLoaded() to avoid blocking)
     QVector<Path> paths;
     Length totalWidth;
     QVector<QPair<QVector<Path>, Length>> lines = strokeLines(text, height, letterSpacing,
@@ -128,69 +216,38 @@ QVector<Path> StrokeFont::stroke(const QString& text, const Length& height,
     return paths;
 }
 
-QVector<QPair<QVector<Path>, Length>> StrokeFont::strokeLines(const QString& text,
-    const Length& height, const Length& letterSpacing, Length& width) const noexcept
+StrokeFont::CachedGlyph StrokeFont::getCachedGlyph(const QChar& glyph,
+                                                   const Length& height) const noexcept
 {
-    QVector<QPair<QVector<Path>, Length>> result;
-    foreach (const QString& line, text.split('\n')) {
-        QPair<QVector<Path>, Length> pair;
-        pair.first = strokeLine(line, height, letterSpacing, pair.second);
-        result.append(pair);
-        if (pair.second > width) width = pair.second;
+    QPair<ushort, qint64> key(glyph.unicode(), height.toNm());
+    if (const CachedGlyph* cached = mGlyphCache.object(key)) {
+        return *cached;
     }
-    return result;
-}
 
-QVector<Path> StrokeFont::strokeLine(const QString& text, const Length& height,
-    const Length& letterSpacing, Length& width) const noexcept
-{
-    QVector<Path> paths;
-    Length offset = 0;
-    width = 0; // same as offset, but without last letter spacing
-    for (int i = 0; i < text.length(); ++i) {
-        Length glyphSpacing;
-        QVector<Path> glyphPaths = strokeGlyph(text.at(i), height, glyphSpacing);
-        if (!glyphPaths.isEmpty()) {
-            Point bottomLeft, topRight;
-            computeBoundingRect(glyphPaths, bottomLeft, topRight);
-            Length shift = (i == 0) ? -bottomLeft.getX() : 0; // left-align first character
-            foreach (const Path& p, glyphPaths) {
-                paths.append(p.translated(Point(offset + shift, Length(0))));
-            }
-            width = offset + topRight.getX() + shift; // do *not* count glyph spacing as width!
-            offset = width + glyphSpacing + letterSpacing;
-        } else if (glyphSpacing != 0) {
-            // it's a whitespace-only glyph -> count additional glyph spacing as width
-            width = offset + glyphSpacing;
-            offset = width + letterSpacing;
-        }
-    }
-    return paths;
-}
-
-QVector<Path> StrokeFont::strokeGlyph(const QChar& glyph, const Length& height,
-                                      Length& spacing) const noexcept
-{
+    CachedGlyph entry;
     try {
         qreal glyphSpacing = 0;
         QVector<fb::Polyline> polylines = accessor().getAllPolylinesOfGlyph(glyph.unicode(),
                                                                             &glyphSpacing); // can throw
-        spacing = convertLength(height, glyphSpacing);
-        return polylines2paths(polylines, height);
+        entry.spacing = convertLength(height, glyphSpacing);
+        entry.paths = polylines2paths(polylines, height);
+        if (!entry.paths.isEmpty()) {
+            Point bottomLeft, topRight;
+            computeBoundingRect(entry.paths, bottomLeft, topRight);
+            entry.left = bottomLeft.getX();
+            entry.right = topRight.getX();
+        }
     } catch (const fb::Exception& e) {
         qWarning() << "Failed to load stroke font glyph" << glyph;
-        spacing = 0;
-        return QVector<Path>();
+        entry = CachedGlyph();
     }
+    mGlyphCache.insert(key, new CachedGlyph(entry), qMax(entry.paths.count(), 1)); // takes ownership
+    return entry;
 }
 
-/*****************************************************************************************
- *  Private Methods
- ****************************************************************************************/
-
 void StrokeFont::fontLoaded() noexcept
 {
-    accessor(); // trigger the message about loading succeeded or failed
+    waitUntilLoaded(); // also triggers the message about loading succeeded or failed
 }
 
 const fb::GlyphListAccessor& StrokeFont::accessor() const noexcept
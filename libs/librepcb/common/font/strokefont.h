@@ -47,6 +47,19 @@ namespace librepcb {
 
 /**
  * @brief The StrokeFont class
+ *
+ * To avoid stroking the same glyphs and texts again and again (e.g. the designators of
+ * thousands of footprints), this class caches the paths of recently stroked glyphs (for
+ * each text height) as well as the paths of recently stroked texts. The size of both
+ * caches is limited, the least recently used entries are removed first.
+ *
+ * The font file is parsed in a worker thread. Objects which should not block the GUI
+ * thread until the font is available (e.g. librepcb::StrokeText) can check #isLoaded()
+ * and wait for the #loaded() signal. All other methods block until the font is loaded.
+ *
+ * @note The caches are not thread-safe, i.e. all stroke methods must be called from the
+ *       thread of the font object (usually the GUI thread). The #loaded() signal is
+ *       emitted in this thread too.
  */
 class StrokeFont final : public QObject
 {
@@ -59,10 +72,26 @@ class StrokeFont final : public QObject
         ~StrokeFont() noexcept;
 
         // Getters
+        bool isLoaded() const noexcept {return mLoadedSignalEmitted.loadAcquire() != 0;}
         Ratio getLetterSpacing() const noexcept;
         Ratio getLineSpacing() const noexcept;
 
         // General Methods
+
+        /**
+         * @brief Block until the font is loaded and emit #loaded() if not done yet
+         *
+         * This is useful if all texts need to be stroked immediately, e.g. for exports.
+         *
+         * @note If called from another thread than the thread of the font object, this
+         *       method only blocks until the font file is parsed. The #loaded() signal
+         *       is then emitted later in the thread of the font object, so texts which
+         *       are updated by this signal are not stroked yet when this method returns.
+         *       Exports running in worker threads therefore need to call this method
+         *       from the thread of the font object before starting the workers.
+         */
+        void waitUntilLoaded() noexcept;
+
         QVector<Path> stroke(const QString& text, const Length& height,
                              const Length& letterSpacing, const Length& lineSpacing,
                              const Alignment& align, Point& bottomLeft, Point& topRight) const noexcept;
@@ -79,8 +108,60 @@ class StrokeFont final : public QObject
         StrokeFont& operator=(const StrokeFont& rhs) = delete;
 
 
-    private:
+    signals:
+
+        /**
+         * @brief The font was loaded (or failed to load) in the background
+         *
+         * Emitted exactly once. Texts stroked with this font can now be updated.
+         */
+        void loaded();
+
+
+    private: // Types
+
+        /// @brief The cached paths and metrics of a single glyph with a specific height
+        struct CachedGlyph {
+            QVector<Path> paths;    ///< Stroked paths (empty for whitespace glyphs)
+            Length spacing;         ///< Glyph spacing (see #strokeGlyph())
+            Length left;            ///< Left border of the bounding rect
+            Length right;           ///< Right border of the bounding rect
+        };
+
+        /// @brief The key of a stroked text in #mTextCache
+        struct TextCacheKey {
+            QString text;
+            Length height;
+            Length letterSpacing;
+            Length lineSpacing;
+            Alignment align;
+            bool operator==(const TextCacheKey& rhs) const noexcept {
+                return (text == rhs.text) && (height == rhs.height) &&
+                       (letterSpacing == rhs.letterSpacing) &&
+                       (lineSpacing == rhs.lineSpacing) && (align == rhs.align);
+            }
+            friend uint qHash(const TextCacheKey& key, uint seed = 0) noexcept {
+                return ::qHash(key.text, seed) ^ qHash(key.height, seed) ^
+                       qHash(key.letterSpacing, seed + 1) ^ qHash(key.lineSpacing, seed + 2) ^
+                       ::qHash(uint(key.align.toQtAlign()), seed);
+            }
+        };
+
+        /// @brief The cached result of #stroke()
+        struct CachedText {
+            QVector<Path> paths;
+            Point bottomLeft;
+            Point topRight;
+        };
+
+
+    private: // Methods
         void fontLoaded() noexcept;
+        CachedGlyph getCachedGlyph(const QChar& glyph, const Length& height) const noexcept;
+        QVector<Path> strokeUncached(const QString& text, const Length& height,
+                                     const Length& letterSpacing, const Length& lineSpacing,
+                                     const Alignment& align, Point& bottomLeft,
+                                     Point& topRight) const noexcept;
         const fontobene::GlyphListAccessor& accessor() const noexcept;
         static QVector<Path> polylines2paths(const QVector<fontobene::Polyline>& polylines,
                                              const Length& height) noexcept;
@@ -98,6 +179,14 @@ class StrokeFont final : public QObject
         mutable QScopedPointer<fontobene::Font> mFont;
         mutable QScopedPointer<fontobene::GlyphListCache> mGlyphListCache;
         mutable QScopedPointer<fontobene::GlyphListAccessor> mGlyphListAccessor;
+        QAtomicInt mLoadedSignalEmitted; ///< Only modified in the thread of the font
+
+        /// Recently stroked glyphs, the key is the unicode of the glyph and the height
+        /// in nm, the cost of each entry is the count of its paths
+        mutable QCache<QPair<ushort, qint64>, CachedGlyph> mGlyphCache;
+
+        /// Recently stroked texts, the cost of each entry is the count of its paths
+        mutable QCache<TextCacheKey, CachedText> mTextCache;
 };
 
 /*****************************************************************************************
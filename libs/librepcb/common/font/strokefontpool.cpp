@@ -67,6 +67,17 @@ const StrokeFont& StrokeFontPool::getFont(const QString& filename) const
     }
 }
 
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void StrokeFontPool::waitUntilAllLoaded() noexcept
+{
+    foreach (const std::shared_ptr<StrokeFont>& font, mFonts) {
+        font->waitUntilLoaded();
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -52,6 +52,15 @@ class StrokeFontPool final
         // Getters
         const StrokeFont& getFont(const QString& filename) const;
 
+        // General Methods
+
+        /**
+         * @brief Block until all fonts of the pool are loaded
+         *
+         * @see StrokeFont::waitUntilLoaded()
+         */
+        void waitUntilAllLoaded() noexcept;
+
         // Operator Overloadings
         StrokeFontPool& operator=(const StrokeFontPool& rhs) noexcept;
 
@@ -97,6 +97,16 @@ void CmdHoleEdit::performRedo()
     mHole.setDiameter(mNewDiameter);
 }
 
+bool CmdHoleEdit::performMergeWith(const UndoCommand& other) noexcept
+{
+    const CmdHoleEdit* cmd = dynamic_cast<const CmdHoleEdit*>(&other);
+    if ((!cmd) || (&cmd->mHole != &mHole)) return false;
+
+    mNewPosition = cmd->mNewPosition;
+    mNewDiameter = cmd->mNewDiameter;
+    return true;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
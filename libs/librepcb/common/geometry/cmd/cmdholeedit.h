@@ -51,6 +51,9 @@ class CmdHoleEdit final : public UndoCommand
         explicit CmdHoleEdit(Hole& hole) noexcept;
         ~CmdHoleEdit() noexcept;
 
+        // Getters
+        int getMergeId() const noexcept override {return HoleEditMergeId;}
+
         // Setters
         void setPosition(const Point& pos, bool immediate) noexcept;
         void setDeltaToStartPos(const Point& deltaPos, bool immediate) noexcept;
@@ -73,6 +76,9 @@ class CmdHoleEdit final : public UndoCommand
         /// @copydoc UndoCommand::performRedo()
         void performRedo() override;
 
+        /// @copydoc UndoCommand::performMergeWith()
+        bool performMergeWith(const UndoCommand& other) noexcept override;
+
 
         // Private Member Variables
 
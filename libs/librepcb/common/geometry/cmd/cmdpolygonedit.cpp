@@ -50,6 +50,17 @@ CmdPolygonEdit::~CmdPolygonEdit() noexcept
     }
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdPolygonEdit::getApproxMemoryUsage() const noexcept
+{
+    return UndoCommand::getApproxMemoryUsage() + sizeof(*this) - sizeof(UndoCommand) +
+           (mOldPath.getVertices().capacity() + mNewPath.getVertices().capacity()) *
+           sizeof(Vertex);
+}
+
 /*****************************************************************************************
  *  Setters
  ****************************************************************************************/
@@ -133,6 +144,19 @@ void CmdPolygonEdit::performRedo()
     mPolygon.setPath(mNewPath);
 }
 
+bool CmdPolygonEdit::performMergeWith(const UndoCommand& other) noexcept
+{
+    const CmdPolygonEdit* cmd = dynamic_cast<const CmdPolygonEdit*>(&other);
+    if ((!cmd) || (&cmd->mPolygon != &mPolygon)) return false;
+
+    mNewLayerName = cmd->mNewLayerName;
+    mNewLineWidth = cmd->mNewLineWidth;
+    mNewIsFilled = cmd->mNewIsFilled;
+    mNewIsGrabArea = cmd->mNewIsGrabArea;
+    mNewPath = cmd->mNewPath;
+    return true;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -52,6 +52,10 @@ class CmdPolygonEdit final : public UndoCommand
         explicit CmdPolygonEdit(Polygon& polygon) noexcept;
         ~CmdPolygonEdit() noexcept;
 
+        // Getters
+        qint64 getApproxMemoryUsage() const noexcept override;
+        int getMergeId() const noexcept override {return PolygonEditMergeId;}
+
         // Setters
         void setLayerName(const QString& name, bool immediate) noexcept;
         void setLineWidth(const Length& width, bool immediate) noexcept;
@@ -78,6 +82,9 @@ class CmdPolygonEdit final : public UndoCommand
         /// @copydoc UndoCommand::performRedo()
         void performRedo() override;
 
+        /// @copydoc UndoCommand::performMergeWith()
+        bool performMergeWith(const UndoCommand& other) noexcept override;
+
 
         // Private Member Variables
 
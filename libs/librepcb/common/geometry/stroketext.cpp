@@ -124,6 +124,7 @@ StrokeText::StrokeText(const SExpression& node) :
 
 StrokeText::~StrokeText() noexcept
 {
+    QObject::disconnect(mFontLoadedConnection);
 }
 
 /*****************************************************************************************
@@ -308,6 +309,7 @@ void StrokeText::setAttributeProvider(const AttributeProvider* provider) noexcep
 void StrokeText::setFont(const StrokeFont* font) noexcept
 {
     if (font == mFont) return;
+    QObject::disconnect(mFontLoadedConnection);
     mFont = font;
     updatePaths();
 }
@@ -316,7 +318,16 @@ void StrokeText::updatePaths() noexcept
 {
     QVector<Path> paths;
     Point center;
-    if (mFont) {
+    if (mFont && (!mFont->isLoaded())) {
+        // don't block until the font is loaded, update the paths as soon as it is loaded
+        if (!mFontLoadedConnection) {
+            // the font is the context object, so the paths are always updated in the
+            // thread of the font (which owns the caches used for stroking)
+            mFontLoadedConnection = QObject::connect(mFont, &StrokeFont::loaded, mFont,
+                                                     [this](){updatePaths();});
+        }
+    } else if (mFont) {
+        QObject::disconnect(mFontLoadedConnection);
         QString str = mText;
         if (mAttributeProvider) {
             str = AttributeSubstitutor::substitute(str, mAttributeProvider);
@@ -225,6 +225,7 @@ class StrokeText final : public SerializableObject
         mutable QSet<IF_StrokeTextObserver*> mObservers; ///< A list of all observer objects
         const AttributeProvider* mAttributeProvider; ///< for substituting placeholders in text
         const StrokeFont* mFont; ///< font used for calculating paths
+        QMetaObject::Connection mFontLoadedConnection; ///< to update paths once font is loaded
         QVector<Path> mPaths; ///< stroke paths without transformations (mirror/rotate/translate)
         QVector<Path> mPathsRotated; ///< same as #mPaths, but rotated by 180°
 };
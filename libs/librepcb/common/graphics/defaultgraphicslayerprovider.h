@@ -47,6 +47,7 @@ class DefaultGraphicsLayerProvider final : public IF_GraphicsLayerProvider
         ~DefaultGraphicsLayerProvider() noexcept;
 
         // Getters
+        using IF_GraphicsLayerProvider::getLayer;
         GraphicsLayer* getLayer(const QString& name) const noexcept override;
         QList<GraphicsLayer*> getAllLayers() const noexcept override {return mLayers;}
 
@@ -29,19 +29,143 @@
  ****************************************************************************************/
 namespace librepcb {
 
+/*****************************************************************************************
+ *  Layer ID Table
+ ****************************************************************************************/
+
+static_assert(static_cast<int>(GraphicsLayer::Id::InnerCopperLast) -
+              static_cast<int>(GraphicsLayer::Id::InnerCopperFirst) + 1 ==
+              GraphicsLayer::getInnerLayerCount(), "Wrong number of inner layer IDs");
+
+/**
+ * @brief Static properties of all layer IDs, created only once
+ */
+struct GraphicsLayerIdTable final {
+    struct Entry {
+        QString name;
+        GraphicsLayer::Id mirrored;
+        bool top;
+        bool bottom;
+        bool inner;
+        bool copper;
+    };
+    QVector<Entry> entries;                 ///< indexed by the layer ID
+    QHash<QString, GraphicsLayer::Id> ids;  ///< indexed by the layer name
+};
+
+static const GraphicsLayerIdTable& getLayerIdTable() noexcept
+{
+    typedef GraphicsLayer::Id Id;
+    static const GraphicsLayerIdTable table = [](){
+        QList<QPair<Id, QString>> layers = {
+            {Id::SchematicReferences,                  GraphicsLayer::sSchematicReferences},
+            {Id::SchematicSheetFrames,                 GraphicsLayer::sSchematicSheetFrames},
+            {Id::SchematicNetLines,                    GraphicsLayer::sSchematicNetLines},
+            {Id::SchematicNetLabels,                   GraphicsLayer::sSchematicNetLabels},
+            {Id::SchematicNetLabelAnchors,             GraphicsLayer::sSchematicNetLabelAnchors},
+            {Id::SchematicDocumentation,               GraphicsLayer::sSchematicDocumentation},
+            {Id::SchematicComments,                    GraphicsLayer::sSchematicComments},
+            {Id::SchematicGuide,                       GraphicsLayer::sSchematicGuide},
+            {Id::SymbolOutlines,                       GraphicsLayer::sSymbolOutlines},
+            {Id::SymbolGrabAreas,                      GraphicsLayer::sSymbolGrabAreas},
+            {Id::SymbolHiddenGrabAreas,                GraphicsLayer::sSymbolHiddenGrabAreas},
+            {Id::SymbolNames,                          GraphicsLayer::sSymbolNames},
+            {Id::SymbolValues,                         GraphicsLayer::sSymbolValues},
+            {Id::SymbolPinCirclesOpt,                  GraphicsLayer::sSymbolPinCirclesOpt},
+            {Id::SymbolPinCirclesReq,                  GraphicsLayer::sSymbolPinCirclesReq},
+            {Id::SymbolPinNames,                       GraphicsLayer::sSymbolPinNames},
+            {Id::SymbolPinNumbers,                     GraphicsLayer::sSymbolPinNumbers},
+            {Id::BoardSheetFrames,                     GraphicsLayer::sBoardSheetFrames},
+            {Id::BoardOutlines,                        GraphicsLayer::sBoardOutlines},
+            {Id::BoardMillingPth,                      GraphicsLayer::sBoardMillingPth},
+            {Id::BoardDrillsNpth,                      GraphicsLayer::sBoardDrillsNpth},
+            {Id::BoardPadsTht,                         GraphicsLayer::sBoardPadsTht},
+            {Id::BoardViasTht,                         GraphicsLayer::sBoardViasTht},
+            {Id::BoardMeasures,                        GraphicsLayer::sBoardMeasures},
+            {Id::BoardAlignment,                       GraphicsLayer::sBoardAlignment},
+            {Id::BoardDocumentation,                   GraphicsLayer::sBoardDocumentation},
+            {Id::BoardComments,                        GraphicsLayer::sBoardComments},
+            {Id::BoardGuide,                           GraphicsLayer::sBoardGuide},
+            {Id::BoardAirWires,                        GraphicsLayer::sBoardAirWires},
+            {Id::TopPlacement,                         GraphicsLayer::sTopPlacement},
+            {Id::BotPlacement,                         GraphicsLayer::sBotPlacement},
+            {Id::TopDocumentation,                     GraphicsLayer::sTopDocumentation},
+            {Id::BotDocumentation,                     GraphicsLayer::sBotDocumentation},
+            {Id::TopGrabAreas,                         GraphicsLayer::sTopGrabAreas},
+            {Id::BotGrabAreas,                         GraphicsLayer::sBotGrabAreas},
+            {Id::TopHiddenGrabAreas,                   GraphicsLayer::sTopHiddenGrabAreas},
+            {Id::BotHiddenGrabAreas,                   GraphicsLayer::sBotHiddenGrabAreas},
+            {Id::TopReferences,                        GraphicsLayer::sTopReferences},
+            {Id::BotReferences,                        GraphicsLayer::sBotReferences},
+            {Id::TopNames,                             GraphicsLayer::sTopNames},
+            {Id::BotNames,                             GraphicsLayer::sBotNames},
+            {Id::TopValues,                            GraphicsLayer::sTopValues},
+            {Id::BotValues,                            GraphicsLayer::sBotValues},
+            {Id::TopCourtyard,                         GraphicsLayer::sTopCourtyard},
+            {Id::BotCourtyard,                         GraphicsLayer::sBotCourtyard},
+            {Id::TopStopMask,                          GraphicsLayer::sTopStopMask},
+            {Id::BotStopMask,                          GraphicsLayer::sBotStopMask},
+            {Id::TopSolderPaste,                       GraphicsLayer::sTopSolderPaste},
+            {Id::BotSolderPaste,                       GraphicsLayer::sBotSolderPaste},
+            {Id::TopFinish,                            GraphicsLayer::sTopFinish},
+            {Id::BotFinish,                            GraphicsLayer::sBotFinish},
+            {Id::TopGlue,                              GraphicsLayer::sTopGlue},
+            {Id::BotGlue,                              GraphicsLayer::sBotGlue},
+            {Id::TopCopper,                            GraphicsLayer::sTopCopper},
+            {Id::BotCopper,                            GraphicsLayer::sBotCopper},
+            {Id::DebugGraphicsItemsBoundingRects,      "dbg_GraphicsItemsBoundingRects"},
+            {Id::DebugGraphicsItemsTextsBoundingRects, "dbg_GraphicsItemsTextsBoundingRects"},
+            {Id::DebugSymbolPinNetSignalNames,         "dbg_SymbolPinNetSignalNames"},
+            {Id::DebugNetLinesNetSignalNames,          "dbg_NetLinesNetSignalNames"},
+            {Id::DebugInvisibleNetPoints,              "dbg_InvisibleNetPoints"},
+            {Id::DebugComponentSymbolsCounts,          "dbg_ComponentSymbolsCounts"},
+        };
+        for (int i = 1; i <= GraphicsLayer::getInnerLayerCount(); ++i) {
+            Id id = static_cast<Id>(static_cast<int>(Id::InnerCopperFirst) + i - 1);
+            layers.append(qMakePair(id, GraphicsLayer::getInnerLayerName(i)));
+        }
+
+        GraphicsLayerIdTable t;
+        t.entries.fill({QString(), Id::Unknown, false, false, false, false},
+                       static_cast<int>(Id::_COUNT));
+        for (const auto& layer : layers) {
+            t.ids.insert(layer.second, layer.first);
+        }
+        for (const auto& layer : layers) {
+            const QString& name = layer.second;
+            GraphicsLayerIdTable::Entry& entry = t.entries[static_cast<int>(layer.first)];
+            entry.name = name;
+            entry.top = GraphicsLayer::isTopLayer(name);
+            entry.bottom = GraphicsLayer::isBottomLayer(name);
+            entry.inner = GraphicsLayer::isInnerLayer(name);
+            entry.copper = GraphicsLayer::isCopperLayer(name);
+            if (entry.top) {
+                entry.mirrored = t.ids.value(QString(name).replace(0, 3, "bot"), Id::Unknown);
+            } else if (entry.bottom) {
+                entry.mirrored = t.ids.value(QString(name).replace(0, 3, "top"), Id::Unknown);
+            } else {
+                entry.mirrored = layer.first; // layer cannot be mirrored
+            }
+        }
+        return t;
+    }();
+    return table;
+}
+
 /*****************************************************************************************
  *  Constructors / Destructor
  ****************************************************************************************/
 
 GraphicsLayer::GraphicsLayer(const GraphicsLayer& other) noexcept :
-    QObject(nullptr), mName(other.mName), mNameTr(other.mNameTr), mColor(other.mColor),
+    QObject(nullptr), mId(other.mId), mName(other.mName), mNameTr(other.mNameTr),
+    mColor(other.mColor),
     mColorHighlighted(other.mColorHighlighted), mIsVisible(other.mIsVisible),
     mIsEnabled(other.mIsEnabled)
 {
 }
 
 GraphicsLayer::GraphicsLayer(const QString& name) noexcept :
-    QObject(nullptr), mName(name), mIsEnabled(true)
+    QObject(nullptr), mId(getLayerId(name)), mName(name), mIsEnabled(true)
 {
     getDefaultValues(mName, mNameTr, mColor, mColorHighlighted, mIsVisible);
 }
@@ -54,6 +178,30 @@ GraphicsLayer::~GraphicsLayer() noexcept
     Q_ASSERT(mObservers.isEmpty());
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+bool GraphicsLayer::isTopLayer() const noexcept
+{
+    return (mId != Id::Unknown) ? isTopLayer(mId) : isTopLayer(mName);
+}
+
+bool GraphicsLayer::isBottomLayer() const noexcept
+{
+    return (mId != Id::Unknown) ? isBottomLayer(mId) : isBottomLayer(mName);
+}
+
+bool GraphicsLayer::isInnerLayer() const noexcept
+{
+    return (mId != Id::Unknown) ? isInnerLayer(mId) : isInnerLayer(mName);
+}
+
+bool GraphicsLayer::isCopperLayer() const noexcept
+{
+    return (mId != Id::Unknown) ? isCopperLayer(mId) : isCopperLayer(mName);
+}
+
 /*****************************************************************************************
  *  Setters
  ****************************************************************************************/
@@ -157,7 +305,10 @@ int GraphicsLayer::getInnerLayerNumber(const QString& name) noexcept
 
 QString GraphicsLayer::getMirroredLayerName(const QString& name) noexcept
 {
-    if (name.startsWith("top_")) {
+    Id id = getLayerId(name);
+    if (id != Id::Unknown) {
+        return getLayerName(getMirroredLayerId(id)); // avoids allocating a new string
+    } else if (name.startsWith("top_")) {
         return QString(name).replace(0, 3, "bot");
     } else if (name.startsWith("bot_")) {
         return QString(name).replace(0, 3, "top");
@@ -179,6 +330,50 @@ QString GraphicsLayer::getGrabAreaLayerName(const QString& outlineLayerName) noe
     }
 }
 
+GraphicsLayer::Id GraphicsLayer::getLayerId(const QString& name) noexcept
+{
+    return getLayerIdTable().ids.value(name, Id::Unknown);
+}
+
+const QString& GraphicsLayer::getLayerName(Id id) noexcept
+{
+    return getLayerIdTable().entries.at(static_cast<int>(id)).name;
+}
+
+GraphicsLayer::Id GraphicsLayer::getInnerLayerId(int number) noexcept
+{
+    if ((number >= 1) && (number <= getInnerLayerCount())) {
+        return static_cast<Id>(static_cast<int>(Id::InnerCopperFirst) + number - 1);
+    } else {
+        return Id::Unknown;
+    }
+}
+
+GraphicsLayer::Id GraphicsLayer::getMirroredLayerId(Id id) noexcept
+{
+    return getLayerIdTable().entries.at(static_cast<int>(id)).mirrored;
+}
+
+bool GraphicsLayer::isTopLayer(Id id) noexcept
+{
+    return getLayerIdTable().entries.at(static_cast<int>(id)).top;
+}
+
+bool GraphicsLayer::isBottomLayer(Id id) noexcept
+{
+    return getLayerIdTable().entries.at(static_cast<int>(id)).bottom;
+}
+
+bool GraphicsLayer::isInnerLayer(Id id) noexcept
+{
+    return getLayerIdTable().entries.at(static_cast<int>(id)).inner;
+}
+
+bool GraphicsLayer::isCopperLayer(Id id) noexcept
+{
+    return getLayerIdTable().entries.at(static_cast<int>(id)).copper;
+}
+
 const QStringList& GraphicsLayer::getSchematicGeometryElementLayerNames() noexcept
 {
     static QStringList names = {
@@ -266,6 +461,7 @@ void GraphicsLayer::getDefaultValues(const QString& name, QString& nameTr, QColo
         h.insert(sBoardDocumentation,       {tr("Documentation"),               Qt::lightGray,              Qt::white,                  true});
         h.insert(sBoardComments,            {tr("Comments"),                    QColor(255, 165, 0, 180),   QColor(255, 165, 0, 255),   true});
         h.insert(sBoardGuide,               {tr("Guide"),                       Qt::darkYellow,             Qt::yellow,                 true});
+        h.insert(sBoardAirWires,            {tr("Airwires"),                    Qt::yellow,                 Qt::white,                  true});
         // board symmetric
         h.insert(sTopPlacement,             {tr("Top Placement"),               QColor(224, 224, 224, 150), QColor(224, 224, 224, 220), true});
         h.insert(sBotPlacement,             {tr("Bot Placement"),               QColor(224, 224, 224, 150), QColor(224, 224, 224, 220), true});
@@ -91,6 +91,7 @@ class GraphicsLayer : public QObject
         static constexpr const char* sBoardDocumentation      = "brd_documentation";      ///< for documentation purposes, e.g. text
         static constexpr const char* sBoardComments           = "brd_comments";           ///< for personal comments, e.g. text
         static constexpr const char* sBoardGuide              = "brd_guide";              ///< e.g. for boxes around circuits
+        static constexpr const char* sBoardAirWires           = "brd_airwires";           ///< unrouted connections of net signals
 
         // symmetric board layers
         static constexpr const char* sTopPlacement            = "top_placement";          ///< placement information (e.g. outline) of devices
@@ -133,6 +134,46 @@ class GraphicsLayer : public QObject
         static constexpr const char* sDebugComponentSymbolsCounts           = "dbg_ComponentSymbolsCounts";
 #endif
 
+        /**
+         * @brief Compact identifiers of all layers listed above
+         *
+         * Comparing layers by their ID is much cheaper than comparing their names, so
+         * the IDs should be used wherever layers are compared very often (e.g. in
+         * exports or in paint loops). The layer names are only needed for serialization,
+         * see #getLayerId() and #getLayerName() to convert between them.
+         */
+        enum class Id : int {
+            Unknown = 0, ///< not one of the layers listed above
+            // schematic layers
+            SchematicReferences, SchematicSheetFrames, SchematicNetLines,
+            SchematicNetLabels, SchematicNetLabelAnchors, SchematicDocumentation,
+            SchematicComments, SchematicGuide,
+            // symbol layers
+            SymbolOutlines, SymbolGrabAreas, SymbolHiddenGrabAreas, SymbolNames,
+            SymbolValues, SymbolPinCirclesOpt, SymbolPinCirclesReq, SymbolPinNames,
+            SymbolPinNumbers,
+            // asymmetric board layers
+            BoardSheetFrames, BoardOutlines, BoardMillingPth, BoardDrillsNpth,
+            BoardPadsTht, BoardViasTht, BoardMeasures, BoardAlignment, BoardDocumentation,
+            BoardComments, BoardGuide, BoardAirWires,
+            // symmetric board layers
+            TopPlacement, BotPlacement, TopDocumentation, BotDocumentation, TopGrabAreas,
+            BotGrabAreas, TopHiddenGrabAreas, BotHiddenGrabAreas, TopReferences,
+            BotReferences, TopNames, BotNames, TopValues, BotValues, TopCourtyard,
+            BotCourtyard, TopStopMask, BotStopMask, TopSolderPaste, BotSolderPaste,
+            TopFinish, BotFinish, TopGlue, BotGlue,
+            // copper layers
+            TopCopper,
+            InnerCopperFirst,                       ///< "in1_cu", see #getInnerLayerId()
+            InnerCopperLast = InnerCopperFirst + 61,///< "in62_cu" (see #getInnerLayerCount())
+            BotCopper,
+            // debug layers (always available to keep the IDs stable)
+            DebugGraphicsItemsBoundingRects, DebugGraphicsItemsTextsBoundingRects,
+            DebugSymbolPinNetSignalNames, DebugNetLinesNetSignalNames,
+            DebugInvisibleNetPoints, DebugComponentSymbolsCounts,
+            _COUNT ///< number of IDs, must be the last entry
+        };
+
         // Constructors / Destructor
         GraphicsLayer() = delete;
         GraphicsLayer(const GraphicsLayer& other) noexcept;
@@ -140,6 +181,7 @@ class GraphicsLayer : public QObject
         virtual ~GraphicsLayer() noexcept;
 
         // Getters
+        Id getId() const noexcept {return mId;}
         const QString& getName() const noexcept {return mName;}
         const QString& getNameTr() const noexcept {return mNameTr;}
         const QColor& getColor(bool highlighted = false) const noexcept {
@@ -148,11 +190,12 @@ class GraphicsLayer : public QObject
         bool getVisible() const noexcept {return mIsVisible;}
         bool isEnabled() const noexcept {return mIsEnabled;}
         bool isVisible() const noexcept {return mIsEnabled && mIsVisible;}
-        bool isTopLayer() const noexcept {return isTopLayer(mName);}
-        bool isBottomLayer() const noexcept {return isBottomLayer(mName);}
-        bool isInnerLayer() const noexcept {return isInnerLayer(mName);}
-        bool isCopperLayer() const noexcept {return isCopperLayer(mName);}
+        bool isTopLayer() const noexcept;
+        bool isBottomLayer() const noexcept;
+        bool isInnerLayer() const noexcept;
+        bool isCopperLayer() const noexcept;
         int getInnerLayerNumber() const noexcept {return getInnerLayerNumber(mName);}
+        Id getMirroredLayerId() const noexcept {return getMirroredLayerId(mId);}
         QString getMirroredLayerName() const noexcept {return getMirroredLayerName(mName);}
         QString getGrabAreaLayerName() const noexcept {return getGrabAreaLayerName(mName);}
 
@@ -170,7 +213,7 @@ class GraphicsLayer : public QObject
         GraphicsLayer& operator=(const GraphicsLayer& rhs) = delete;
 
         // Static Methods
-        static int getInnerLayerCount() noexcept {return 62;} // some random number... ;)
+        static constexpr int getInnerLayerCount() noexcept {return 62;} // some random number... ;)
         static bool isTopLayer(const QString& name) noexcept;
         static bool isBottomLayer(const QString& name) noexcept;
         static bool isInnerLayer(const QString& name) noexcept;
@@ -179,6 +222,14 @@ class GraphicsLayer : public QObject
         static int getInnerLayerNumber(const QString& name) noexcept;
         static QString getMirroredLayerName(const QString& name) noexcept;
         static QString getGrabAreaLayerName(const QString& outlineLayerName) noexcept;
+        static Id getLayerId(const QString& name) noexcept;
+        static const QString& getLayerName(Id id) noexcept;
+        static Id getInnerLayerId(int number) noexcept;
+        static Id getMirroredLayerId(Id id) noexcept;
+        static bool isTopLayer(Id id) noexcept;
+        static bool isBottomLayer(Id id) noexcept;
+        static bool isInnerLayer(Id id) noexcept;
+        static bool isCopperLayer(Id id) noexcept;
         static const QStringList& getSchematicGeometryElementLayerNames() noexcept;
         static const QStringList& getBoardGeometryElementLayerNames() noexcept;
         static void getDefaultValues(const QString& name, QString& nameTr, QColor& color,
@@ -190,6 +241,7 @@ class GraphicsLayer : public QObject
 
 
     protected: // Data
+        Id mId;                     ///< Compact identifier of #mName (Id::Unknown if none)
         QString mName;              ///< Unique name which is used for serialization
         QString mNameTr;            ///< Layer name (translated into the user's language)
         QColor mColor;              ///< Color of graphics items on that layer
@@ -199,6 +251,10 @@ class GraphicsLayer : public QObject
         mutable QSet<IF_GraphicsLayerObserver*> mObservers; ///< A list of all observer objects
 };
 
+inline uint qHash(GraphicsLayer::Id key, uint seed) noexcept {
+    return ::qHash(static_cast<int>(key), seed);
+}
+
 /*****************************************************************************************
  *  Interface IF_GraphicsLayerObserver
  ****************************************************************************************/
@@ -235,6 +291,10 @@ class IF_GraphicsLayerProvider
         virtual GraphicsLayer* getLayer(const QString& name) const noexcept = 0;
         virtual QList<GraphicsLayer*> getAllLayers() const noexcept = 0;
 
+        virtual GraphicsLayer* getLayer(GraphicsLayer::Id id) const noexcept {
+            return getLayer(GraphicsLayer::getLayerName(id));
+        }
+
         GraphicsLayer* getGrabAreaLayer(const QString outlineLayerName) const noexcept {
             return getLayer(GraphicsLayer::getGrabAreaLayerName(outlineLayerName));
         }
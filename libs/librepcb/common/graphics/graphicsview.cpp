@@ -43,7 +43,7 @@ GraphicsView::GraphicsView(QWidget* parent, IF_GraphicsViewEventHandler* eventHa
     mUseOpenGl(false), mPanningActive(false)
 {
     setRenderHints(QPainter::Antialiasing | QPainter::SmoothPixmapTransform);
-    setViewportUpdateMode(QGraphicsView::FullViewportUpdate);
+    setViewportUpdateMode(QGraphicsView::SmartViewportUpdate);
     setOptimizationFlags(QGraphicsView::DontSavePainterState);
     setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOn);
     setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOn);
@@ -78,17 +78,23 @@ void GraphicsView::setUseOpenGl(bool useOpenGl) noexcept
 {
     if (useOpenGl != mUseOpenGl)
     {
-        if (useOpenGl)
+        // OpenGL viewports are double buffered and need to be repainted completely
+        if (useOpenGl) {
             setViewport(new QGLWidget(QGLFormat(QGL::DoubleBuffer | QGL::AlphaChannel | QGL::SampleBuffers)));
-        else
+            setViewportUpdateMode(QGraphicsView::FullViewportUpdate);
+        } else {
             setViewport(nullptr);
+            setViewportUpdateMode(QGraphicsView::SmartViewportUpdate);
+        }
         mUseOpenGl = useOpenGl;
+        mGridCache = QPixmap();
     }
 }
 
 void GraphicsView::setGridProperties(const GridProperties& properties) noexcept
 {
     *mGridProperties = properties;
+    mGridCache = QPixmap(); // the grid needs to be rendered again
     setBackgroundBrush(backgroundBrush()); // this will repaint the background
 }
 
@@ -258,21 +264,101 @@ bool GraphicsView::eventFilter(QObject* obj, QEvent* event)
 }
 
 void GraphicsView::drawBackground(QPainter* painter, const QRectF& rect)
+{
+    // Rendering the grid is expensive (thousands of dots or lines), so the background is
+    // rendered into a pixmap which is reused for all repaints until the zoom level, the
+    // grid properties or the background changes, or the view is scrolled too far.
+    if (!isGridCacheValid()) {
+        updateGridCache();
+    }
+    if (!mGridCache.isNull()) {
+        QPointF pos = viewportTransform().map(mGridCacheSceneOrigin);
+        painter->save();
+        painter->resetTransform();
+        painter->drawPixmap(pos.toPoint(), mGridCache);
+        painter->restore();
+    } else {
+        // fallback, e.g. if the pixmap could not be allocated
+        painter->save();
+        painter->fillRect(rect, backgroundBrush());
+        drawGrid(*painter, rect, viewportTransform().m11());
+        painter->restore();
+    }
+}
+
+void GraphicsView::drawForeground(QPainter* painter, const QRectF& rect)
+{
+    Q_UNUSED(rect);
+
+    if (mOriginCrossVisible)
+    {
+        // draw origin cross
+        qreal len = Length::fromMm(2.54).toPx();
+        QPen originPen(foregroundBrush().color());
+        originPen.setWidth(0);
+        painter->setPen(originPen);
+        painter->drawLine(QLineF(-len, 0.0, len, 0.0));
+        painter->drawLine(QLineF(0.0, -len, 0.0, len));
+    }
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+bool GraphicsView::isGridCacheValid() const noexcept
+{
+    if (mGridCache.isNull() || (backgroundBrush() != mGridCacheBackground)) {
+        return false;
+    }
+
+    // the cache is only valid for the same zoom level...
+    QTransform transform = viewportTransform();
+    if ((transform.m11() != mGridCacheTransform.m11()) ||
+        (transform.m12() != mGridCacheTransform.m12()) ||
+        (transform.m21() != mGridCacheTransform.m21()) ||
+        (transform.m22() != mGridCacheTransform.m22())) {
+        return false;
+    }
+
+    // ...and as long as it covers the whole viewport
+    QPointF pos = transform.map(mGridCacheSceneOrigin);
+    QRect cacheRect(pos.toPoint(), mGridCache.size() / mGridCache.devicePixelRatio());
+    return cacheRect.contains(viewport()->rect());
+}
+
+void GraphicsView::updateGridCache() noexcept
+{
+    qreal dpr = viewport()->devicePixelRatio();
+    QRect area = viewport()->rect().adjusted(-sGridCacheMargin, -sGridCacheMargin,
+                                             sGridCacheMargin, sGridCacheMargin);
+    mGridCache = QPixmap(area.size() * dpr);
+    if (mGridCache.isNull()) {
+        return;
+    }
+    mGridCache.setDevicePixelRatio(dpr);
+    mGridCacheTransform = viewportTransform();
+    mGridCacheSceneOrigin = mGridCacheTransform.inverted().map(QPointF(area.topLeft()));
+    mGridCacheBackground = backgroundBrush();
+
+    QPainter painter(&mGridCache);
+    painter.setRenderHints(renderHints());
+    painter.fillRect(QRect(QPoint(0, 0), area.size()), mGridCacheBackground);
+    painter.setTransform(mGridCacheTransform * QTransform::fromTranslate(-area.left(), -area.top()));
+    QRectF sceneRect = painter.transform().inverted().mapRect(QRectF(QPoint(0, 0), area.size()));
+    drawGrid(painter, sceneRect, mGridCacheTransform.m11());
+}
+
+void GraphicsView::drawGrid(QPainter& painter, const QRectF& rect, qreal scaleFactor) const noexcept
 {
     QPen gridPen(Qt::gray);
     gridPen.setCosmetic(true);
 
-    // draw background color
-    painter->setPen(Qt::NoPen);
-    painter->setBrush(backgroundBrush());
-    painter->fillRect(rect, backgroundBrush());
-
     // draw background grid lines
     gridPen.setWidth((mGridProperties->getType() == GridProperties::Type_t::Dots) ? 2 : 1);
-    painter->setPen(gridPen);
-    painter->setBrush(Qt::NoBrush);
+    painter.setPen(gridPen);
+    painter.setBrush(Qt::NoBrush);
     qreal gridIntervalPixels = mGridProperties->getInterval().toPx();
-    qreal scaleFactor = width() / rect.width();
     if (gridIntervalPixels * scaleFactor >= (qreal)5)
     {
         qreal left, right, top, bottom;
@@ -289,8 +375,8 @@ void GraphicsView::drawBackground(QPainter* painter, const QRectF& rect)
                     lines.append(QLineF(x, rect.top(), x, rect.bottom()));
                 for (qreal y = bottom; y > top; y -= gridIntervalPixels)
                     lines.append(QLineF(rect.left(), y, rect.right(), y));
-                painter->setOpacity(0.5);
-                painter->drawLines(lines.data(), lines.size());
+                painter.setOpacity(0.5);
+                painter.drawLines(lines.data(), lines.size());
                 break;
             }
 
@@ -300,7 +386,7 @@ void GraphicsView::drawBackground(QPainter* painter, const QRectF& rect)
                 for (qreal x = left; x < right; x += gridIntervalPixels)
                     for (qreal y = bottom; y > top; y -= gridIntervalPixels)
                         dots.append(QPointF(x, y));
-                painter->drawPoints(dots.data(), dots.size());
+                painter.drawPoints(dots.data(), dots.size());
                 break;
             }
 
@@ -310,22 +396,6 @@ void GraphicsView::drawBackground(QPainter* painter, const QRectF& rect)
     }
 }
 
-void GraphicsView::drawForeground(QPainter* painter, const QRectF& rect)
-{
-    Q_UNUSED(rect);
-
-    if (mOriginCrossVisible)
-    {
-        // draw origin cross
-        qreal len = Length::fromMm(2.54).toPx();
-        QPen originPen(foregroundBrush().color());
-        originPen.setWidth(0);
-        painter->setPen(originPen);
-        painter->drawLine(QLineF(-len, 0.0, len, 0.0));
-        painter->drawLine(QLineF(0.0, -len, 0.0, len));
-    }
-}
-
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -108,6 +108,11 @@ class GraphicsView final : public QGraphicsView
         void drawBackground(QPainter* painter, const QRectF& rect);
         void drawForeground(QPainter* painter, const QRectF& rect);
 
+        // Private Methods
+        bool isGridCacheValid() const noexcept;
+        void updateGridCache() noexcept;
+        void drawGrid(QPainter& painter, const QRectF& rect, qreal scaleFactor) const noexcept;
+
 
         // General Attributes
         IF_GraphicsViewEventHandler* mEventHandlerObject;
@@ -119,8 +124,15 @@ class GraphicsView final : public QGraphicsView
         volatile bool mPanningActive;
         QCursor mCursorBeforePanning;
 
+        // Grid Cache
+        QPixmap mGridCache;             ///< Background and grid of the visible area + margin
+        QPointF mGridCacheSceneOrigin;  ///< Scene position of the top left pixel of the cache
+        QTransform mGridCacheTransform; ///< View transform (without scrolling) of the cache
+        QBrush mGridCacheBackground;    ///< Background brush used to render the cache
+
         // Static Variables
         static constexpr qreal sZoomStepFactor = 1.3;
+        static constexpr int sGridCacheMargin = 256; ///< Pixels to cache around the viewport
 };
 
 /*****************************************************************************************
@@ -42,6 +42,15 @@ UndoCommand::~UndoCommand() noexcept
     Q_ASSERT(qAbs(mRedoCount - mUndoCount) <= 1);
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 UndoCommand::getApproxMemoryUsage() const noexcept
+{
+    return sizeof(*this) + (mText.capacity() * sizeof(QChar));
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -79,6 +88,28 @@ void UndoCommand::redo()
     mRedoCount++;
 }
 
+bool UndoCommand::mergeWith(const UndoCommand& other) noexcept
+{
+    if ((&other == this) || (!isCurrentlyExecuted()) || (!other.isCurrentlyExecuted())) {
+        return false;
+    }
+    if ((getMergeId() == NoMergeId) || (other.getMergeId() != getMergeId())) {
+        return false;
+    }
+
+    return performMergeWith(other);
+}
+
+/*****************************************************************************************
+ *  Protected Methods
+ ****************************************************************************************/
+
+bool UndoCommand::performMergeWith(const UndoCommand& other) noexcept
+{
+    Q_UNUSED(other);
+    return false;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
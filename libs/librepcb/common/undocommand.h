@@ -53,6 +53,16 @@ class UndoCommand
 
     public:
 
+        /**
+         * @brief IDs of the commands which support merging (see #getMergeId())
+         */
+        enum MergeId {
+            NoMergeId = -1,     ///< The command does not support merging
+            PolygonEditMergeId, ///< librepcb::CmdPolygonEdit
+            HoleEditMergeId,    ///< librepcb::CmdHoleEdit
+            UserMergeId = 1000, ///< First ID available for other commands
+        };
+
         // Constructors / Destructor
         UndoCommand() = delete;
         UndoCommand(const UndoCommand& other) = delete;
@@ -81,6 +91,28 @@ class UndoCommand
          */
         bool isCurrentlyExecuted() const noexcept {return mRedoCount > mUndoCount;}
 
+        /**
+         * @brief Get the approximate amount of heap memory used by this command
+         *
+         * This is used by librepcb::UndoStack to limit the memory consumption of long
+         * editing sessions. Derived classes which hold big amounts of data (e.g. paths or
+         * child commands) should override this method.
+         *
+         * @return The estimated memory usage in bytes
+         */
+        virtual qint64 getApproxMemoryUsage() const noexcept;
+
+        /**
+         * @brief Get the ID used to determine whether two commands may be merged
+         *
+         * Only commands with the same ID (other than #NoMergeId) are tried to merge (see
+         * #mergeWith()). Derived classes which override #performMergeWith() must also
+         * override this method.
+         *
+         * @return The merge ID of this command (#NoMergeId by default)
+         */
+        virtual int getMergeId() const noexcept {return NoMergeId;}
+
 
         // General Methods
 
@@ -102,6 +134,22 @@ class UndoCommand
          */
         virtual void redo() final;
 
+        /**
+         * @brief Try to merge another command into this command
+         *
+         * Both commands must be currently executed (#isCurrentlyExecuted()) and have the
+         * same merge ID (#getMergeId()). If the merge is successful, this command will
+         * represent the changes of both commands, i.e. an #undo() of this command reverts
+         * also the changes of the other command. The other command can then be deleted
+         * without undoing it.
+         *
+         * @param other     The command to merge into this command (the newer one)
+         *
+         * @retval true     If the other command was merged into this command
+         * @retval false    If the commands cannot be merged (nothing was changed)
+         */
+        virtual bool mergeWith(const UndoCommand& other) noexcept final;
+
         // Operator Overloadings
         UndoCommand& operator=(const UndoCommand& rhs) = delete;
 
@@ -134,6 +182,20 @@ class UndoCommand
          */
         virtual void performRedo() = 0;
 
+        /**
+         * @brief Merge another command into this command
+         *
+         * @note The default implementation does not support merging. Derived classes
+         *       which modify the properties of a single object (e.g. "edit" commands)
+         *       can override this method to merge consecutive edits of the same object.
+         *
+         * @param other     The command to merge (see #mergeWith())
+         *
+         * @retval true     If the other command was merged into this command
+         * @retval false    If the commands cannot be merged
+         */
+        virtual bool performMergeWith(const UndoCommand& other) noexcept;
+
 
     private:
 
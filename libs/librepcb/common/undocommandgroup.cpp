@@ -46,6 +46,20 @@ UndoCommandGroup::~UndoCommandGroup() noexcept
     }
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 UndoCommandGroup::getApproxMemoryUsage() const noexcept
+{
+    qint64 size = sizeof(*this) + (getText().capacity() * sizeof(QChar));
+    size += mChilds.count() * sizeof(UndoCommand*);
+    foreach (const UndoCommand* cmd, mChilds) {
+        size += cmd->getApproxMemoryUsage();
+    }
+    return size;
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
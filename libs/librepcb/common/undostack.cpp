@@ -75,8 +75,11 @@ void UndoStackTransaction::commit()
  ****************************************************************************************/
 
 UndoStack::UndoStack() noexcept :
-    QObject(nullptr), mCurrentIndex(0), mCleanIndex(0), mActiveCommandGroup(nullptr)
+    QObject(nullptr), mMemoryUsage(0), mMaxDepth(0), mMaxMemoryUsage(0),
+    mMergeTimeWindow(1000), mClock(), mDefaultClock(), mLastCmdTime(-1), mCurrentIndex(0),
+    mCleanIndex(0), mActiveCommandGroup(nullptr)
 {
+    mDefaultClock.start();
 }
 
 UndoStack::~UndoStack() noexcept
@@ -137,6 +140,24 @@ void UndoStack::setClean() noexcept
     emit cleanChanged(true);
 }
 
+void UndoStack::setLimits(int maxDepth, qint64 maxMemoryUsage) noexcept
+{
+    mMaxDepth = qMax(maxDepth, 0);
+    mMaxMemoryUsage = qMax(maxMemoryUsage, qint64(0));
+    enforceLimits();
+}
+
+void UndoStack::setMergeTimeWindow(int milliseconds) noexcept
+{
+    mMergeTimeWindow = qMax(milliseconds, 0);
+}
+
+void UndoStack::setClock(const std::function<qint64()>& clock) noexcept
+{
+    mClock = clock;
+    mLastCmdTime = -1; // times of different clocks are not comparable
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -162,13 +183,40 @@ void UndoStack::execCmd(UndoCommand* cmd, bool forceKeepCmd)
         // delete all commands above the current index (make redoing them impossible)
         // --> in reverse order (from top to bottom)!
         while (mCurrentIndex < mCommands.count()) {
-            delete mCommands.takeLast();
+            deleteLastCommand();
         }
         Q_ASSERT(mCurrentIndex == mCommands.count());
 
-        // add command to the command stack
-        mCommands.append(cmdScopeGuard.take()); // move ownership of "cmd" to "mCommands"
-        mCurrentIndex++;
+        // try to merge the command into the previous one, but only if the previous
+        // command was executed just before and the clean state is not affected by the
+        // merge (otherwise it would no longer be reachable)
+        qint64 currentTime = getCurrentTime();
+        bool withinMergeTimeWindow = (mMergeTimeWindow > 0) && (mLastCmdTime >= 0) &&
+                                     (currentTime - mLastCmdTime <= mMergeTimeWindow);
+        if ((!forceKeepCmd) && canUndo() && (mCleanIndex != mCurrentIndex) &&
+            withinMergeTimeWindow && mCommands.last()->mergeWith(*cmd))
+        {
+            // the previous command now contains the changes of "cmd" too, so "cmd"
+            // will be deleted without undoing it
+            cmd = mCommands.last();
+            updateMemoryUsageOfLastCommand();
+        } else {
+            // add command to the command stack
+            mCommands.append(cmdScopeGuard.take()); // move ownership of "cmd" to "mCommands"
+            mCommandMemoryUsages.append(0);
+            updateMemoryUsageOfLastCommand();
+            mCurrentIndex++;
+        }
+
+        // command groups are never merged, so there's no need to measure the time
+        if (forceKeepCmd) {
+            mLastCmdTime = -1;
+        } else {
+            mLastCmdTime = currentTime;
+        }
+
+        // delete the oldest commands if the stack has become too big
+        enforceLimits();
 
         // emit signals
         emit undoTextChanged(QString(tr("Undo: %1")).arg(cmd->getText()));
@@ -235,6 +283,11 @@ void UndoStack::commitCmdGroup()
     // To finish the active command group, we only need to reset the pointer to the
     // currently active command group
     mActiveCommandGroup = nullptr;
+    mLastCmdTime = -1;
+
+    // now the size of the command group is known, so the limits can be checked
+    updateMemoryUsageOfLastCommand();
+    enforceLimits();
 
     // emit signals
     emit canUndoChanged(canUndo());
@@ -254,7 +307,8 @@ void UndoStack::abortCmdGroup()
         mActiveCommandGroup->undo(); // can throw (but should usually not)
         mActiveCommandGroup = nullptr;
         mCurrentIndex--;
-        delete mCommands.takeLast(); // delete and remove the aborted command group from the stack
+        deleteLastCommand(); // delete and remove the aborted command group from the stack
+        mLastCmdTime = -1;
     } catch (Exception& e) {
         qCritical() << "UndoCommand::undo() has thrown an exception:" << e.getMsg();
         throw;
@@ -279,6 +333,7 @@ void UndoStack::undo()
     try {
         mCommands[mCurrentIndex-1]->undo(); // can throw (but should usually not)
         mCurrentIndex--;
+        mLastCmdTime = -1;
     } catch (Exception& e) {
         qCritical() << "UndoCommand::undo() has thrown an exception:" << e.getMsg();
         throw;
@@ -302,6 +357,7 @@ void UndoStack::redo()
     try {
         mCommands[mCurrentIndex]->redo(); // can throw (but should usually not)
         mCurrentIndex++;
+        mLastCmdTime = -1;
     } catch (Exception& e) {
         qCritical() << "UndoCommand::redo() has thrown an exception:" << e.getMsg();
         throw;
@@ -332,12 +388,15 @@ void UndoStack::clear() noexcept
 
     // delete all commands in the stack from top to bottom (newest first, oldest last)!
     while (!mCommands.isEmpty()) {
-        delete mCommands.takeLast();
+        deleteLastCommand();
     }
+    Q_ASSERT(mCommandMemoryUsages.isEmpty());
+    mMemoryUsage = 0;
 
     mCurrentIndex = 0;
     mCleanIndex = 0;
     mActiveCommandGroup = nullptr;
+    mLastCmdTime = -1;
 
     // emit signals
     emit undoTextChanged(tr("Undo"));
@@ -347,6 +406,81 @@ void UndoStack::clear() noexcept
     emit cleanChanged(true);
 }
 
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void UndoStack::deleteLastCommand() noexcept
+{
+    Q_ASSERT(mCommandMemoryUsages.count() == mCommands.count());
+    mMemoryUsage -= mCommandMemoryUsages.takeLast();
+    delete mCommands.takeLast();
+}
+
+void UndoStack::updateMemoryUsageOfLastCommand() noexcept
+{
+    Q_ASSERT(mCommandMemoryUsages.count() == mCommands.count());
+    qint64 usage = mCommands.last()->getApproxMemoryUsage();
+    mMemoryUsage += usage - mCommandMemoryUsages.last();
+    mCommandMemoryUsages.last() = usage;
+}
+
+void UndoStack::enforceLimits() noexcept
+{
+    // First delete the oldest commands, but only those below the last executed command,
+    // so it's always possible to undo at least one step. The active command group (if
+    // any) is never deleted.
+    int minCount = isCommandGroupActive() ? 2 : 1;
+    bool cleanStateRemoved = false;
+    while ((mCurrentIndex > minCount) && isLimitExceeded()) {
+        // delete the oldest command (at the bottom of the stack)
+        mMemoryUsage -= mCommandMemoryUsages.takeFirst();
+        delete mCommands.takeFirst();
+        mCurrentIndex--;
+        if (mCleanIndex == 0) {
+            mCleanIndex = -1; // the clean state does no longer exist
+            cleanStateRemoved = true;
+        } else if (mCleanIndex > 0) {
+            mCleanIndex--;
+        }
+    }
+
+    // If this was not sufficient, delete the redoable commands from top to bottom
+    bool redoableCommandsRemoved = false;
+    while ((mCurrentIndex < mCommands.count()) && isLimitExceeded()) {
+        deleteLastCommand();
+        redoableCommandsRemoved = true;
+        if (mCleanIndex > mCommands.count()) {
+            mCleanIndex = -1; // the clean state does no longer exist
+            cleanStateRemoved = true;
+        }
+    }
+
+    if (redoableCommandsRemoved) {
+        emit redoTextChanged(getRedoText());
+        emit canRedoChanged(canRedo());
+    }
+    if (cleanStateRemoved) {
+        emit cleanChanged(isClean());
+    }
+}
+
+bool UndoStack::isLimitExceeded() const noexcept
+{
+    if ((mMaxDepth > 0) && (mCommands.count() > mMaxDepth)) {
+        return true;
+    }
+    if ((mMaxMemoryUsage > 0) && (mMemoryUsage > mMaxMemoryUsage)) {
+        return true;
+    }
+    return false;
+}
+
+qint64 UndoStack::getCurrentTime() const noexcept
+{
+    return mClock ? mClock() : mDefaultClock.elapsed();
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -24,6 +24,7 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <functional>
 #include "exceptions.h"
 
 /*****************************************************************************************
@@ -101,6 +102,15 @@ class UndoStackTransaction final
  *  - <b>Added support for exclusive macro command creation:</b> @todo Don't sure if this
  *    is a good way, we need some tests first... If the tests are successful, we should
  *    complete this documentation (explain how this feature works).
+ *  - <b>Memory and depth limits:</b> With #setLimits() the stack can be configured to
+ *    delete the oldest commands as soon as it contains too many commands or they need
+ *    too much memory (see UndoCommand#getApproxMemoryUsage()). So the memory
+ *    consumption does not grow endlessly during long editing sessions.
+ *  - <b>Merging of consecutive commands:</b> #execCmd() tries to merge the new command
+ *    into the previous one if both have the same merge ID (see
+ *    UndoCommand#getMergeId()) and the previous command was executed less than
+ *    #getMergeTimeWindow() milliseconds ago. Commands are never merged if this would
+ *    remove the clean state, or after an undo or redo.
  *
  * @see #UndoCommand, #UndoCommandGroup
  *
@@ -174,6 +184,44 @@ class UndoStack final : public QObject
          */
         bool isCommandGroupActive() const noexcept;
 
+        /**
+         * @brief Get the count of commands in the stack (including redoable commands)
+         *
+         * @return Count of commands
+         */
+        int getCommandCount() const noexcept {return mCommands.count();}
+
+        /**
+         * @brief Get the maximum count of commands (see #setLimits())
+         *
+         * @return Maximum count of commands (0 = unlimited)
+         */
+        int getMaxDepth() const noexcept {return mMaxDepth;}
+
+        /**
+         * @brief Get the maximum memory usage of all commands (see #setLimits())
+         *
+         * @return Maximum memory usage in bytes (0 = unlimited)
+         */
+        qint64 getMaxMemoryUsage() const noexcept {return mMaxMemoryUsage;}
+
+        /**
+         * @brief Get the approximate memory usage of all commands in the stack
+         *
+         * @return The sum of UndoCommand#getApproxMemoryUsage() of all commands [bytes]
+         *
+         * @note The memory usage of the currently active command group is only updated
+         *       when the group is committed.
+         */
+        qint64 getApproxMemoryUsage() const noexcept {return mMemoryUsage;}
+
+        /**
+         * @brief Get the time window for merging commands (see #setMergeTimeWindow())
+         *
+         * @return Time window in milliseconds
+         */
+        int getMergeTimeWindow() const noexcept {return mMergeTimeWindow;}
+
 
         // Setters
 
@@ -182,6 +230,45 @@ class UndoStack final : public QObject
          */
         void setClean() noexcept;
 
+        /**
+         * @brief Set the limits of the stack size
+         *
+         * If one of the limits is exceeded, commands are deleted until the stack fits
+         * into the limits again:
+         *  -# First the oldest commands (at the bottom of the stack) are deleted, but the
+         *     last executed command is never deleted, so it is always possible to undo at
+         *     least one step.
+         *  -# If this is not sufficient, the redoable commands (if any) are deleted, the
+         *     newest one first.
+         *
+         * If the clean state gets deleted, #isClean() will never return true until
+         * #setClean() is called again.
+         *
+         * @param maxDepth          Maximum count of commands (0 = unlimited)
+         * @param maxMemoryUsage    Maximum memory usage in bytes (0 = unlimited)
+         */
+        void setLimits(int maxDepth, qint64 maxMemoryUsage) noexcept;
+
+        /**
+         * @brief Set the time window for merging commands
+         *
+         * A command executed with #execCmd() is only merged into the previous command if
+         * the previous command was executed (or merged) at most this time ago.
+         *
+         * @param milliseconds  The time window in milliseconds (0 = never merge)
+         */
+        void setMergeTimeWindow(int milliseconds) noexcept;
+
+        /**
+         * @brief Set the clock used to check the time window for merging commands
+         *
+         * By default, a monotonic clock is used. This is mainly useful for unit tests.
+         *
+         * @param clock     Function returning the current time in milliseconds, or an
+         *                  empty function to use the default clock
+         */
+        void setClock(const std::function<qint64()>& clock) noexcept;
+
 
         // General Methods
 
@@ -292,6 +379,14 @@ class UndoStack final : public QObject
 
     private:
 
+        // Private Methods
+        void deleteLastCommand() noexcept;
+        void updateMemoryUsageOfLastCommand() noexcept;
+        void enforceLimits() noexcept;
+        bool isLimitExceeded() const noexcept;
+        qint64 getCurrentTime() const noexcept;
+
+
         /**
          * @brief This list holds all commands of the undo stack
          *
@@ -300,6 +395,50 @@ class UndoStack final : public QObject
          */
         QList<UndoCommand*> mCommands;
 
+        /**
+         * @brief The approximate memory usage of each command in #mCommands [bytes]
+         *
+         * This list always has the same size as #mCommands.
+         */
+        QList<qint64> mCommandMemoryUsages;
+
+        /**
+         * @brief The sum of all values in #mCommandMemoryUsages [bytes]
+         */
+        qint64 mMemoryUsage;
+
+        /**
+         * @brief The maximum count of commands in #mCommands (0 = unlimited)
+         */
+        int mMaxDepth;
+
+        /**
+         * @brief The maximum value of #mMemoryUsage (0 = unlimited)
+         */
+        qint64 mMaxMemoryUsage;
+
+        /**
+         * @brief The time window for merging commands [ms] (see #setMergeTimeWindow())
+         */
+        int mMergeTimeWindow;
+
+        /**
+         * @brief The clock set by #setClock() (empty = use #mDefaultClock)
+         */
+        std::function<qint64()> mClock;
+
+        /**
+         * @brief The default clock, started in the constructor
+         */
+        QElapsedTimer mDefaultClock;
+
+        /**
+         * @brief The time when the last command was executed or merged (-1 = invalid)
+         *
+         * Invalidated by undo/redo and command groups, so the next command is not merged.
+         */
+        qint64 mLastCmdTime;
+
         /**
          * @brief This attribute holds the current position in the undo stack #mCommands
          *
@@ -28,20 +28,84 @@
  ****************************************************************************************/
 namespace librepcb {
 
+/*****************************************************************************************
+ *  Local Helpers
+ ****************************************************************************************/
+
+// lookup table to convert ASCII characters to hex digit values (-1 = invalid character)
+struct UuidHexDigitTable final {
+    qint8 values[128];
+    UuidHexDigitTable() noexcept {
+        for (int i = 0; i < 128; ++i)   values[i] = -1;
+        for (int i = 0; i < 10; ++i)    values['0' + i] = i;
+        for (int i = 0; i < 6; ++i)     values['a' + i] = values['A' + i] = 10 + i;
+    }
+};
+
+static const char sHexChars[] = "0123456789abcdef";
+
+// indices of the 32 hex digits within the 36 characters long string representation
+static const int sDigitPositions[32] = {
+     0,  1,  2,  3,  4,  5,  6,  7,  9, 10, 11, 12, 14, 15, 16, 17,
+    19, 20, 21, 22, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+};
+
+// parse 16 hex digits, returns false on invalid characters
+static bool parseHexWord(const QChar* str, const int* positions, quint64& value) noexcept
+{
+    static const UuidHexDigitTable table; // thread-safe initialization
+    value = 0;
+    for (int i = 0; i < 16; ++i) {
+        ushort c = str[positions[i]].unicode();
+        int digit = (c < 128) ? table.values[c] : -1;
+        if (digit < 0) return false;
+        value = (value << 4) | static_cast<quint64>(digit);
+    }
+    return true;
+}
+
+// write 16 hex digits into the string
+static void formatHexWord(quint64 value, QChar* str, const int* positions) noexcept
+{
+    for (int i = 15; i >= 0; --i) {
+        str[positions[i]] = QLatin1Char(sHexChars[value & 0xF]);
+        value >>= 4;
+    }
+}
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+QString Uuid::toStr() const noexcept
+{
+    if (isNull()) return QString();
+    QString str(36, QLatin1Char('-'));
+    QChar* data = str.data();
+    formatHexWord(mHigh, data, &sDigitPositions[0]);
+    formatHexWord(mLow, data, &sDigitPositions[16]);
+    return str;
+}
+
 /*****************************************************************************************
  *  Setters
  ****************************************************************************************/
 
 bool Uuid::setUuid(const QString& uuid) noexcept
 {
-    mUuid = QString(); // make UUID invalid
-    QString lowercaseUuid = uuid.toLower();
-    if (lowercaseUuid.length() != 36)       return false; // do NOT accept '{' and '}'
-    QUuid quuid(lowercaseUuid);
-    if (quuid.isNull())                     return false;
-    if (quuid.variant() != QUuid::DCE)      return false;
-    if (quuid.version() != QUuid::Random)   return false;
-    mUuid = lowercaseUuid;
+    mHigh = mLow = 0; // make UUID invalid
+    if (uuid.length() != 36) return false; // do NOT accept '{' and '}'
+    const QChar* data = uuid.constData();
+    if ((data[8] != '-') || (data[13] != '-') || (data[18] != '-') || (data[23] != '-')) {
+        return false;
+    }
+    quint64 high, low;
+    if (!parseHexWord(data, &sDigitPositions[0], high))     return false;
+    if (!parseHexWord(data, &sDigitPositions[16], low))     return false;
+    if (((high >> 12) & 0xF) != 4)                          return false; // version 4
+    if ((low >> 62) != 0x2)                                 return false; // variant DCE
+    mHigh = high;
+    mLow = low;
     return true;
 }
 
@@ -51,14 +115,15 @@ bool Uuid::setUuid(const QString& uuid) noexcept
 
 Uuid& Uuid::operator=(const Uuid& rhs) noexcept
 {
-    mUuid = rhs.mUuid;
+    mHigh = rhs.mHigh;
+    mLow = rhs.mLow;
     return *this;
 }
 
 bool Uuid::operator==(const Uuid& rhs) const noexcept
 {
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid == rhs.mUuid);
+    if (isNull() || rhs.isNull()) return false;
+    return (mHigh == rhs.mHigh) && (mLow == rhs.mLow);
 }
 
 bool Uuid::operator!=(const Uuid& rhs) const noexcept
@@ -68,26 +133,27 @@ bool Uuid::operator!=(const Uuid& rhs) const noexcept
 
 bool Uuid::operator<(const Uuid& rhs) const noexcept
 {
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid < rhs.mUuid);
+    // comparing the integers gives the same order as comparing the (lowercase) strings
+    if (isNull() || rhs.isNull()) return false;
+    return (mHigh < rhs.mHigh) || ((mHigh == rhs.mHigh) && (mLow < rhs.mLow));
 }
 
 bool Uuid::operator>(const Uuid& rhs) const noexcept
 {
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid > rhs.mUuid);
+    if (isNull() || rhs.isNull()) return false;
+    return rhs < *this;
 }
 
 bool Uuid::operator<=(const Uuid& rhs) const noexcept
 {
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid <= rhs.mUuid);
+    if (isNull() || rhs.isNull()) return false;
+    return !(rhs < *this);
 }
 
 bool Uuid::operator>=(const Uuid& rhs) const noexcept
 {
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid >= rhs.mUuid);
+    if (isNull() || rhs.isNull()) return false;
+    return !(*this < rhs);
 }
 
 /*****************************************************************************************
@@ -96,9 +162,15 @@ bool Uuid::operator>=(const Uuid& rhs) const noexcept
 
 Uuid Uuid::createRandom() noexcept
 {
-    Uuid uuid(QUuid::createUuid().toString().remove("{").remove("}"));
-    if (uuid.isNull()) {
+    QByteArray bytes = QUuid::createUuid().toRfc4122(); // 16 bytes, big endian
+    Uuid uuid;
+    for (int i = 0; i < 8; ++i) {
+        uuid.mHigh = (uuid.mHigh << 8) | static_cast<quint8>(bytes.at(i));
+        uuid.mLow = (uuid.mLow << 8) | static_cast<quint8>(bytes.at(i + 8));
+    }
+    if ((((uuid.mHigh >> 12) & 0xF) != 4) || ((uuid.mLow >> 62) != 0x2)) {
         qCritical() << "Could not generate a valid random UUID!";
+        uuid = Uuid();
     }
     return uuid;
 }
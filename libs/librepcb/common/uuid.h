@@ -44,6 +44,10 @@ namespace librepcb {
  *
  * A valid UUID looks like this: "d79d354b-62bd-4866-996a-78941c575e78"
  *
+ * Internally the UUID is stored as two 64-bit integers (instead of a string) to keep the
+ * memory footprint small and to make comparisons and hashing cheap. The string
+ * representation is only created on demand by #toStr().
+ *
  * @see https://de.wikipedia.org/wiki/Universally_Unique_Identifier
  * @see https://tools.ietf.org/html/rfc4122
  *
@@ -61,21 +65,21 @@ class Uuid final
         /**
          * @brief Default constructor (creates a NULL #Uuid object)
          */
-        Uuid() noexcept : mUuid() {}
+        Uuid() noexcept : mHigh(0), mLow(0) {}
 
         /**
          * @brief Constructor which creates a #Uuid object from a string
          *
          * @param uuid      The uuid as a string (without braces)
          */
-        explicit Uuid(const QString& uuid) noexcept : mUuid() {setUuid(uuid);}
+        explicit Uuid(const QString& uuid) noexcept : mHigh(0), mLow(0) {setUuid(uuid);}
 
         /**
          * @brief Copy constructor
          *
          * @param other     Another #Uuid object
          */
-        Uuid(const Uuid& other) noexcept : mUuid(other.mUuid) {}
+        Uuid(const Uuid& other) noexcept : mHigh(other.mHigh), mLow(other.mLow) {}
 
         /**
          * @brief Destructor
@@ -90,14 +94,14 @@ class Uuid final
          *
          * @return true if NULL/invalid UUID, false if valid UUID
          */
-        bool isNull() const noexcept {return mUuid.isEmpty();}
+        bool isNull() const noexcept {return (mHigh == 0) && (mLow == 0);}
 
         /**
          * @brief Get the UUID as a string (without braces)
          *
          * @return The UUID as a string
          */
-        QString toStr() const noexcept {return mUuid;}
+        QString toStr() const noexcept;
 
         /**
          * @brief Serialize this object into a string
@@ -170,8 +174,12 @@ class Uuid final
 
     private:
 
+        // Private Methods
+        friend uint qHash(const Uuid& key, uint seed) noexcept;
+
         // Private Attributes
-        QString mUuid;
+        quint64 mHigh;  ///< the first 16 hex digits (most significant first), 0 if NULL
+        quint64 mLow;   ///< the last 16 hex digits (most significant first), 0 if NULL
 };
 
 /*****************************************************************************************
@@ -189,7 +197,8 @@ inline QDebug operator<<(QDebug stream, const Uuid& uuid) noexcept {
 }
 
 inline uint qHash(const Uuid& key, uint seed) noexcept {
-    return ::qHash(key.toStr(), seed);
+    // random UUIDs are uniformly distributed, so simply folding the bits is good enough
+    return ::qHash(key.mHigh ^ key.mLow, seed);
 }
 
 /*****************************************************************************************
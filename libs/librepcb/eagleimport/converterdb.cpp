@@ -36,10 +36,15 @@ namespace eagleimport {
 ConverterDb::ConverterDb(const FilePath& ini) noexcept :
     mIniFile(ini.toStr(), QSettings::IniFormat)
 {
+    foreach (const QString& key, mIniFile.allKeys()) {
+        QString value = mIniFile.value(key).toString();
+        if (!value.isEmpty()) mUuids.insert(key, Uuid(value));
+    }
 }
 
 ConverterDb::~ConverterDb() noexcept
 {
+    flush();
 }
 
 /*****************************************************************************************
@@ -99,6 +104,20 @@ Uuid ConverterDb::getDeviceUuid(const QString& deviceSetName, const QString& dev
     return getOrCreateUuid("devices_to_devices", deviceSetName, deviceName);
 }
 
+void ConverterDb::flush() noexcept
+{
+    QMutexLocker locker(&mMutex);
+    if (mNewKeys.isEmpty()) return;
+    foreach (const QString& key, mNewKeys) {
+        mIniFile.setValue(key, mUuids.value(key).toStr());
+    }
+    mIniFile.sync();
+    if (mIniFile.status() != QSettings::NoError) {
+        qCritical() << "Could not write the UUID list:" << mIniFile.fileName();
+    }
+    mNewKeys.clear();
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
@@ -119,14 +138,17 @@ Uuid ConverterDb::getOrCreateUuid(const QString& cat, const QString& key1,
     }
     settingsKey.prepend(cat % '/');
 
-    Uuid uuid = Uuid::createRandom();
-    QString value = mIniFile.value(settingsKey).toString();
-    if (!value.isEmpty()) uuid = Uuid(value); //Uuid(QString("{%1}").arg(value));
-
-    if (uuid.isNull()) {
-        throw RuntimeError(__FILE__, __LINE__, "Invalid UUID in *.ini file: " % settingsKey);
+    QMutexLocker locker(&mMutex);
+    auto it = mUuids.constFind(settingsKey);
+    if (it != mUuids.constEnd()) {
+        if (it.value().isNull()) {
+            throw RuntimeError(__FILE__, __LINE__, "Invalid UUID in *.ini file: " % settingsKey);
+        }
+        return it.value();
     }
-    mIniFile.setValue(settingsKey, uuid.toStr());
+    Uuid uuid = Uuid::createRandom();
+    mUuids.insert(settingsKey, uuid);
+    mNewKeys.append(settingsKey);
     return uuid;
 }
 
@@ -42,6 +42,15 @@ namespace eagleimport {
 
 /**
  * @brief The ConverterDb class
+ *
+ * Maps names of Eagle elements to UUIDs of LibrePCB elements, so that converting the
+ * same Eagle library again leads to the same UUIDs. The mappings are loaded from an
+ * INI file once at construction and kept in memory, newly created UUIDs are only
+ * written back to the file by #flush() (or by the destructor).
+ *
+ * All `get*Uuid()` methods are thread-safe, so multiple elements of the same library
+ * can be converted in parallel. But #setCurrentLibraryFilePath() must not be called
+ * while conversions are running.
  */
 class ConverterDb final
 {
@@ -68,6 +77,11 @@ class ConverterDb final
         Uuid getSymbolVariantItemUuid(const Uuid& componentUuid, const QString& gateName);
         Uuid getDeviceUuid(const QString& deviceSetName, const QString& deviceName);
 
+        /**
+         * @brief Write all newly created UUIDs to the INI file
+         */
+        void flush() noexcept;
+
 
         // Operator Overloadings
         ConverterDb& operator=(const ConverterDb& rhs) = delete;
@@ -79,6 +93,9 @@ class ConverterDb final
 
         QSettings mIniFile;
         FilePath mLibFilePath;
+        QHash<QString, Uuid> mUuids;    ///< all known UUIDs, key as used in the INI file
+        QStringList mNewKeys;           ///< keys not yet written to the INI file
+        QMutex mMutex;                  ///< protects #mUuids and #mNewKeys
 };
 
 /*****************************************************************************************
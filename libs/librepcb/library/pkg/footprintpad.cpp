@@ -85,6 +85,16 @@ QString FootprintPad::getLayerName() const noexcept
     }
 }
 
+GraphicsLayer::Id FootprintPad::getLayerId() const noexcept
+{
+    switch (mBoardSide) {
+        case BoardSide::TOP:        return GraphicsLayer::Id::TopCopper;
+        case BoardSide::BOTTOM:     return GraphicsLayer::Id::BotCopper;
+        case BoardSide::THT:        return GraphicsLayer::Id::BoardPadsTht;
+        default: Q_ASSERT(false);   return GraphicsLayer::Id::Unknown;
+    }
+}
+
 bool FootprintPad::isOnLayer(const QString& name) const noexcept
 {
     if (mBoardSide == BoardSide::THT) {
@@ -94,6 +104,15 @@ bool FootprintPad::isOnLayer(const QString& name) const noexcept
     }
 }
 
+bool FootprintPad::isOnLayer(GraphicsLayer::Id id) const noexcept
+{
+    if (mBoardSide == BoardSide::THT) {
+        return GraphicsLayer::isCopperLayer(id);
+    } else {
+        return (id == getLayerId());
+    }
+}
+
 Path FootprintPad::getOutline(const Length& expansion) const noexcept
 {
     Length width = mWidth + (expansion * 2);
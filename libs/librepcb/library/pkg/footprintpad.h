@@ -31,6 +31,7 @@
 #include <librepcb/common/fileio/cmd/cmdlistelementsswap.h>
 #include <librepcb/common/units/all_length_units.h>
 #include <librepcb/common/geometry/path.h>
+#include <librepcb/common/graphics/graphicslayer.h>
 #include <librepcb/common/uuid.h>
 
 /*****************************************************************************************
@@ -78,7 +79,9 @@ class FootprintPad final : public SerializableObject
         const Length& getDrillDiameter() const noexcept {return mDrillDiameter;}
         BoardSide getBoardSide() const noexcept {return mBoardSide;}
         QString getLayerName() const noexcept;
+        GraphicsLayer::Id getLayerId() const noexcept;
         bool isOnLayer(const QString& name) const noexcept;
+        bool isOnLayer(GraphicsLayer::Id id) const noexcept;
         Path getOutline(const Length& expansion = Length(0)) const noexcept;
         QPainterPath toQPainterPathPx(const Length& expansion = Length(0)) const noexcept;
 
@@ -78,6 +78,8 @@ class LibraryEditor final : public QMainWindow, public IF_GraphicsLayerProvider
         LibraryEditor(workspace::Workspace& ws, QSharedPointer<Library> lib);
         ~LibraryEditor() noexcept;
 
+        using IF_GraphicsLayerProvider::getLayer;
+
         /**
          * @copydoc librepcb::IF_GraphicsLayerProvider::getLayer()
          */
@@ -149,7 +149,20 @@ void LibraryDownload::downloadSucceeded() noexcept
 
     // move downloaded directory to destination
     try {
-        FileUtils::move(libDir, mDestDir); // can throw
+        try {
+            FileUtils::move(libDir, mDestDir); // can throw
+        } catch (const Exception& e) {
+            // renaming is not always possible (e.g. on Windows if a file is still opened
+            // by a virus scanner), so copy all files instead
+            qWarning() << "Could not move library, copying it instead:" << e.getMsg();
+            if (mDestDir.isExistingDir()) FileUtils::removeDirRecursively(mDestDir); // can throw
+            emit progressState(tr("Copy files..."));
+            FileUtils::copyDirRecursively(libDir, mDestDir,
+                [this](qint64 copiedBytes, qint64 totalBytes){
+                    emit progressPercent((totalBytes > 0) ?
+                        static_cast<int>((100 * copiedBytes) / totalBytes) : 100);
+                }); // can throw
+        }
     } catch (const Exception& e) {
         try {
             FileUtils::removeDirRecursively(mDestDir);
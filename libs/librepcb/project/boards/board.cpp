@@ -36,6 +36,7 @@
 #include <librepcb/common/gridproperties.h>
 #include "../circuit/circuit.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
 #include "../circuit/componentinstance.h"
 #include "items/bi_device.h"
 #include "items/bi_footprint.h"
@@ -48,6 +49,7 @@
 #include "items/bi_stroketext.h"
 #include "items/bi_hole.h"
 #include "items/bi_plane.h"
+#include "items/bi_airwire.h"
 #include <librepcb/library/cmp/component.h>
 #include <librepcb/library/pkg/footprint.h>
 #include "items/bi_polygon.h"
@@ -55,6 +57,7 @@
 #include "boardfabricationoutputsettings.h"
 #include "boardusersettings.h"
 #include "boardselectionquery.h"
+#include "boardairwiresbuilder.h"
 #include "../circuit/netsignal.h"
 
 /*****************************************************************************************
@@ -69,12 +72,11 @@ namespace project {
 
 Board::Board(const Board& other, const FilePath& filepath, const QString& name) :
     QObject(&other.getProject()), mProject(other.getProject()), mFilePath(filepath),
-    mIsAddedToProject(false)
+    mIsAddedToProject(false), mPreparedGraphicsItemsCount(0),
+    mAllGraphicsItemsPrepared(false)
 {
     try
     {
-        mGraphicsScene.reset(new GraphicsScene());
-
         // copy the other board
         mFile.reset(SmartSExprFile::create(mFilePath));
 
@@ -141,13 +143,17 @@ Board::Board(const Board& other, const FilePath& filepath, const QString& name)
 
         // rebuildAllPlanes(); --> fragments are copied too, so no need to rebuild them
         updateErcMessages();
-        updateIcon();
 
         // emit the "attributesChanged" signal when the project has emited it
         connect(&mProject, &Project::attributesChanged, this, &Board::attributesChanged);
 
-        connect(&mProject.getCircuit(), &Circuit::componentAdded, this, &Board::updateErcMessages);
-        connect(&mProject.getCircuit(), &Circuit::componentRemoved, this, &Board::updateErcMessages);
+        connect(&mProject.getCircuit(), &Circuit::componentAdded, this, &Board::scheduleErcMessagesUpdate);
+        connect(&mProject.getCircuit(), &Circuit::componentRemoved, this, &Board::scheduleErcMessagesUpdate);
+
+        // rebuild the scheduled airwires as soon as the event loop is idle
+        mAirWiresRebuildTimer.setSingleShot(true);
+        connect(&mAirWiresRebuildTimer, &QTimer::timeout, this, &Board::triggerAirWiresRebuild);
+        connect(&mProject.getCircuit(), &Circuit::netSignalRemoved, this, &Board::removeAirWires);
 
         if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
     }
@@ -173,13 +179,13 @@ Board::Board(const Board& other, const FilePath& filepath, const QString& name)
 }
 
 Board::Board(Project& project, const FilePath& filepath, bool restore,
-             bool readOnly, bool create, const QString& newName) :
-    QObject(&project), mProject(project), mFilePath(filepath), mIsAddedToProject(false)
+             bool readOnly, bool create, const QString& newName,
+             const SExpression* parsedRoot, const QByteArray& parsedContent) :
+    QObject(&project), mProject(project), mFilePath(filepath), mIsAddedToProject(false),
+    mPreparedGraphicsItemsCount(0), mAllGraphicsItemsPrepared(false)
 {
     try
     {
-        mGraphicsScene.reset(new GraphicsScene());
-
         // try to open/create the board file
         if (create)
         {
@@ -213,7 +219,15 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
         else
         {
             mFile.reset(new SmartSExprFile(mFilePath, restore, readOnly));
-            SExpression root = mFile->parseFileAndBuildDomTree();
+            SExpression parsedFile;
+            if (parsedRoot) {
+                // parsed in advance, but this file object needs to know the content too
+                mFile->setOpenedFileContent(parsedContent);
+            } else {
+                parsedFile = mFile->parseFileAndBuildDomTree();
+                parsedRoot = &parsedFile;
+            }
+            const SExpression& root = *parsedRoot;
 
             // the board seems to be ready to open, so we will create all needed objects
 
@@ -315,13 +329,17 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
 
         rebuildAllPlanes();
         updateErcMessages();
-        updateIcon();
 
         // emit the "attributesChanged" signal when the project has emited it
         connect(&mProject, &Project::attributesChanged, this, &Board::attributesChanged);
 
-        connect(&mProject.getCircuit(), &Circuit::componentAdded, this, &Board::updateErcMessages);
-        connect(&mProject.getCircuit(), &Circuit::componentRemoved, this, &Board::updateErcMessages);
+        connect(&mProject.getCircuit(), &Circuit::componentAdded, this, &Board::scheduleErcMessagesUpdate);
+        connect(&mProject.getCircuit(), &Circuit::componentRemoved, this, &Board::scheduleErcMessagesUpdate);
+
+        // rebuild the scheduled airwires as soon as the event loop is idle
+        mAirWiresRebuildTimer.setSingleShot(true);
+        connect(&mAirWiresRebuildTimer, &QTimer::timeout, this, &Board::triggerAirWiresRebuild);
+        connect(&mProject.getCircuit(), &Circuit::netSignalRemoved, this, &Board::removeAirWires);
 
         if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
     }
@@ -349,6 +367,7 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
 Board::~Board() noexcept
 {
     Q_ASSERT(!mIsAddedToProject);
+    mProject.getErcMsgList().unscheduleUpdate(*this);
 
     qDeleteAll(mErcMsgListUnplacedComponentInstances);    mErcMsgListUnplacedComponentInstances.clear();
 
@@ -528,6 +547,18 @@ QList<BI_Base*> Board::getAllItems() const noexcept
     return items;
 }
 
+/*****************************************************************************************
+ *  Getters: Attributes
+ ****************************************************************************************/
+
+const QIcon& Board::getIcon() noexcept
+{
+    if (mIcon.isNull()) {
+        updateIcon(); // rendering the icon requires the graphics items
+    }
+    return mIcon;
+}
+
 /*****************************************************************************************
  *  Setters: General
  ****************************************************************************************/
@@ -560,7 +591,7 @@ void Board::addDeviceInstance(BI_Device& instance)
     // add to board
     instance.addToBoard(); // can throw
     mDeviceInstances.insert(instance.getComponentInstanceUuid(), &instance);
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
     emit deviceAdded(instance);
 }
 
@@ -572,7 +603,7 @@ void Board::removeDeviceInstance(BI_Device& instance)
     // remove from board
     instance.removeFromBoard(); // can throw
     mDeviceInstances.remove(instance.getComponentInstanceUuid());
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
     emit deviceRemoved(instance);
 }
 
@@ -652,6 +683,34 @@ void Board::rebuildAllPlanes() noexcept
     }
 }
 
+/*****************************************************************************************
+ *  AirWire Methods
+ ****************************************************************************************/
+
+void Board::scheduleAirWiresRebuild(const NetSignal* netsignal) noexcept
+{
+    if (netsignal) {
+        mScheduledNetSignalsForAirWireRebuild.insert(netsignal);
+    } else {
+        foreach (const NetSignal* signal, mProject.getCircuit().getNetSignals()) {
+            mScheduledNetSignalsForAirWireRebuild.insert(signal);
+        }
+    }
+    if (!mAirWiresRebuildTimer.isActive()) {
+        mAirWiresRebuildTimer.start(0);
+    }
+}
+
+void Board::triggerAirWiresRebuild() noexcept
+{
+    mAirWiresRebuildTimer.stop();
+    QSet<const NetSignal*> netsignals = mScheduledNetSignalsForAirWireRebuild;
+    mScheduledNetSignalsForAirWireRebuild.clear();
+    foreach (const NetSignal* netsignal, netsignals) {
+        rebuildAirWires(*netsignal);
+    }
+}
+
 /*****************************************************************************************
  *  Polygon Methods
  ****************************************************************************************/
@@ -741,7 +800,8 @@ void Board::addToProject()
         sgl.add([item](){item->removeFromBoard();});
     }
     mIsAddedToProject = true;
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
+    scheduleAirWiresRebuild(nullptr);
     sgl.dismiss();
 }
 
@@ -758,7 +818,12 @@ void Board::removeFromProject()
         sgl.add([item](){item->addToBoard();});
     }
     mIsAddedToProject = false;
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
+    mAirWiresRebuildTimer.stop();
+    mScheduledNetSignalsForAirWireRebuild.clear();
+    foreach (const NetSignal* netsignal, mAirWires.keys()) {
+        removeAirWires(*netsignal);
+    }
     sgl.dismiss();
 }
 
@@ -766,18 +831,10 @@ bool Board::save(bool toOriginal, QStringList& errors) noexcept
 {
     bool success = true;
 
-    // save board file
+    // save board file and user settings
     try
     {
-        if (mIsAddedToProject)
-        {
-            SExpression doc(serializeToDomElement("librepcb_board"));
-            mFile->save(doc, toOriginal);
-        }
-        else
-        {
-            mFile->removeFile(toOriginal);
-        }
+        prepareSave(toOriginal)(); // can throw
     }
     catch (Exception& e)
     {
@@ -785,22 +842,85 @@ bool Board::save(bool toOriginal, QStringList& errors) noexcept
         errors.append(e.getMsg());
     }
 
-    // save user settings
-    if (!mUserSettings->save(toOriginal, errors)) {
-        success = false;
+    return success;
+}
+
+std::function<void()> Board::prepareSave(bool toOriginal)
+{
+    // save user settings (errors are reported after writing the board file)
+    QStringList errors;
+    mUserSettings->save(toOriginal, errors);
+    auto throwErrors = [errors](){
+        if (!errors.isEmpty()) throw RuntimeError(__FILE__, __LINE__, errors.join("\n"));
+    };
+
+    SmartSExprFile* file = mFile.data();
+    if (mIsAddedToProject) {
+        SExpression doc(serializeToDomElement("librepcb_board")); // can throw
+        return [file, doc, toOriginal, throwErrors](){
+            file->save(doc, toOriginal); // can throw
+            throwErrors(); // can throw
+        };
+    } else {
+        return [file, toOriginal, throwErrors](){
+            file->removeFile(toOriginal); // can throw
+            throwErrors(); // can throw
+        };
     }
+}
 
-    return success;
+bool Board::prepareGraphicsItems(int maxDurationMs) noexcept
+{
+    if (mAllGraphicsItemsPrepared) {
+        return true;
+    }
+    QElapsedTimer timer;
+    timer.start();
+    if (!mGraphicsScene) {
+        mGraphicsScene.reset(new GraphicsScene());
+    }
+
+    // Items added from now on create their graphics items on their own. If items were
+    // removed since the last call, some items may be skipped here, but the loop over
+    // all items below creates them as well (createGraphicsItems() does nothing if the
+    // graphics items exist already).
+    QList<BI_Base*> items = getAllItems();
+    while (mPreparedGraphicsItemsCount < items.count()) {
+        items.at(mPreparedGraphicsItemsCount++)->createGraphicsItems();
+        if ((maxDurationMs >= 0) && (timer.elapsed() >= maxDurationMs) &&
+            (mPreparedGraphicsItemsCount < items.count()))
+        {
+            return false; // continue on the next call
+        }
+    }
+    foreach (BI_Base* item, items) {
+        item->createGraphicsItems();
+    }
+    foreach (const QList<BI_AirWire*>& airwires, mAirWires) {
+        foreach (BI_AirWire* airwire, airwires) {
+            airwire->createGraphicsItems();
+        }
+    }
+    mAllGraphicsItemsPrepared = true;
+    return true;
+}
+
+void Board::initGraphicsScene() noexcept
+{
+    prepareGraphicsItems(-1);
 }
 
 void Board::showInView(GraphicsView& view) noexcept
 {
+    initGraphicsScene();
     view.setScene(mGraphicsScene.data());
 }
 
 void Board::setSelectionRect(const Point& p1, const Point& p2, bool updateItems) noexcept
 {
-    mGraphicsScene->setSelectionRect(p1, p2);
+    if (mGraphicsScene) {
+        mGraphicsScene->setSelectionRect(p1, p2);
+    }
     if (updateItems) {
         QRectF rectPx = QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized();
         foreach (BI_Device* component, mDeviceInstances) {
@@ -890,6 +1010,7 @@ QVector<const AttributeProvider*> Board::getAttributeProviderParents() const noe
 
 void Board::updateIcon() noexcept
 {
+    initGraphicsScene();
     QRectF source = mGraphicsScene->itemsBoundingRect().adjusted(-20, -20, 20, 20);
     QRect target(0, 0, 297, 210); // DIN A4 format :-)
 
@@ -933,6 +1054,11 @@ void Board::serialize(SExpression& root) const
     root.appendLineBreak();
 }
 
+void Board::scheduleErcMessagesUpdate() noexcept
+{
+    mProject.getErcMsgList().scheduleUpdate(*this);
+}
+
 void Board::updateErcMessages() noexcept
 {
     // type: UnplacedComponent (ComponentInstances without DeviceInstance)
@@ -969,13 +1095,53 @@ void Board::updateErcMessages() noexcept
     }
 }
 
+void Board::rebuildAirWires(const NetSignal& netsignal) noexcept
+{
+    if (!mIsAddedToProject) {
+        return;
+    }
+
+    QVector<QPair<Point, Point>> points = BoardAirWiresBuilder(*this, netsignal).buildAirWires();
+    if (points.isEmpty()) {
+        removeAirWires(netsignal);
+        return;
+    }
+
+    // reuse the existing airwires to avoid recreating all their graphics items
+    QList<BI_AirWire*>& airwires = mAirWires[&netsignal];
+    while (airwires.count() > points.count()) {
+        BI_AirWire* airwire = airwires.takeLast();
+        airwire->removeFromBoard(); // only throws if not added to board
+        delete airwire;
+    }
+    for (int i = 0; i < points.count(); ++i) {
+        if (i < airwires.count()) {
+            airwires.at(i)->setPoints(points.at(i).first, points.at(i).second);
+        } else {
+            BI_AirWire* airwire = new BI_AirWire(*this, netsignal, points.at(i).first,
+                                                 points.at(i).second);
+            airwire->addToBoard(); // only throws if already added to board
+            airwires.append(airwire);
+        }
+    }
+}
+
+void Board::removeAirWires(const NetSignal& netsignal) noexcept
+{
+    mScheduledNetSignalsForAirWireRebuild.remove(&netsignal);
+    foreach (BI_AirWire* airwire, mAirWires.take(&netsignal)) {
+        airwire->removeFromBoard(); // only throws if not added to board
+        delete airwire;
+    }
+}
+
 /*****************************************************************************************
  *  Static Methods
  ****************************************************************************************/
 
 Board* Board::create(Project& project, const FilePath& filepath, const QString& name)
 {
-    return new Board(project, filepath, false, false, true, name);
+    return new Board(project, filepath, false, false, true, name, nullptr, QByteArray());
 }
 
 /*****************************************************************************************
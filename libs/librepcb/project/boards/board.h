@@ -24,6 +24,7 @@
  *  Includes
  ****************************************************************************************/
 #include <memory>
+#include <functional>
 #include <QtCore>
 #include <QtWidgets>
 #include <librepcb/common/attributes/attributeprovider.h>
@@ -61,6 +62,7 @@ class BI_Polygon;
 class BI_StrokeText;
 class BI_Hole;
 class BI_Plane;
+class BI_AirWire;
 class BoardLayerStack;
 class BoardFabricationOutputSettings;
 class BoardUserSettings;
@@ -104,6 +106,7 @@ class Board final : public QObject, public AttributeProvider,
             ZValue_TextsTop,            ///< Z value for librepcb::project::BI_StrokeText items
             ZValue_Vias,                ///< Z value for librepcb::project::BI_Via items
             ZValue_Texts,               ///< Z value for librepcb::project::BI_StrokeText items
+            ZValue_AirWires,            ///< Z value for librepcb::project::BI_AirWire items
         };
 
         // Constructors / Destructor
@@ -111,13 +114,18 @@ class Board final : public QObject, public AttributeProvider,
         Board(const Board& other) = delete;
         Board(const Board& other, const FilePath& filepath, const QString& name);
         Board(Project& project, const FilePath& filepath, bool restore, bool readOnly) :
-            Board(project, filepath, restore, readOnly, false, QString()) {}
+            Board(project, filepath, restore, readOnly, false, QString(), nullptr,
+                  QByteArray()) {}
+        Board(Project& project, const FilePath& filepath, bool restore, bool readOnly,
+              const SExpression& root, const QByteArray& content) :
+            Board(project, filepath, restore, readOnly, false, QString(), &root, content) {}
         ~Board() noexcept;
 
         // Getters: General
         Project& getProject() const noexcept {return mProject;}
         const FilePath& getFilePath() const noexcept {return mFilePath;}
         const GridProperties& getGridProperties() const noexcept {return *mGridProperties;}
+        bool hasGraphicsScene() const noexcept {return !mGraphicsScene.isNull();}
         GraphicsScene& getGraphicsScene () const noexcept {return *mGraphicsScene;}
         BoardLayerStack& getLayerStack() noexcept {return *mLayerStack;}
         const BoardLayerStack& getLayerStack() const noexcept {return *mLayerStack;}
@@ -142,7 +150,7 @@ class Board final : public QObject, public AttributeProvider,
         // Getters: Attributes
         const Uuid& getUuid() const noexcept {return mUuid;}
         const QString& getName() const noexcept {return mName;}
-        const QIcon& getIcon() const noexcept {return mIcon;}
+        const QIcon& getIcon() noexcept;
         const QString& getDefaultFontName() const noexcept {return mDefaultFontFileName;}
 
         // DeviceInstance Methods
@@ -163,6 +171,25 @@ class Board final : public QObject, public AttributeProvider,
         void removePlane(BI_Plane& plane);
         void rebuildAllPlanes() noexcept;
 
+        // AirWire Methods
+
+        /**
+         * @brief Schedule a rebuild of the airwires of a net signal
+         *
+         * The airwires are rebuilt as soon as the event loop is idle again (see
+         * #triggerAirWiresRebuild()). Thus many modifications in a row (e.g. moving a
+         * device with many pads) rebuild the airwires of each net signal only once.
+         *
+         * @param netsignal     The net signal to rebuild the airwires of, or nullptr
+         *                      to rebuild the airwires of all net signals
+         */
+        void scheduleAirWiresRebuild(const NetSignal* netsignal) noexcept;
+
+        /**
+         * @brief Immediately rebuild all airwires scheduled by #scheduleAirWiresRebuild()
+         */
+        void triggerAirWiresRebuild() noexcept;
+
         // Polygon Methods
         const QList<BI_Polygon*>& getPolygons() const noexcept {return mPolygons;}
         void addPolygon(BI_Polygon& polygon);
@@ -182,6 +209,46 @@ class Board final : public QObject, public AttributeProvider,
         void addToProject();
         void removeFromProject();
         bool save(bool toOriginal, QStringList& errors) noexcept;
+        /**
+         * @brief Serialize the board and return a function which writes it to the file
+         *
+         * This allows to serialize the board in the main thread, but to write the file
+         * (which is much slower) in a worker thread. The (small) user settings
+         * file is written immediately.
+         *
+         * @param toOriginal    See #save()
+         *
+         * @return A function which writes the file (and throws on error)
+         *
+         * @throw Exception on error
+         */
+        std::function<void()> prepareSave(bool toOriginal);
+
+        /**
+         * @brief Create the graphics items step by step (e.g. while the GUI is idle)
+         *
+         * Creates the graphics scene (if not done yet) and then the graphics items of
+         * the board items until the given time is elapsed. Call this method again
+         * until it returns true to prepare the whole board without blocking the event
+         * loop for a long time. Showing or rendering the board creates all remaining
+         * graphics items immediately.
+         *
+         * @param maxDurationMs     Time after which no more items are prepared [ms]
+         *                          (-1 = unlimited)
+         *
+         * @return True if all graphics items are created, false if not
+         */
+        bool prepareGraphicsItems(int maxDurationMs) noexcept;
+
+        /**
+         * @brief Show the board in a graphics view
+         *
+         * On the first call, the graphics scene and the graphics items of all board
+         * items are created. Boards which are never shown (e.g. when only exporting
+         * production data) therefore don't build any graphics items at all.
+         *
+         * @param view      The view to show the board in
+         */
         void showInView(GraphicsView& view) noexcept;
         void saveViewSceneRect(const QRectF& rect) noexcept {mViewRect = rect;}
         const QRectF& restoreViewSceneRect() const noexcept {return mViewRect;}
@@ -217,10 +284,15 @@ class Board final : public QObject, public AttributeProvider,
     private:
 
         Board(Project& project, const FilePath& filepath, bool restore,
-              bool readOnly, bool create, const QString& newName);
+              bool readOnly, bool create, const QString& newName,
+              const SExpression* parsedRoot, const QByteArray& parsedContent);
+        void initGraphicsScene() noexcept;
         void updateIcon() noexcept;
         bool checkAttributesValidity() const noexcept;
-        void updateErcMessages() noexcept;
+        void scheduleErcMessagesUpdate() noexcept;
+        void updateErcMessages() noexcept override;
+        void rebuildAirWires(const NetSignal& netsignal) noexcept;
+        void removeAirWires(const NetSignal& netsignal) noexcept;
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
@@ -233,6 +305,8 @@ class Board final : public QObject, public AttributeProvider,
         bool mIsAddedToProject;
 
         QScopedPointer<GraphicsScene> mGraphicsScene;
+        int mPreparedGraphicsItemsCount; ///< see #prepareGraphicsItems()
+        bool mAllGraphicsItemsPrepared; ///< see #prepareGraphicsItems()
         QScopedPointer<BoardLayerStack> mLayerStack;
         QScopedPointer<GridProperties> mGridProperties;
         QScopedPointer<BoardDesignRules> mDesignRules;
@@ -254,6 +328,11 @@ class Board final : public QObject, public AttributeProvider,
         QList<BI_StrokeText*> mStrokeTexts;
         QList<BI_Hole*> mHoles;
 
+        // airwires (not serialized, they are calculated from the items above)
+        QHash<const NetSignal*, QList<BI_AirWire*>> mAirWires;
+        QSet<const NetSignal*> mScheduledNetSignalsForAirWireRebuild;
+        QTimer mAirWiresRebuildTimer;
+
         // ERC messages
         QHash<Uuid, ErcMsg*> mErcMsgListUnplacedComponentInstances;
 };
@@ -0,0 +1,478 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <algorithm>
+#include <numeric>
+#include <clipper/clipper.hpp>
+#include "boardairwiresbuilder.h"
+#include <librepcb/common/utils/clipperhelpers.h>
+#include "board.h"
+#include "items/bi_footprintpad.h"
+#include "items/bi_netline.h"
+#include "items/bi_netpoint.h"
+#include "items/bi_netsegment.h"
+#include "items/bi_plane.h"
+#include "items/bi_via.h"
+#include "../circuit/componentsignalinstance.h"
+#include "../circuit/netsignal.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Local Helpers
+ ****************************************************************************************/
+
+/**
+ * @brief A triangle of the Delaunay triangulation
+ *
+ * The vertices are in counter-clockwise order. neighbor[i] is the triangle on the other
+ * side of the edge opposite to vertex[i], or -1 if there is no such triangle.
+ */
+struct BoardAirWiresBuilder_Triangle {
+    int vertex[3];
+    int neighbor[3];
+    bool alive;
+};
+
+static inline qint64 orientation(const QVector<qint64>& x, const QVector<qint64>& y,
+                                 int a, int b, int c) noexcept
+{
+    // exact, since the grid coordinates are small enough to not overflow
+    return (x[b] - x[a]) * (y[c] - y[a]) - (y[b] - y[a]) * (x[c] - x[a]);
+}
+
+static inline bool isInCircumcircle(const QVector<qint64>& x, const QVector<qint64>& y,
+                                    const BoardAirWiresBuilder_Triangle& t, int p) noexcept
+{
+    qreal adx = x[t.vertex[0]] - x[p], ady = y[t.vertex[0]] - y[p];
+    qreal bdx = x[t.vertex[1]] - x[p], bdy = y[t.vertex[1]] - y[p];
+    qreal cdx = x[t.vertex[2]] - x[p], cdy = y[t.vertex[2]] - y[p];
+    qreal det = (adx * adx + ady * ady) * (bdx * cdy - cdx * bdy)
+              + (bdx * bdx + bdy * bdy) * (cdx * ady - adx * cdy)
+              + (cdx * cdx + cdy * cdy) * (adx * bdy - bdx * ady);
+    return det > 0;
+}
+
+static inline qreal distance(const Point& p1, const Point& p2) noexcept
+{
+    return qSqrt(qPow(qreal(p1.getX().toNm() - p2.getX().toNm()), 2)
+               + qPow(qreal(p1.getY().toNm() - p2.getY().toNm()), 2));
+}
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BoardAirWiresBuilder::BoardAirWiresBuilder(const Board& board,
+                                           const NetSignal& netsignal) noexcept :
+    mBoard(board), mNetSignal(netsignal)
+{
+}
+
+BoardAirWiresBuilder::~BoardAirWiresBuilder() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+QVector<QPair<Point, Point>> BoardAirWiresBuilder::buildAirWires() noexcept
+{
+    mPoints.clear();
+    mParents.clear();
+
+    // pads
+    QHash<const BI_FootprintPad*, int> padPoints;
+    foreach (const ComponentSignalInstance* cmpSig, mNetSignal.getComponentSignals()) {
+        foreach (const BI_FootprintPad* pad, cmpSig->getRegisteredFootprintPads()) {
+            if (&pad->getBoard() == &mBoard) {
+                padPoints.insert(pad, addPoint(pad->getPosition()));
+            }
+        }
+    }
+
+    // vias, netpoints and netlines
+    QHash<const BI_Via*, int> viaPoints;
+    foreach (const BI_NetSegment* netsegment, mNetSignal.getBoardNetSegments()) {
+        if (&netsegment->getBoard() != &mBoard) continue;
+        foreach (const BI_Via* via, netsegment->getVias()) {
+            viaPoints.insert(via, addPoint(via->getPosition()));
+        }
+        QHash<const BI_NetPoint*, int> netpointPoints;
+        foreach (const BI_NetPoint* netpoint, netsegment->getNetPoints()) {
+            int index = -1;
+            if (netpoint->isAttachedToPad()) {
+                index = padPoints.value(netpoint->getFootprintPad(), -1);
+            } else if (netpoint->isAttachedToVia()) {
+                index = viaPoints.value(netpoint->getVia(), -1);
+            }
+            if (index < 0) {
+                index = addPoint(netpoint->getPosition());
+            }
+            netpointPoints.insert(netpoint, index);
+        }
+        foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
+            connectPoints(netpointPoints.value(&netline->getStartPoint()),
+                          netpointPoints.value(&netline->getEndPoint()));
+        }
+    }
+
+    // pads and vias within the same plane fragment are connected together
+    foreach (const BI_Plane* plane, mNetSignal.getBoardPlanes()) {
+        if (&plane->getBoard() != &mBoard) continue;
+        foreach (const Path& fragment, plane->getFragments()) {
+            ClipperLib::Path path = ClipperHelpers::convert(fragment, Length(5000));
+            if (path.empty()) continue;
+            ClipperLib::IntPoint min = path.front(), max = path.front();
+            for (const ClipperLib::IntPoint& p : path) {
+                min.X = qMin(min.X, p.X); min.Y = qMin(min.Y, p.Y);
+                max.X = qMax(max.X, p.X); max.Y = qMax(max.Y, p.Y);
+            }
+            int connectedPoint = -1;
+            auto connectIfInside = [&](int index) {
+                ClipperLib::IntPoint p = ClipperHelpers::convert(mPoints.at(index));
+                if ((p.X < min.X) || (p.X > max.X) || (p.Y < min.Y) || (p.Y > max.Y)) return;
+                if (ClipperLib::PointInPolygon(p, path) == 0) return;
+                if (connectedPoint >= 0) connectPoints(connectedPoint, index);
+                connectedPoint = index;
+            };
+            for (auto it = padPoints.constBegin(); it != padPoints.constEnd(); ++it) {
+                if (it.key()->isOnLayer(plane->getLayerId())) {
+                    connectIfInside(it.value());
+                }
+            }
+            foreach (int index, viaPoints) {
+                connectIfInside(index);
+            }
+        }
+    }
+
+    // calculate the airwires between the clusters of connected points
+    QVector<int> clusters(mPoints.count());
+    for (int i = 0; i < mPoints.count(); ++i) {
+        clusters[i] = findRoot(mParents, i);
+    }
+    QVector<QPair<Point, Point>> airwires;
+    typedef QPair<int, int> IndexPair;
+    foreach (const IndexPair& pair, calcAirWires(mPoints, clusters)) {
+        airwires.append(qMakePair(mPoints.at(pair.first), mPoints.at(pair.second)));
+    }
+    return airwires;
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+QVector<QPair<int, int>> BoardAirWiresBuilder::calcAirWires(const QVector<Point>& points,
+                                                            const QVector<int>& clusters) noexcept
+{
+    Q_ASSERT(clusters.count() == points.count());
+    QVector<QPair<int, int>> airwires;
+
+    // map cluster IDs to consecutive numbers
+    QHash<int, int> clusterIndices;
+    QVector<int> pointClusters(points.count());
+    for (int i = 0; i < points.count(); ++i) {
+        auto it = clusterIndices.find(clusters.at(i));
+        if (it == clusterIndices.end()) {
+            it = clusterIndices.insert(clusters.at(i), clusterIndices.count());
+        }
+        pointClusters[i] = it.value();
+    }
+    if (clusterIndices.count() < 2) {
+        return airwires; // everything is connected already
+    }
+
+    // each cluster is a node of the spanning tree
+    QVector<int> parents(clusterIndices.count());
+    std::iota(parents.begin(), parents.end(), 0);
+
+    QVector<Edge> edges = (points.count() <= sMaxPointsForCompleteGraph)
+                          ? calcCompleteGraphEdges(points) : calcDelaunayEdges(points);
+    addMinimumSpanningTree(pointClusters, edges, parents, airwires);
+
+    if (airwires.count() < parents.count() - 1) {
+        // the triangulation is always connected, so this should never happen...
+        qWarning() << "Triangulation for airwires incomplete, falling back to O(n^2).";
+        edges = calcCompleteGraphEdges(points);
+        addMinimumSpanningTree(pointClusters, edges, parents, airwires);
+    }
+    return airwires;
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+int BoardAirWiresBuilder::addPoint(const Point& pos) noexcept
+{
+    mPoints.append(pos);
+    mParents.append(mParents.count());
+    return mPoints.count() - 1;
+}
+
+void BoardAirWiresBuilder::connectPoints(int p1, int p2) noexcept
+{
+    int root1 = findRoot(mParents, p1);
+    int root2 = findRoot(mParents, p2);
+    if (root1 != root2) {
+        mParents[root1] = root2;
+    }
+}
+
+int BoardAirWiresBuilder::findRoot(QVector<int>& parents, int index) noexcept
+{
+    while (parents.at(index) != index) {
+        parents[index] = parents.at(parents.at(index)); // path halving
+        index = parents.at(index);
+    }
+    return index;
+}
+
+QVector<BoardAirWiresBuilder::Edge> BoardAirWiresBuilder::calcCompleteGraphEdges(
+    const QVector<Point>& points) noexcept
+{
+    QVector<Edge> edges;
+    edges.reserve(points.count() * (points.count() - 1) / 2);
+    for (int i = 0; i < points.count(); ++i) {
+        for (int k = i + 1; k < points.count(); ++k) {
+            edges.append(Edge{i, k, distance(points.at(i), points.at(k))});
+        }
+    }
+    return edges;
+}
+
+QVector<BoardAirWiresBuilder::Edge> BoardAirWiresBuilder::calcDelaunayEdges(
+    const QVector<Point>& points) noexcept
+{
+    typedef BoardAirWiresBuilder_Triangle Triangle;
+    QVector<Edge> edges;
+    if (points.isEmpty()) return edges;
+
+    // The triangulation works on an integer grid with at most 2^20 steps in each
+    // direction, which allows to calculate orientations exactly with 64 bit integers.
+    qint64 minX = points.first().getX().toNm(), maxX = minX;
+    qint64 minY = points.first().getY().toNm(), maxY = minY;
+    foreach (const Point& p, points) {
+        minX = qMin(minX, qint64(p.getX().toNm())); maxX = qMax(maxX, qint64(p.getX().toNm()));
+        minY = qMin(minY, qint64(p.getY().toNm())); maxY = qMax(maxY, qint64(p.getY().toNm()));
+    }
+    qint64 resolution = qMax(qint64(1000), qMax(maxX - minX, maxY - minY) >> 20);
+
+    // points on the same grid position are connected directly, all others are vertices
+    QVector<qint64> x, y;
+    QVector<int> vertexPoints;
+    QHash<QPair<qint64, qint64>, int> vertexAtPos;
+    for (int i = 0; i < points.count(); ++i) {
+        qint64 gx = (points.at(i).getX().toNm() - minX + resolution / 2) / resolution;
+        qint64 gy = (points.at(i).getY().toNm() - minY + resolution / 2) / resolution;
+        int vertex = vertexAtPos.value(qMakePair(gx, gy), -1);
+        if (vertex >= 0) {
+            int p = vertexPoints.at(vertex);
+            edges.append(Edge{p, i, distance(points.at(p), points.at(i))});
+        } else {
+            vertexAtPos.insert(qMakePair(gx, gy), x.count());
+            x.append(gx);
+            y.append(gy);
+            vertexPoints.append(i);
+        }
+    }
+    int count = x.count();
+
+    // insert the vertices row by row in a serpentine order, which keeps the walks of the
+    // point location short
+    qint64 size = qMax(*std::max_element(x.begin(), x.end()),
+                       *std::max_element(y.begin(), y.end())) + 1;
+    qint64 rowHeight = size / qMax(1, int(qSqrt(count))) + 1;
+    QVector<int> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        qint64 rowA = y[a] / rowHeight, rowB = y[b] / rowHeight;
+        if (rowA != rowB) return rowA < rowB;
+        return (rowA % 2) ? (x[a] > x[b]) : (x[a] < x[b]);
+    });
+
+    // start with a big triangle which contains all vertices
+    qint64 center = size / 2, extent = size * 100;
+    x << (center - 2 * extent) << (center + 2 * extent) << center;
+    y << (center - extent) << (center - extent) << (center + 2 * extent);
+    QVector<Triangle> triangles;
+    triangles.append(Triangle{{count, count + 1, count + 2}, {-1, -1, -1}, true});
+
+    QVector<int> marks(1, 0);
+    QVector<int> newTriangleAtVertex(x.count(), -1);
+    QVector<int> cavity, created;
+    QVector<Triangle> cavityTriangles;
+    int lastTriangle = 0;
+    for (int step = 0; step < count; ++step) {
+        const int p = order.at(step);
+
+        // locate the triangle containing the vertex by walking towards it
+        int t = lastTriangle;
+        for (int walkSteps = 0; t >= 0; ++walkSteps) {
+            const Triangle& tri = triangles.at(t);
+            int next = t;
+            for (int i = 0; i < 3; ++i) {
+                if (orientation(x, y, tri.vertex[(i + 1) % 3], tri.vertex[(i + 2) % 3], p) < 0) {
+                    next = tri.neighbor[i];
+                    break;
+                }
+            }
+            if (next == t) break; // found
+            t = (walkSteps < triangles.count()) ? next : -1;
+        }
+        if (t < 0) {
+            // walk failed (only possible due to rounding errors), search all triangles
+            for (int i = 0; (i < triangles.count()) && (t < 0); ++i) {
+                const Triangle& tri = triangles.at(i);
+                if (tri.alive
+                    && (orientation(x, y, tri.vertex[0], tri.vertex[1], p) >= 0)
+                    && (orientation(x, y, tri.vertex[1], tri.vertex[2], p) >= 0)
+                    && (orientation(x, y, tri.vertex[2], tri.vertex[0], p) >= 0)) {
+                    t = i;
+                }
+            }
+            if (t < 0) continue; // vertex will be connected by the fallback algorithm
+        }
+
+        // determine all triangles whose circumcircle contains the new vertex
+        const int mark = step + 1;
+        cavity.clear();
+        cavity.append(t);
+        marks[t] = mark;
+        for (int k = 0; k < cavity.count(); ++k) {
+            const Triangle& tri = triangles.at(cavity.at(k));
+            for (int i = 0; i < 3; ++i) {
+                int nb = tri.neighbor[i];
+                if ((nb >= 0) && (marks.at(nb) != mark) && isInCircumcircle(x, y, triangles.at(nb), p)) {
+                    marks[nb] = mark;
+                    cavity.append(nb);
+                }
+            }
+        }
+
+        // the new vertex must see all boundary edges of the cavity, otherwise (rounding
+        // errors of the circle test) grow the cavity to keep the triangulation valid
+        for (int k = 0; k < cavity.count(); ++k) {
+            const Triangle& tri = triangles.at(cavity.at(k));
+            for (int i = 0; i < 3; ++i) {
+                int nb = tri.neighbor[i];
+                if ((nb >= 0) && (marks.at(nb) != mark) &&
+                    (orientation(x, y, tri.vertex[(i + 1) % 3], tri.vertex[(i + 2) % 3], p) <= 0)) {
+                    marks[nb] = mark;
+                    cavity.append(nb);
+                    k = -1; // restart, earlier boundary edges may have changed
+                    break;
+                }
+            }
+        }
+
+        // replace the cavity by a fan of triangles around the new vertex
+        cavityTriangles.clear();
+        foreach (int index, cavity) {
+            cavityTriangles.append(triangles.at(index));
+        }
+        created.clear();
+        foreach (const Triangle& tri, cavityTriangles) {
+            for (int i = 0; i < 3; ++i) {
+                int nb = tri.neighbor[i];
+                if ((nb >= 0) && (marks.at(nb) == mark)) continue; // inner edge
+                int a = tri.vertex[(i + 1) % 3], b = tri.vertex[(i + 2) % 3];
+                Triangle newTri{{a, b, p}, {-1, -1, nb}, true};
+                int index;
+                if (created.count() < cavity.count()) {
+                    index = cavity.at(created.count()); // reuse memory
+                    triangles[index] = newTri;
+                } else {
+                    index = triangles.count();
+                    triangles.append(newTri);
+                    marks.append(0);
+                }
+                if (nb >= 0) {
+                    Triangle& outer = triangles[nb];
+                    for (int j = 0; j < 3; ++j) {
+                        if ((outer.vertex[(j + 1) % 3] == b) && (outer.vertex[(j + 2) % 3] == a)) {
+                            outer.neighbor[j] = index;
+                        }
+                    }
+                }
+                newTriangleAtVertex[a] = index;
+                created.append(index);
+            }
+        }
+        for (int k = created.count(); k < cavity.count(); ++k) {
+            triangles[cavity.at(k)].alive = false; // not reached for valid cavities
+            marks[cavity.at(k)] = -1;
+        }
+        foreach (int index, created) {
+            int next = newTriangleAtVertex.at(triangles.at(index).vertex[1]);
+            triangles[index].neighbor[0] = next;
+            triangles[next].neighbor[1] = index;
+        }
+        lastTriangle = created.last();
+    }
+
+    // every edge between two real vertices appears in two triangles, in opposite directions
+    foreach (const Triangle& tri, triangles) {
+        if (!tri.alive) continue;
+        for (int i = 0; i < 3; ++i) {
+            int a = tri.vertex[i], b = tri.vertex[(i + 1) % 3];
+            if ((a < b) && (b < count)) {
+                int p1 = vertexPoints.at(a), p2 = vertexPoints.at(b);
+                edges.append(Edge{p1, p2, distance(points.at(p1), points.at(p2))});
+            }
+        }
+    }
+    return edges;
+}
+
+void BoardAirWiresBuilder::addMinimumSpanningTree(const QVector<int>& clusters,
+                                                  QVector<Edge>& edges, QVector<int>& parents,
+                                                  QVector<QPair<int, int>>& airwires) noexcept
+{
+    // Kruskal's algorithm, with the clusters as nodes
+    std::sort(edges.begin(), edges.end(),
+              [](const Edge& e1, const Edge& e2) {return e1.length < e2.length;});
+    foreach (const Edge& edge, edges) {
+        if (airwires.count() >= parents.count() - 1) break; // all clusters connected
+        int root1 = findRoot(parents, clusters.at(edge.p1));
+        int root2 = findRoot(parents, clusters.at(edge.p2));
+        if (root1 != root2) {
+            parents[root1] = root2;
+            airwires.append(qMakePair(edge.p1, edge.p2));
+        }
+    }
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
@@ -0,0 +1,126 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_BOARDAIRWIRESBUILDER_H
+#define LIBREPCB_PROJECT_BOARDAIRWIRESBUILDER_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/units/all_length_units.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+class Board;
+class NetSignal;
+
+/*****************************************************************************************
+ *  Class BoardAirWiresBuilder
+ ****************************************************************************************/
+
+/**
+ * @brief The BoardAirWiresBuilder class calculates the airwires of a net signal
+ *
+ * All pads, vias and netpoints of the net signal on a board are grouped into clusters of
+ * items which are already connected together (by netlines or plane fragments). Then the
+ * shortest set of airwires which connects all clusters is determined, i.e. the minimum
+ * spanning tree of the clusters.
+ *
+ * To keep this fast for nets with many items, the candidate edges of the spanning tree
+ * are taken from a Delaunay triangulation of all points (which always contains the
+ * euclidean minimum spanning tree), so the calculation needs O(n*log(n)) instead of
+ * O(n^2) time.
+ */
+class BoardAirWiresBuilder final
+{
+    public:
+
+        // Constructors / Destructor
+        BoardAirWiresBuilder() = delete;
+        BoardAirWiresBuilder(const BoardAirWiresBuilder& other) = delete;
+        BoardAirWiresBuilder(const Board& board, const NetSignal& netsignal) noexcept;
+        ~BoardAirWiresBuilder() noexcept;
+
+        // General Methods
+        QVector<QPair<Point, Point>> buildAirWires() noexcept;
+
+        // Operator Overloadings
+        BoardAirWiresBuilder& operator=(const BoardAirWiresBuilder& rhs) = delete;
+
+        // Static Methods
+
+        /**
+         * @brief Calculate the airwires between clusters of points
+         *
+         * @param points    The positions of all points
+         * @param clusters  The cluster of each point (must have the same size as
+         *                  `points`). Points with the same cluster are considered as
+         *                  already connected together.
+         *
+         * @return The airwires as pairs of indices into `points`
+         */
+        static QVector<QPair<int, int>> calcAirWires(const QVector<Point>& points,
+                                                     const QVector<int>& clusters) noexcept;
+
+
+    private: // Types
+        struct Edge {
+            int p1;
+            int p2;
+            qreal length;
+        };
+
+
+    private: // Methods
+        int addPoint(const Point& pos) noexcept;
+        void connectPoints(int p1, int p2) noexcept;
+        static int findRoot(QVector<int>& parents, int index) noexcept;
+        static QVector<Edge> calcCompleteGraphEdges(const QVector<Point>& points) noexcept;
+        static QVector<Edge> calcDelaunayEdges(const QVector<Point>& points) noexcept;
+        static void addMinimumSpanningTree(const QVector<int>& clusters,
+                                           QVector<Edge>& edges, QVector<int>& parents,
+                                           QVector<QPair<int, int>>& airwires) noexcept;
+
+        /**
+         * Up to this count of points, all pairs of points are used as candidate edges
+         * (faster than the triangulation for very small nets)
+         */
+        static constexpr int sMaxPointsForCompleteGraph = 32;
+
+
+    private: // Data
+        const Board& mBoard;
+        const NetSignal& mNetSignal;
+        QVector<Point> mPoints;
+        QVector<int> mParents;  ///< union-find structure to build the clusters of points
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_BOARDAIRWIRESBUILDER_H
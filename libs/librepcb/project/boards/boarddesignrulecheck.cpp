@@ -0,0 +1,747 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtConcurrent/QtConcurrent>
+#include "boarddesignrulecheck.h"
+#include <librepcb/common/boarddesignrules.h>
+#include <librepcb/common/geometry/polygon.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/utils/clipperhelpers.h>
+#include <librepcb/library/pkg/footprint.h>
+#include "board.h"
+#include "boardlayerstack.h"
+#include "items/bi_device.h"
+#include "items/bi_footprint.h"
+#include "items/bi_footprintpad.h"
+#include "items/bi_hole.h"
+#include "items/bi_netline.h"
+#include "items/bi_netpoint.h"
+#include "items/bi_netsegment.h"
+#include "items/bi_plane.h"
+#include "items/bi_polygon.h"
+#include "items/bi_via.h"
+#include "../circuit/componentinstance.h"
+#include "../circuit/netsignal.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Local Helpers
+ ****************************************************************************************/
+
+static inline void hashCombine(uint& hash, uint value) noexcept
+{
+    hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+}
+
+static inline qint64 floorDiv(qint64 value, qint64 divisor) noexcept
+{
+    qint64 result = value / divisor;
+    if ((value % divisor != 0) && (value < 0)) --result;
+    return result;
+}
+
+static inline quint64 cellKey(qint64 x, qint64 y) noexcept
+{
+    return (quint64(quint32(qint32(x))) << 32) | quint64(quint32(qint32(y)));
+}
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BoardDesignRuleCheck::BoardDesignRuleCheck(const Board& board) noexcept :
+    mBoard(board), mMargin(1), mCellSize(1000000), mHasRun(false)
+{
+}
+
+BoardDesignRuleCheck::~BoardDesignRuleCheck() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+int BoardDesignRuleCheck::runFull() noexcept
+{
+    return run(false);
+}
+
+int BoardDesignRuleCheck::runIncremental() noexcept
+{
+    return run(true);
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+int BoardDesignRuleCheck::run(bool incremental) noexcept
+{
+    // the cached objects and the grid depend on the layers and the clearances
+    QStringList copperLayers;
+    copperLayers.append(GraphicsLayer::sTopCopper);
+    for (int i = 1; i <= mBoard.getLayerStack().getInnerLayerCount(); ++i) {
+        copperLayers.append(GraphicsLayer::getInnerLayerName(i));
+    }
+    copperLayers.append(GraphicsLayer::sBotCopper);
+    const BoardDesignRules& rules = mBoard.getDesignRules();
+    if ((!mHasRun) || (copperLayers != mCopperLayers) ||
+        (rules.getCopperClearance() != mCopperClearance) ||
+        (rules.getCopperBoardClearance() != mCopperBoardClearance))
+    {
+        mCopperLayers = copperLayers;
+        mCopperClearance = rules.getCopperClearance();
+        mCopperBoardClearance = rules.getCopperBoardClearance();
+        reset();
+        incremental = false;
+    }
+
+    // update the cached objects and determine which objects need to be checked
+    QSet<QString> dirtyKeys;
+    QSet<int> dirtyObjects = collectObjects(dirtyKeys);
+    if (incremental) {
+        // remove all violations of modified and removed objects
+        for (auto it = mViolations.begin(); it != mViolations.end();) {
+            if (dirtyKeys.contains(it->objectKey1) || dirtyKeys.contains(it->objectKey2)) {
+                it = mViolations.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    } else {
+        mViolations.clear();
+    }
+
+    // check all layers in parallel
+    if ((!incremental) || (!dirtyObjects.isEmpty())) {
+        const QSet<int>* dirty = incremental ? &dirtyObjects : nullptr;
+        QList<QFuture<QList<Violation>>> futures;
+        foreach (const QString& layerName, mCopperLayers) {
+            futures.append(QtConcurrent::run([this, layerName, dirty](){
+                return checkLayer(layerName, dirty);
+            }));
+        }
+        for (int i = 0; i < futures.count(); ++i) {
+            mViolations.append(futures[i].result());
+        }
+    }
+
+    mHasRun = true;
+    return mViolations.count();
+}
+
+void BoardDesignRuleCheck::reset() noexcept
+{
+    mObjects.clear();
+    mFreeObjectSlots.clear();
+    mObjectIndices.clear();
+    mLayers.clear();
+    foreach (const QString& layerName, mCopperLayers) {
+        mLayers.insert(layerName, Layer());
+    }
+
+    // Two primitives can only violate the clearance if their bounding boxes, expanded by
+    // half of the clearance, overlap. Long segments are split into chunks of about one
+    // cell to keep the number of cells per primitive small.
+    mMargin = qMax(mCopperClearance, mCopperBoardClearance).toNm() / 2 + 1;
+    mCellSize = qMax(qint64(1000000), mMargin * 8);
+}
+
+QSet<int> BoardDesignRuleCheck::collectObjects(QSet<QString>& dirtyKeys) noexcept
+{
+    // Only a cheap hash over the properties of each item is calculated. The primitives
+    // are only rebuilt for new or modified items, which are then returned as "dirty".
+    QSet<int> dirty;
+    QVector<bool> seen(mObjects.count(), false);
+
+    // pads and holes of devices
+    foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
+        const BI_Footprint& footprint = device->getFootprint();
+        QString compUuid = device->getComponentInstanceUuid().toStr();
+        QString compName = device->getComponentInstance().getName();
+        foreach (const BI_FootprintPad* pad, footprint.getPads()) {
+            uint hash = qHash(pad->getPosition());
+            hashCombine(hash, qHash(pad->getRotation()));
+            hashCombine(hash, pad->getIsMirrored() ? 1 : 0);
+            hashCombine(hash, qHash(quintptr(&pad->getLibPad())));
+            Object* obj = updateObject("pad:" + compUuid + ":" + pad->getLibPadUuid().toStr(),
+                                       QString(tr("pad \"%1\" of \"%2\""))
+                                           .arg(pad->getDisplayText(), compName),
+                                       pad->getCompSigInstNetSignal(), false, hash, seen,
+                                       dirty);
+            if (obj) {
+                QStringList layers;
+                foreach (const QString& layerName, mCopperLayers) {
+                    if (pad->isOnLayer(layerName)) layers.append(layerName);
+                }
+                addPath(*obj, layers, pad->getSceneOutline(), Length(0), true);
+            }
+        }
+        for (const Hole& hole : footprint.getLibFootprint().getHoles()) {
+            Point pos = footprint.mapToScene(hole.getPosition());
+            uint hash = qHash(pos);
+            hashCombine(hash, qHash(hole.getDiameter()));
+            Object* obj = updateObject("hole:" + compUuid + ":" + hole.getUuid().toStr(),
+                                       QString(tr("hole of \"%1\"")).arg(compName),
+                                       nullptr, true, hash, seen, dirty);
+            if (obj) {
+                addSegment(*obj, mCopperLayers, pos, pos, hole.getDiameter());
+            }
+        }
+    }
+
+    // board holes
+    foreach (const BI_Hole* hole, mBoard.getHoles()) {
+        const Point& pos = hole->getHole().getPosition();
+        uint hash = qHash(pos);
+        hashCombine(hash, qHash(hole->getHole().getDiameter()));
+        Object* obj = updateObject("hole:" + hole->getUuid().toStr(), tr("hole"), nullptr,
+                                   true, hash, seen, dirty);
+        if (obj) {
+            addSegment(*obj, mCopperLayers, pos, pos, hole->getHole().getDiameter());
+        }
+    }
+
+    // vias and net lines
+    foreach (const BI_NetSegment* netsegment, mBoard.getNetSegments()) {
+        const NetSignal* netsignal = &netsegment->getNetSignal();
+        foreach (const BI_Via* via, netsegment->getVias()) {
+            uint hash = qHash(via->getPosition());
+            hashCombine(hash, qHash(via->getSize()));
+            hashCombine(hash, static_cast<uint>(via->getShape()));
+            Object* obj = updateObject("via:" + via->getUuid().toStr(),
+                                       QString(tr("via of net \"%1\""))
+                                           .arg(netsignal->getName()),
+                                       netsignal, false, hash, seen, dirty);
+            if (!obj) {
+                continue;
+            } else if (via->getShape() == BI_Via::Shape::Round) {
+                addSegment(*obj, mCopperLayers, via->getPosition(), via->getPosition(),
+                           via->getSize());
+            } else {
+                addPath(*obj, mCopperLayers, via->getSceneOutline(), Length(0), true);
+            }
+        }
+        foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
+            const Point& p1 = netline->getStartPoint().getPosition();
+            const Point& p2 = netline->getEndPoint().getPosition();
+            const QString& layerName = netline->getLayer().getName();
+            uint hash = qHash(p1);
+            hashCombine(hash, qHash(p2));
+            hashCombine(hash, qHash(netline->getWidth()));
+            hashCombine(hash, qHash(layerName));
+            Object* obj = updateObject("netline:" + netline->getUuid().toStr(),
+                                       QString(tr("trace of net \"%1\""))
+                                           .arg(netsignal->getName()),
+                                       netsignal, false, hash, seen, dirty);
+            if (obj) {
+                addSegment(*obj, QStringList{layerName}, p1, p2, netline->getWidth());
+            }
+        }
+    }
+
+    // plane fragments
+    foreach (const BI_Plane* plane, mBoard.getPlanes()) {
+        const NetSignal* netsignal = &plane->getNetSignal();
+        uint hash = qHash(plane->getLayerName());
+        foreach (const Path& fragment, plane->getFragments()) {
+            hashCombine(hash, qHash(fragment));
+        }
+        Object* obj = updateObject("plane:" + plane->getUuid().toStr(),
+                                   QString(tr("plane of net \"%1\""))
+                                       .arg(netsignal->getName()),
+                                   netsignal, false, hash, seen, dirty);
+        if (obj) {
+            foreach (const Path& fragment, plane->getFragments()) {
+                addPath(*obj, QStringList{plane->getLayerName()}, fragment, Length(0), true);
+            }
+        }
+    }
+
+    // copper polygons and board outline
+    foreach (const BI_Polygon* polygon, mBoard.getPolygons()) {
+        const Polygon& p = polygon->getPolygon();
+        uint hash = qHash(p.getPath());
+        hashCombine(hash, qHash(p.getLineWidth()));
+        hashCombine(hash, p.isFilled() ? 1 : 0);
+        if (p.getLayerName() == GraphicsLayer::sBoardOutlines) {
+            Object* obj = updateObject("outline:" + polygon->getUuid().toStr(),
+                                       tr("board outline"), nullptr, true, hash, seen,
+                                       dirty);
+            if (obj) {
+                addPath(*obj, mCopperLayers, p.getPath(), Length(0), false);
+            }
+        } else if (mLayers.contains(p.getLayerName())) {
+            hashCombine(hash, qHash(p.getLayerName()));
+            Object* obj = updateObject("polygon:" + polygon->getUuid().toStr(),
+                                       tr("copper polygon"), nullptr, false, hash, seen,
+                                       dirty);
+            if (obj) {
+                addPath(*obj, QStringList{p.getLayerName()}, p.getPath(),
+                        p.getLineWidth(), p.isFilled());
+            }
+        }
+    }
+
+    // remove objects which do no longer exist
+    for (int i = 0; i < mObjects.count(); ++i) {
+        if (mObjects[i].isUsed && (!seen[i])) {
+            removeFromGrid(i);
+            dirtyKeys.insert(mObjects[i].key);
+            mObjectIndices.remove(mObjects[i].key);
+            mObjects[i] = Object();
+            mFreeObjectSlots.append(i);
+        }
+    }
+
+    // insert new and modified objects into the grid
+    foreach (int index, dirty) {
+        insertIntoGrid(index);
+        dirtyKeys.insert(mObjects[index].key);
+    }
+    return dirty;
+}
+
+BoardDesignRuleCheck::Object* BoardDesignRuleCheck::updateObject(const QString& key,
+    const QString& description, const NetSignal* netSignal, bool isBoardEdge,
+    uint sourceHash, QVector<bool>& seen, QSet<int>& dirty) noexcept
+{
+    int index = mObjectIndices.value(key, -1);
+    if (index >= 0) {
+        Q_ASSERT(!seen[index]);
+        seen[index] = true;
+        const Object& obj = mObjects[index];
+        if ((obj.sourceHash == sourceHash) && (obj.netSignal == netSignal) &&
+            (obj.description == description))
+        {
+            return nullptr; // not modified, keep the cached primitives
+        }
+        removeFromGrid(index);
+    } else if (!mFreeObjectSlots.isEmpty()) {
+        index = mFreeObjectSlots.takeLast();
+        seen[index] = true;
+    } else {
+        index = mObjects.count();
+        mObjects.append(Object());
+        seen.append(true);
+    }
+    mObjectIndices.insert(key, index);
+    dirty.insert(index);
+
+    Object& obj = mObjects[index];
+    obj = Object();
+    obj.key = key;
+    obj.description = description;
+    obj.netSignal = netSignal;
+    obj.isBoardEdge = isBoardEdge;
+    obj.sourceHash = sourceHash;
+    obj.isUsed = true;
+    Length max(std::numeric_limits<LengthBase_t>::max());
+    obj.minPos = Point(max, max);
+    obj.maxPos = Point(-max, -max);
+    return &obj;
+}
+
+void BoardDesignRuleCheck::addSegment(Object& obj, const QStringList& layers,
+                                      const Point& p1, const Point& p2,
+                                      const Length& width) noexcept
+{
+    Segment segment{p1, p2, width / 2};
+    foreach (const QString& layerName, layers) {
+        if (mLayers.contains(layerName)) {
+            obj.segments[layerName].append(segment);
+        }
+    }
+    Length r = segment.radius;
+    obj.minPos.setX(qMin(obj.minPos.getX(), qMin(p1.getX(), p2.getX()) - r));
+    obj.minPos.setY(qMin(obj.minPos.getY(), qMin(p1.getY(), p2.getY()) - r));
+    obj.maxPos.setX(qMax(obj.maxPos.getX(), qMax(p1.getX(), p2.getX()) + r));
+    obj.maxPos.setY(qMax(obj.maxPos.getY(), qMax(p1.getY(), p2.getY()) + r));
+}
+
+void BoardDesignRuleCheck::addPath(Object& obj, const QStringList& layers,
+                                   const Path& path, const Length& width,
+                                   bool filled) noexcept
+{
+    // flatten arcs with the same tolerance as used for the plane fragments
+    QVector<Point> points;
+    foreach (const ClipperLib::IntPoint& p, ClipperHelpers::convert(path, Length(5000))) {
+        points.append(ClipperHelpers::convert(p));
+    }
+    if (points.isEmpty()) return;
+    if (filled && (points.first() != points.last())) {
+        points.append(points.first()); // close the polygon
+    }
+    if (points.count() == 1) {
+        addSegment(obj, layers, points.first(), points.first(), width);
+    }
+    for (int i = 1; i < points.count(); ++i) {
+        addSegment(obj, layers, points[i - 1], points[i], width);
+    }
+    if (filled) {
+        obj.areas.append(points);
+    }
+}
+
+void BoardDesignRuleCheck::insertIntoGrid(int index) noexcept
+{
+    const Object& obj = mObjects[index];
+    foreach (const QString& layerName, obj.segments.keys()) {
+        Layer& layer = mLayers[layerName];
+        foreach (const Entry& e, getChunks(index, layerName)) {
+            for (qint64 x = floorDiv(e.x1, mCellSize); x <= floorDiv(e.x2, mCellSize); ++x) {
+                for (qint64 y = floorDiv(e.y1, mCellSize); y <= floorDiv(e.y2, mCellSize); ++y) {
+                    layer.grid[cellKey(x, y)].append(e);
+                }
+            }
+        }
+        if (!obj.areas.isEmpty()) {
+            for (qint64 x = floorDiv(obj.minPos.getX().toNm(), mCellSize);
+                 x <= floorDiv(obj.maxPos.getX().toNm(), mCellSize); ++x) {
+                for (qint64 y = floorDiv(obj.minPos.getY().toNm(), mCellSize);
+                     y <= floorDiv(obj.maxPos.getY().toNm(), mCellSize); ++y) {
+                    layer.areaGrid[cellKey(x, y)].append(index);
+                }
+            }
+        }
+    }
+}
+
+void BoardDesignRuleCheck::removeFromGrid(int index) noexcept
+{
+    // the cells are determined the same way as in insertIntoGrid()
+    const Object& obj = mObjects[index];
+    foreach (const QString& layerName, obj.segments.keys()) {
+        Layer& layer = mLayers[layerName];
+        foreach (const Entry& e, getChunks(index, layerName)) {
+            for (qint64 x = floorDiv(e.x1, mCellSize); x <= floorDiv(e.x2, mCellSize); ++x) {
+                for (qint64 y = floorDiv(e.y1, mCellSize); y <= floorDiv(e.y2, mCellSize); ++y) {
+                    auto it = layer.grid.find(cellKey(x, y));
+                    if (it == layer.grid.end()) continue;
+                    it->erase(std::remove_if(it->begin(), it->end(),
+                        [index](const Entry& entry){return entry.object == index;}),
+                        it->end());
+                    if (it->isEmpty()) layer.grid.erase(it);
+                }
+            }
+        }
+        if (!obj.areas.isEmpty()) {
+            for (qint64 x = floorDiv(obj.minPos.getX().toNm(), mCellSize);
+                 x <= floorDiv(obj.maxPos.getX().toNm(), mCellSize); ++x) {
+                for (qint64 y = floorDiv(obj.minPos.getY().toNm(), mCellSize);
+                     y <= floorDiv(obj.maxPos.getY().toNm(), mCellSize); ++y) {
+                    auto it = layer.areaGrid.find(cellKey(x, y));
+                    if (it == layer.areaGrid.end()) continue;
+                    it->removeAll(index);
+                    if (it->isEmpty()) layer.areaGrid.erase(it);
+                }
+            }
+        }
+    }
+}
+
+QVector<BoardDesignRuleCheck::Entry> BoardDesignRuleCheck::getChunks(int index,
+    const QString& layerName) const noexcept
+{
+    QVector<Entry> entries;
+    foreach (const Segment& s, mObjects[index].segments.value(layerName)) {
+        qint64 dx = (s.p2.getX() - s.p1.getX()).toNm();
+        qint64 dy = (s.p2.getY() - s.p1.getY()).toNm();
+        qint64 chunks = qMax(qint64(1), (qMax(qAbs(dx), qAbs(dy)) + mCellSize - 1) / mCellSize);
+        qint64 expansion = s.radius.toNm() + mMargin;
+        for (qint64 c = 0; c < chunks; ++c) {
+            qint64 ax = s.p1.getX().toNm() + (dx * c) / chunks;
+            qint64 ay = s.p1.getY().toNm() + (dy * c) / chunks;
+            qint64 bx = s.p1.getX().toNm() + (dx * (c + 1)) / chunks;
+            qint64 by = s.p1.getY().toNm() + (dy * (c + 1)) / chunks;
+            entries.append(Entry{index, s,
+                                 qMin(ax, bx) - expansion, qMin(ay, by) - expansion,
+                                 qMax(ax, bx) + expansion, qMax(ay, by) + expansion});
+        }
+    }
+    return entries;
+}
+
+QList<BoardDesignRuleCheck::Violation> BoardDesignRuleCheck::checkLayer(
+    const QString& layerName, const QSet<int>* dirtyObjects) const noexcept
+{
+    const Layer& layer = *mLayers.constFind(layerName);
+    Results results;
+
+    if (!dirtyObjects) {
+        // check all pairs of primitives sharing a grid cell
+        for (auto it = layer.grid.constBegin(); it != layer.grid.constEnd(); ++it) {
+            const QVector<Entry>& cell = it.value();
+            for (int i = 0; i < cell.count(); ++i) {
+                for (int j = i + 1; j < cell.count(); ++j) {
+                    checkEntries(cell[i], cell[j], layerName, it.key(), results);
+                }
+            }
+        }
+
+        // check for objects located completely inside filled areas of other objects
+        for (int index = 0; index < mObjects.count(); ++index) {
+            auto segments = mObjects[index].segments.constFind(layerName);
+            if (segments == mObjects[index].segments.constEnd()) continue;
+            const Point& p = segments->first().p1;
+            quint64 key = cellKey(floorDiv(p.getX().toNm(), mCellSize),
+                                  floorDiv(p.getY().toNm(), mCellSize));
+            foreach (int areaIndex, layer.areaGrid.value(key)) {
+                checkContainment(index, areaIndex, layerName, results);
+            }
+        }
+    } else {
+        // only query the grid around the modified objects
+        foreach (int index, *dirtyObjects) {
+            const Object& obj = mObjects[index];
+            auto segments = obj.segments.constFind(layerName);
+            if (segments == obj.segments.constEnd()) continue;
+            foreach (const Entry& e1, getChunks(index, layerName)) {
+                for (qint64 x = floorDiv(e1.x1, mCellSize); x <= floorDiv(e1.x2, mCellSize); ++x) {
+                    for (qint64 y = floorDiv(e1.y1, mCellSize); y <= floorDiv(e1.y2, mCellSize); ++y) {
+                        quint64 key = cellKey(x, y);
+                        auto cell = layer.grid.constFind(key);
+                        if (cell == layer.grid.constEnd()) continue;
+                        foreach (const Entry& e2, *cell) {
+                            if (dirtyObjects->contains(e2.object) && (e2.object < index)) {
+                                continue; // will be (or was) checked from the other side
+                            }
+                            checkEntries(e1, e2, layerName, key, results);
+                        }
+                    }
+                }
+            }
+
+            // check if this object is located inside the area of another object
+            const Point& p = segments->first().p1;
+            quint64 key = cellKey(floorDiv(p.getX().toNm(), mCellSize),
+                                  floorDiv(p.getY().toNm(), mCellSize));
+            foreach (int areaIndex, layer.areaGrid.value(key)) {
+                checkContainment(index, areaIndex, layerName, results);
+            }
+
+            // check if other objects are located inside the areas of this object
+            if (!obj.areas.isEmpty()) {
+                QSet<int> candidates;
+                for (qint64 x = floorDiv(obj.minPos.getX().toNm(), mCellSize);
+                     x <= floorDiv(obj.maxPos.getX().toNm(), mCellSize); ++x) {
+                    for (qint64 y = floorDiv(obj.minPos.getY().toNm(), mCellSize);
+                         y <= floorDiv(obj.maxPos.getY().toNm(), mCellSize); ++y) {
+                        foreach (const Entry& e, layer.grid.value(cellKey(x, y))) {
+                            candidates.insert(e.object);
+                        }
+                    }
+                }
+                foreach (int candidate, candidates) {
+                    checkContainment(candidate, index, layerName, results);
+                }
+            }
+        }
+    }
+
+    QList<Violation> violations;
+    for (auto it = results.constBegin(); it != results.constEnd(); ++it) {
+        violations.append(createViolation(layerName, mObjects[it.key().first],
+                                          mObjects[it.key().second], it->position,
+                                          it->distance));
+    }
+    return violations;
+}
+
+void BoardDesignRuleCheck::checkEntries(const Entry& e1, const Entry& e2,
+                                        const QString& layerName, quint64 cell,
+                                        Results& results) const noexcept
+{
+    Q_UNUSED(layerName);
+    if (e1.object == e2.object) return;
+
+    // only check each pair in the cell containing the bottom left corner of the
+    // overlapping area, to avoid checking the same pair multiple times
+    qint64 x = qMax(e1.x1, e2.x1);
+    qint64 y = qMax(e1.y1, e2.y1);
+    if ((x > qMin(e1.x2, e2.x2)) || (y > qMin(e1.y2, e2.y2))) return;
+    if (cellKey(floorDiv(x, mCellSize), floorDiv(y, mCellSize)) != cell) return;
+
+    Length clearance = getRequiredClearance(mObjects[e1.object], mObjects[e2.object]);
+    if (clearance < 0) return;
+    Point position;
+    Length distance = segmentDistance(e1.segment, e2.segment, position);
+    if ((distance < clearance) || (distance <= 0)) {
+        QPair<int, int> key = qMakePair(qMin(e1.object, e2.object),
+                                        qMax(e1.object, e2.object));
+        auto result = results.find(key);
+        if (result == results.end()) {
+            results.insert(key, Result{distance, position});
+        } else if (distance < result->distance) {
+            *result = Result{distance, position};
+        }
+    }
+}
+
+void BoardDesignRuleCheck::checkContainment(int index, int areaIndex,
+                                            const QString& layerName,
+                                            Results& results) const noexcept
+{
+    if (index == areaIndex) return;
+    QPair<int, int> pair = qMakePair(qMin(index, areaIndex), qMax(index, areaIndex));
+    if (results.contains(pair)) return;
+    const Object& obj = mObjects[index];
+    const Object& area = mObjects[areaIndex];
+    if (getRequiredClearance(obj, area) < 0) return;
+    auto segments = obj.segments.constFind(layerName);
+    if (segments == obj.segments.constEnd()) return;
+    const Point& p = segments->first().p1;
+    foreach (const QVector<Point>& polygon, area.areas) {
+        if (isPointInPolygon(p, polygon)) {
+            results.insert(pair, Result{Length(0), p});
+            return;
+        }
+    }
+}
+
+Length BoardDesignRuleCheck::getRequiredClearance(const Object& obj1,
+                                                  const Object& obj2) const noexcept
+{
+    if (obj1.isBoardEdge && obj2.isBoardEdge) {
+        return Length(-1); // not copper at all
+    } else if (obj1.isBoardEdge || obj2.isBoardEdge) {
+        return mCopperBoardClearance;
+    } else if ((!obj1.netSignal) && (!obj2.netSignal)) {
+        return Length(-1); // both not connected to any net signal
+    } else if (obj1.netSignal == obj2.netSignal) {
+        return Length(-1); // same net signal
+    } else {
+        return mCopperClearance;
+    }
+}
+
+BoardDesignRuleCheck::Violation BoardDesignRuleCheck::createViolation(
+    const QString& layerName, const Object& obj1, const Object& obj2,
+    const Point& position, const Length& distance) const noexcept
+{
+    Violation v;
+    v.layerName = layerName;
+    v.position = position;
+    v.distance = distance;
+    v.clearance = getRequiredClearance(obj1, obj2);
+    v.objectKey1 = obj1.key;
+    v.objectKey2 = obj2.key;
+    if (distance > 0) {
+        v.message = QString(tr("Clearance between %1 and %2 is %3mm (minimum %4mm)"))
+                    .arg(obj1.description, obj2.description, distance.toMmString(),
+                         v.clearance.toMmString());
+    } else {
+        v.message = QString(tr("Overlap of %1 and %2")).arg(obj1.description,
+                                                             obj2.description);
+    }
+    return v;
+}
+
+/*****************************************************************************************
+ *  Helper Methods
+ ****************************************************************************************/
+
+static qreal pointSegmentDistance(qreal px, qreal py, qreal ax, qreal ay, qreal bx,
+                                  qreal by, qreal& nx, qreal& ny) noexcept
+{
+    qreal dx = bx - ax;
+    qreal dy = by - ay;
+    qreal lengthSquared = dx * dx + dy * dy;
+    qreal t = (lengthSquared > 0) ? (((px - ax) * dx + (py - ay) * dy) / lengthSquared) : 0;
+    t = qBound(qreal(0), t, qreal(1));
+    nx = ax + t * dx;
+    ny = ay + t * dy;
+    return qSqrt((px - nx) * (px - nx) + (py - ny) * (py - ny));
+}
+
+Length BoardDesignRuleCheck::segmentDistance(const Segment& s1, const Segment& s2,
+                                             Point& position) noexcept
+{
+    qreal ax = s1.p1.getX().toNm(), ay = s1.p1.getY().toNm();
+    qreal bx = s1.p2.getX().toNm(), by = s1.p2.getY().toNm();
+    qreal cx = s2.p1.getX().toNm(), cy = s2.p1.getY().toNm();
+    qreal dx = s2.p2.getX().toNm(), dy = s2.p2.getY().toNm();
+    qreal radii = s1.radius.toNm() + s2.radius.toNm();
+
+    // check if the segments intersect
+    qreal o1 = (bx - ax) * (cy - ay) - (by - ay) * (cx - ax);
+    qreal o2 = (bx - ax) * (dy - ay) - (by - ay) * (dx - ax);
+    qreal o3 = (dx - cx) * (ay - cy) - (dy - cy) * (ax - cx);
+    qreal o4 = (dx - cx) * (by - cy) - (dy - cy) * (bx - cx);
+    if ((((o1 < 0) && (o2 > 0)) || ((o1 > 0) && (o2 < 0))) &&
+        (((o3 < 0) && (o4 > 0)) || ((o3 > 0) && (o4 < 0))))
+    {
+        qreal t = o3 / (o3 - o4);
+        position = Point(Length(LengthBase_t(qRound64(ax + t * (bx - ax)))),
+                         Length(LengthBase_t(qRound64(ay + t * (by - ay)))));
+        return Length(0);
+    }
+
+    // otherwise the shortest distance is between an end point and the other segment
+    qreal nx, ny, px = ax, py = ay;
+    qreal distance = pointSegmentDistance(ax, ay, cx, cy, dx, dy, nx, ny);
+    qreal nearestX = nx, nearestY = ny;
+    auto check = [&](qreal x, qreal y, qreal x1, qreal y1, qreal x2, qreal y2) {
+        qreal d = pointSegmentDistance(x, y, x1, y1, x2, y2, nx, ny);
+        if (d < distance) {
+            distance = d;
+            px = x; py = y;
+            nearestX = nx; nearestY = ny;
+        }
+    };
+    check(bx, by, cx, cy, dx, dy);
+    check(cx, cy, ax, ay, bx, by);
+    check(dx, dy, ax, ay, bx, by);
+    position = Point(Length(LengthBase_t(qRound64((px + nearestX) / 2))),
+                     Length(LengthBase_t(qRound64((py + nearestY) / 2))));
+    return Length(LengthBase_t(qMax(qreal(0), qFloor(distance - radii))));
+}
+
+bool BoardDesignRuleCheck::isPointInPolygon(const Point& p,
+                                            const QVector<Point>& polygon) noexcept
+{
+    // even-odd rule, which also works for polygons with cut-ins
+    bool inside = false;
+    qreal x = p.getX().toNm(), y = p.getY().toNm();
+    for (int i = 0, j = polygon.count() - 1; i < polygon.count(); j = i++) {
+        qreal xi = polygon[i].getX().toNm(), yi = polygon[i].getY().toNm();
+        qreal xj = polygon[j].getX().toNm(), yj = polygon[j].getY().toNm();
+        if (((yi > y) != (yj > y)) && (x < (xj - xi) * (y - yi) / (yj - yi) + xi)) {
+            inside = !inside;
+        }
+    }
+    return inside;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
@@ -0,0 +1,211 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LIBREPCB_PROJECT_BOARDDESIGNRULECHECK_H
+#define LIBREPCB_PROJECT_BOARDDESIGNRULECHECK_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/units/all_length_units.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class Path;
+
+namespace project {
+
+class Board;
+class NetSignal;
+
+/*****************************************************************************************
+ *  Class BoardDesignRuleCheck
+ ****************************************************************************************/
+
+/**
+ * @brief The BoardDesignRuleCheck class checks the copper clearances of a board
+ *
+ * All copper objects of the board (net lines, vias, pads, plane fragments and copper
+ * polygons) are checked against each other and against the board outline and
+ * non-plated holes, according to the clearances defined in librepcb::BoardDesignRules.
+ * Objects without net signal (e.g. unconnected pads or copper polygons) are not checked
+ * against each other.
+ *
+ * All objects are split into primitives (line segments with a width). For every copper
+ * layer, the primitives are kept in a uniform grid to find candidate pairs (broad
+ * phase), which are then checked with the exact distance between the segments (narrow
+ * phase). Arcs are flattened with a tolerance of 5um. The copper layers are checked in
+ * parallel.
+ *
+ * The primitives and the grid are kept between the runs. Each run only compares a
+ * cheap hash over the properties of every board item with the previous run, and
+ * rebuilds the primitives of modified items only. #runIncremental() then re-checks only
+ * the objects which were added, modified or removed since the last run (e.g. by the
+ * last undo command) by querying the grid around them, and keeps the violations of all
+ * other objects.
+ *
+ * @note The board must not be modified while a check is running.
+ */
+class BoardDesignRuleCheck final
+{
+        Q_DECLARE_TR_FUNCTIONS(BoardDesignRuleCheck)
+
+    public:
+
+        // Types
+        struct Violation {
+            QString layerName;
+            QString message;    ///< Human readable (translated) description
+            Point position;     ///< Location where the clearance is violated
+            Length distance;    ///< Actual distance between the objects (0 if overlapping)
+            Length clearance;   ///< Required clearance between the objects
+            QString objectKey1; ///< Internal identifier of the first object
+            QString objectKey2; ///< Internal identifier of the second object
+        };
+
+        // Constructors / Destructor
+        BoardDesignRuleCheck() = delete;
+        BoardDesignRuleCheck(const BoardDesignRuleCheck& other) = delete;
+        explicit BoardDesignRuleCheck(const Board& board) noexcept;
+        ~BoardDesignRuleCheck() noexcept;
+
+        // Getters
+        const Board& getBoard() const noexcept {return mBoard;}
+        const QList<Violation>& getViolations() const noexcept {return mViolations;}
+
+        // General Methods
+
+        /**
+         * @brief Check the whole board
+         *
+         * @return The number of found violations
+         */
+        int runFull() noexcept;
+
+        /**
+         * @brief Check only the objects which were modified since the last run
+         *
+         * If #runFull() was not called yet or the design rules or the layer stack have
+         * been changed, the whole board is checked.
+         *
+         * @return The number of found violations (of the whole board)
+         */
+        int runIncremental() noexcept;
+
+        // Operator Overloadings
+        BoardDesignRuleCheck& operator=(const BoardDesignRuleCheck& rhs) = delete;
+
+
+    private: // Types
+        struct Segment {
+            Point p1;
+            Point p2;
+            Length radius;  ///< Half of the width (0 for polygon edges)
+        };
+        struct Object {
+            QString key;                    ///< Unique identifier, e.g. "via:<uuid>"
+            QString description;            ///< Human readable name of the object
+            const NetSignal* netSignal = nullptr;   ///< nullptr for unconnected copper
+            bool isBoardEdge = false;       ///< Board outline or non-plated hole
+            uint sourceHash = 0;            ///< Hash over the item properties
+            QHash<QString, QVector<Segment>> segments;  ///< Primitives per layer
+            QVector<QVector<Point>> areas;  ///< Filled areas (closed polygons)
+            Point minPos;                   ///< Bottom left corner of the bounding box
+            Point maxPos;                   ///< Top right corner of the bounding box
+            bool isUsed = false;            ///< Whether the slot in #mObjects is used
+        };
+        struct Entry {          ///< A chunk of a segment in the grid
+            int object;         ///< Index in #mObjects
+            Segment segment;    ///< The whole segment (not only the chunk)
+            qint64 x1, y1, x2, y2;  ///< Bounding box of the chunk, expanded by the margin
+        };
+        struct Layer {
+            QHash<quint64, QVector<Entry>> grid;    ///< Cell -> chunks of segments
+            QHash<quint64, QVector<int>> areaGrid;  ///< Cell -> objects with filled areas
+        };
+        struct Result {
+            Length distance;
+            Point position;
+        };
+        typedef QHash<QPair<int, int>, Result> Results;
+
+
+    private: // Methods
+        int run(bool incremental) noexcept;
+        void reset() noexcept;
+        QSet<int> collectObjects(QSet<QString>& dirtyKeys) noexcept;
+        Object* updateObject(const QString& key, const QString& description,
+                             const NetSignal* netSignal, bool isBoardEdge, uint sourceHash,
+                             QVector<bool>& seen, QSet<int>& dirty) noexcept;
+        void addSegment(Object& obj, const QStringList& layers, const Point& p1,
+                        const Point& p2, const Length& width) noexcept;
+        void addPath(Object& obj, const QStringList& layers, const Path& path,
+                     const Length& width, bool filled) noexcept;
+        void insertIntoGrid(int index) noexcept;
+        void removeFromGrid(int index) noexcept;
+        QVector<Entry> getChunks(int index, const QString& layerName) const noexcept;
+        QList<Violation> checkLayer(const QString& layerName,
+                                    const QSet<int>* dirtyObjects) const noexcept;
+        void checkEntries(const Entry& e1, const Entry& e2, const QString& layerName,
+                          quint64 cell, Results& results) const noexcept;
+        void checkContainment(int index, int areaIndex, const QString& layerName,
+                              Results& results) const noexcept;
+        Length getRequiredClearance(const Object& obj1, const Object& obj2) const noexcept;
+        Violation createViolation(const QString& layerName, const Object& obj1,
+                                  const Object& obj2, const Point& position,
+                                  const Length& distance) const noexcept;
+
+        // Helper Methods
+        static Length segmentDistance(const Segment& s1, const Segment& s2,
+                                      Point& position) noexcept;
+        static bool isPointInPolygon(const Point& p, const QVector<Point>& polygon) noexcept;
+
+
+    private: // Data
+        const Board& mBoard;
+        QStringList mCopperLayers;
+        Length mCopperClearance;
+        Length mCopperBoardClearance;
+        qint64 mMargin;     ///< Half of the biggest clearance [nm]
+        qint64 mCellSize;   ///< Size of the grid cells [nm]
+
+        // Cached objects and spatial index (kept between runs)
+        QVector<Object> mObjects;
+        QVector<int> mFreeObjectSlots;
+        QHash<QString, int> mObjectIndices;
+        QHash<QString, Layer> mLayers;
+
+        // State of the last run
+        bool mHasRun;
+        QList<Violation> mViolations;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_BOARDDESIGNRULECHECK_H
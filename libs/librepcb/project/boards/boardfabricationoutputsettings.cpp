@@ -52,6 +52,7 @@ BoardFabricationOutputSettings::BoardFabricationOutputSettings() noexcept :
     mSilkscreenLayersTop({GraphicsLayer::sTopPlacement, GraphicsLayer::sTopNames}),
     mSilkscreenLayersBot({GraphicsLayer::sBotPlacement, GraphicsLayer::sBotNames}),
     mMergeDrillFiles(false),
+    mOptimizeDrillOrder(false),
     mEnableSolderPasteTop(false),
     mEnableSolderPasteBot(false)
 {
@@ -83,6 +84,9 @@ BoardFabricationOutputSettings::BoardFabricationOutputSettings(const SExpression
     mMergeDrillFiles       = node.getValueByPath<bool   >("drills/merge"           , false);
     mEnableSolderPasteTop  = node.getValueByPath<bool   >("solderpaste_top/create" , false);
     mEnableSolderPasteBot  = node.getValueByPath<bool   >("solderpaste_bot/create" , false);
+    if (const SExpression* child = node.tryGetChildByPath("drills/optimize")) {
+        mOptimizeDrillOrder = child->getValueOfFirstChild<bool>(true); // optional node
+    }
 
     mSilkscreenLayersTop.clear();
     foreach (const SExpression& child, node.getChildByPath("silkscreen_top/layers").getChildren()) {
@@ -125,6 +129,7 @@ void BoardFabricationOutputSettings::serialize(SExpression& root) const
 
     SExpression& drills = root.appendList("drills", true);
     drills.appendTokenChild("merge", mMergeDrillFiles, false);
+    drills.appendTokenChild("optimize", mOptimizeDrillOrder, false);
     drills.appendStringChild("suffix_pth"   , mSuffixDrillsPth , true);
     drills.appendStringChild("suffix_npth"  , mSuffixDrillsNpth, true);
     drills.appendStringChild("suffix_merged", mSuffixDrills    , true);
@@ -162,6 +167,7 @@ BoardFabricationOutputSettings& BoardFabricationOutputSettings::operator=(
     mSilkscreenLayersTop   = rhs.mSilkscreenLayersTop  ;
     mSilkscreenLayersBot   = rhs.mSilkscreenLayersBot  ;
     mMergeDrillFiles       = rhs.mMergeDrillFiles      ;
+    mOptimizeDrillOrder    = rhs.mOptimizeDrillOrder   ;
     mEnableSolderPasteTop  = rhs.mEnableSolderPasteTop ;
     mEnableSolderPasteBot  = rhs.mEnableSolderPasteBot ;
     return *this;
@@ -186,6 +192,7 @@ bool BoardFabricationOutputSettings::operator==(const BoardFabricationOutputSett
     if (mSilkscreenLayersTop   != rhs.mSilkscreenLayersTop  ) return false;
     if (mSilkscreenLayersBot   != rhs.mSilkscreenLayersBot  ) return false;
     if (mMergeDrillFiles       != rhs.mMergeDrillFiles      ) return false;
+    if (mOptimizeDrillOrder    != rhs.mOptimizeDrillOrder   ) return false;
     if (mEnableSolderPasteTop  != rhs.mEnableSolderPasteTop ) return false;
     if (mEnableSolderPasteBot  != rhs.mEnableSolderPasteBot ) return false;
     return true;
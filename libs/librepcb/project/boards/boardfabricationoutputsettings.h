@@ -67,6 +67,7 @@ class BoardFabricationOutputSettings final : public SerializableObject
         const QStringList& getSilkscreenLayersTop() const noexcept {return mSilkscreenLayersTop;}
         const QStringList& getSilkscreenLayersBot() const noexcept {return mSilkscreenLayersBot;}
         bool getMergeDrillFiles()                   const noexcept {return mMergeDrillFiles;}
+        bool getOptimizeDrillOrder()                const noexcept {return mOptimizeDrillOrder;}
         bool getEnableSolderPasteTop()              const noexcept {return mEnableSolderPasteTop;}
         bool getEnableSolderPasteBot()              const noexcept {return mEnableSolderPasteBot;}
 
@@ -88,6 +89,7 @@ class BoardFabricationOutputSettings final : public SerializableObject
         void setSilkscreenLayersTop(const QStringList& l) noexcept {mSilkscreenLayersTop = l;}
         void setSilkscreenLayersBot(const QStringList& l) noexcept {mSilkscreenLayersBot = l;}
         void setMergeDrillFiles(bool m)                   noexcept {mMergeDrillFiles = m;}
+        void setOptimizeDrillOrder(bool o)                noexcept {mOptimizeDrillOrder = o;}
         void setEnableSolderPasteTop(bool e)              noexcept {mEnableSolderPasteTop = e;}
         void setEnableSolderPasteBot(bool e)              noexcept {mEnableSolderPasteBot = e;}
 
@@ -118,6 +120,7 @@ class BoardFabricationOutputSettings final : public SerializableObject
         QStringList mSilkscreenLayersTop;
         QStringList mSilkscreenLayersBot;
         bool mMergeDrillFiles;
+        bool mOptimizeDrillOrder; ///< sort holes to minimize the travel distance
         bool mEnableSolderPasteTop;
         bool mEnableSolderPasteBot;
 };
@@ -28,6 +28,7 @@
 #include <librepcb/common/boarddesignrules.h>
 #include <librepcb/common/geometry/hole.h>
 #include <librepcb/common/attributes/attributesubstitutor.h>
+#include <librepcb/common/font/strokefontpool.h>
 #include <librepcb/library/pkg/footprint.h>
 #include <librepcb/library/pkg/footprintpad.h>
 #include "../metadata/projectmetadata.h"
@@ -81,6 +82,10 @@ FilePath BoardGerberExport::getOutputDirectory() const noexcept
 
 void BoardGerberExport::exportAllLayers() const
 {
+    // texts are only stroked after their font is loaded, so make sure that all fonts
+    // are available before exporting them
+    mProject.getStrokeFonts().waitUntilAllLoaded();
+
     if (mBoard.getFabricationOutputSettings().getMergeDrillFiles()) {
         exportDrills();
     } else {
@@ -129,6 +134,7 @@ QVector<const AttributeProvider*> BoardGerberExport::getAttributeProviderParents
 void BoardGerberExport::exportDrills() const
 {
     ExcellonGenerator gen;
+    gen.setOptimizeDrillOrder(mBoard.getFabricationOutputSettings().getOptimizeDrillOrder());
     drawPthDrills(gen);
     drawNpthDrills(gen);
     gen.generate();
@@ -138,6 +144,7 @@ void BoardGerberExport::exportDrills() const
 void BoardGerberExport::exportDrillsNpth() const
 {
     ExcellonGenerator gen;
+    gen.setOptimizeDrillOrder(mBoard.getFabricationOutputSettings().getOptimizeDrillOrder());
     int count = drawNpthDrills(gen);
     if (count > 0) {
         // Some PCB manufacturers don't like to have separate drill files for PTH and NPTH.
@@ -151,6 +158,7 @@ void BoardGerberExport::exportDrillsNpth() const
 void BoardGerberExport::exportDrillsPth() const
 {
     ExcellonGenerator gen;
+    gen.setOptimizeDrillOrder(mBoard.getFabricationOutputSettings().getOptimizeDrillOrder());
     drawPthDrills(gen);
     gen.generate();
     gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixDrillsPth()));
@@ -160,7 +168,7 @@ void BoardGerberExport::exportLayerBoardOutlines() const
 {
     GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getMetadata().getVersion());
-    drawLayer(gen, GraphicsLayer::sBoardOutlines);
+    drawLayer(gen, GraphicsLayer::Id::BoardOutlines);
     gen.generate();
     gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixOutlines()));
 }
@@ -169,7 +177,7 @@ void BoardGerberExport::exportLayerTopCopper() const
 {
     GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getMetadata().getVersion());
-    drawLayer(gen, GraphicsLayer::sTopCopper);
+    drawLayer(gen, GraphicsLayer::Id::TopCopper);
     gen.generate();
     gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixCopperTop()));
 }
@@ -178,7 +186,7 @@ void BoardGerberExport::exportLayerBottomCopper() const
 {
     GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getMetadata().getVersion());
-    drawLayer(gen, GraphicsLayer::sBotCopper);
+    drawLayer(gen, GraphicsLayer::Id::BotCopper);
     gen.generate();
     gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixCopperBot()));
 }
@@ -189,7 +197,7 @@ void BoardGerberExport::exportLayerInnerCopper() const
         mCurrentInnerCopperLayer = i; // used for attribute provider
         GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                             mBoard.getUuid(), mProject.getMetadata().getVersion());
-        drawLayer(gen, GraphicsLayer::getInnerLayerName(i));
+        drawLayer(gen, GraphicsLayer::getInnerLayerId(i));
         gen.generate();
         gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixCopperInner()));
     }
@@ -200,7 +208,7 @@ void BoardGerberExport::exportLayerTopSolderMask() const
 {
     GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getMetadata().getVersion());
-    drawLayer(gen, GraphicsLayer::sTopStopMask);
+    drawLayer(gen, GraphicsLayer::Id::TopStopMask);
     gen.generate();
     gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixSolderMaskTop()));
 }
@@ -209,7 +217,7 @@ void BoardGerberExport::exportLayerBottomSolderMask() const
 {
     GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getMetadata().getVersion());
-    drawLayer(gen, GraphicsLayer::sBotStopMask);
+    drawLayer(gen, GraphicsLayer::Id::BotStopMask);
     gen.generate();
     gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixSolderMaskBot()));
 }
@@ -221,10 +229,10 @@ void BoardGerberExport::exportLayerTopSilkscreen() const
         GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                             mBoard.getUuid(), mProject.getMetadata().getVersion());
         foreach (const QString& layer, layers) {
-            drawLayer(gen, layer);
+            drawLayer(gen, GraphicsLayer::getLayerId(layer));
         }
         gen.setLayerPolarity(GerberGenerator::LayerPolarity::Negative);
-        drawLayer(gen, GraphicsLayer::sTopStopMask);
+        drawLayer(gen, GraphicsLayer::Id::TopStopMask);
         gen.generate();
         gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixSilkscreenTop()));
     }
@@ -237,10 +245,10 @@ void BoardGerberExport::exportLayerBottomSilkscreen() const
         GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                             mBoard.getUuid(), mProject.getMetadata().getVersion());
         foreach (const QString& layer, layers) {
-            drawLayer(gen, layer);
+            drawLayer(gen, GraphicsLayer::getLayerId(layer));
         }
         gen.setLayerPolarity(GerberGenerator::LayerPolarity::Negative);
-        drawLayer(gen, GraphicsLayer::sBotStopMask);
+        drawLayer(gen, GraphicsLayer::Id::BotStopMask);
         gen.generate();
         gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixSilkscreenBot()));
     }
@@ -250,7 +258,7 @@ void BoardGerberExport::exportLayerTopSolderPaste() const
 {
     GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getMetadata().getVersion());
-    drawLayer(gen, GraphicsLayer::sTopSolderPaste);
+    drawLayer(gen, GraphicsLayer::Id::TopSolderPaste);
     gen.generate();
     gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixSolderPasteTop()));
 }
@@ -259,7 +267,7 @@ void BoardGerberExport::exportLayerBottomSolderPaste() const
 {
     GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getMetadata().getVersion());
-    drawLayer(gen, GraphicsLayer::sBotSolderPaste);
+    drawLayer(gen, GraphicsLayer::Id::BotSolderPaste);
     gen.generate();
     gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixSolderPasteBot()));
 }
@@ -313,24 +321,27 @@ int BoardGerberExport::drawPthDrills(ExcellonGenerator& gen) const
     return count;
 }
 
-void BoardGerberExport::drawLayer(GerberGenerator& gen, const QString& layerName) const
+void BoardGerberExport::drawLayer(GerberGenerator& gen, GraphicsLayer::Id layer) const
 {
+    // library elements still identify their layers by name
+    const QString& layerName = GraphicsLayer::getLayerName(layer);
+
     // draw footprints incl. pads
     foreach (const BI_Device* device, mBoard.getDeviceInstances()) { Q_ASSERT(device);
-        drawFootprint(gen, device->getFootprint(), layerName);
+        drawFootprint(gen, device->getFootprint(), layer);
     }
 
     // draw vias
     foreach (const BI_NetSegment* netsegment, sortedByUuid(mBoard.getNetSegments())) { Q_ASSERT(netsegment);
         foreach (const BI_Via* via, sortedByUuid(netsegment->getVias())) { Q_ASSERT(via);
-            drawVia(gen, *via, layerName);
+            drawVia(gen, *via, layer);
         }
     }
 
     // draw traces
     foreach (const BI_NetSegment* netsegment, sortedByUuid(mBoard.getNetSegments())) { Q_ASSERT(netsegment);
         foreach (const BI_NetLine* netline, sortedByUuid(netsegment->getNetLines())) { Q_ASSERT(netline);
-            if (netline->getLayer().getName() == layerName) {
+            if (netline->getLayer().getId() == layer) {
                 gen.drawLine(netline->getStartPoint().getPosition(),
                              netline->getEndPoint().getPosition(),
                              netline->getWidth());
@@ -340,7 +351,7 @@ void BoardGerberExport::drawLayer(GerberGenerator& gen, const QString& layerName
 
     // draw planes
     foreach (const BI_Plane* plane, sortedByUuid(mBoard.getPlanes())) { Q_ASSERT(plane);
-        if (plane->getLayerName() == layerName) {
+        if (plane->getLayerId() == layer) {
             foreach (const Path& fragment, plane->getFragments()) {
                 gen.drawPathArea(fragment);
             }
@@ -351,7 +362,7 @@ void BoardGerberExport::drawLayer(GerberGenerator& gen, const QString& layerName
     foreach (const BI_Polygon* polygon, sortedByUuid(mBoard.getPolygons())) {
         Q_ASSERT(polygon);
         if (layerName == polygon->getPolygon().getLayerName()) {
-            Length lineWidth = calcWidthOfLayer(polygon->getPolygon().getLineWidth(), layerName);
+            Length lineWidth = calcWidthOfLayer(polygon->getPolygon().getLineWidth(), layer);
             gen.drawPathOutline(polygon->getPolygon().getPath(), lineWidth);
         }
     }
@@ -359,7 +370,7 @@ void BoardGerberExport::drawLayer(GerberGenerator& gen, const QString& layerName
     // draw stroke texts
     foreach (const BI_StrokeText* text, sortedByUuid(mBoard.getStrokeTexts())) { Q_ASSERT(text);
         if (layerName == text->getText().getLayerName()) {
-            Length lineWidth = calcWidthOfLayer(text->getText().getStrokeWidth(), layerName);
+            Length lineWidth = calcWidthOfLayer(text->getText().getStrokeWidth(), layer);
             foreach (Path path, text->getText().getPaths()) {
                 path.rotate(text->getText().getRotation());
                 if (text->getText().getMirrored()) path.mirror(Qt::Horizontal);
@@ -370,10 +381,10 @@ void BoardGerberExport::drawLayer(GerberGenerator& gen, const QString& layerName
     }
 }
 
-void BoardGerberExport::drawVia(GerberGenerator& gen, const BI_Via& via, const QString& layerName) const
+void BoardGerberExport::drawVia(GerberGenerator& gen, const BI_Via& via, GraphicsLayer::Id layer) const
 {
-    bool drawCopper = via.isOnLayer(layerName);
-    bool drawStopMask = (layerName == GraphicsLayer::sTopStopMask || layerName == GraphicsLayer::sBotStopMask)
+    bool drawCopper = via.isOnLayer(layer);
+    bool drawStopMask = (layer == GraphicsLayer::Id::TopStopMask || layer == GraphicsLayer::Id::BotStopMask)
                         && mBoard.getDesignRules().doesViaRequireStopMask(via.getDrillDiameter());
     if (drawCopper || drawStopMask) {
         Length outerDiameter = via.getSize();
@@ -403,22 +414,25 @@ void BoardGerberExport::drawVia(GerberGenerator& gen, const BI_Via& via, const Q
     }
 }
 
-void BoardGerberExport::drawFootprint(GerberGenerator& gen, const BI_Footprint& footprint, const QString& layerName) const
+void BoardGerberExport::drawFootprint(GerberGenerator& gen, const BI_Footprint& footprint, GraphicsLayer::Id layer) const
 {
     // draw pads
     foreach (const BI_FootprintPad* pad, footprint.getPads()) {
-        drawFootprintPad(gen, *pad, layerName);
+        drawFootprintPad(gen, *pad, layer);
     }
 
+    // library footprints still identify their layers by name
+    GraphicsLayer::Id libLayer = footprint.getIsMirrored() ? GraphicsLayer::getMirroredLayerId(layer) : layer;
+    const QString& libLayerName = GraphicsLayer::getLayerName(libLayer);
+
     // draw polygons
     for (const Polygon& polygon : footprint.getLibFootprint().getPolygons().sortedByUuid()) {
-        QString layer = footprint.getIsMirrored() ? GraphicsLayer::getMirroredLayerName(layerName) : layerName;
-        if (layer == polygon.getLayerName()) {
+        if (libLayerName == polygon.getLayerName()) {
             Path path = polygon.getPath();
             path.rotate(footprint.getRotation());
             if (footprint.getIsMirrored()) path.mirror(Qt::Horizontal);
             path.translate(footprint.getPosition());
-            gen.drawPathOutline(path, calcWidthOfLayer(polygon.getLineWidth(), layer));
+            gen.drawPathOutline(path, calcWidthOfLayer(polygon.getLineWidth(), libLayer));
             if (polygon.isFilled()) {
                 gen.drawPathArea(path);
             }
@@ -427,13 +441,12 @@ void BoardGerberExport::drawFootprint(GerberGenerator& gen, const BI_Footprint&
 
     // draw ellipses
     for (const Ellipse& ellipse : footprint.getLibFootprint().getEllipses().sortedByUuid()) {
-        QString layer = footprint.getIsMirrored() ? GraphicsLayer::getMirroredLayerName(layerName) : layerName;
-        if (layer == ellipse.getLayerName()) {
+        if (libLayerName == ellipse.getLayerName()) {
             Ellipse e = ellipse;
             e.rotate(footprint.getRotation());
             if (footprint.getIsMirrored()) e.mirror(Qt::Horizontal);
             e.translate(footprint.getPosition());
-            e.setLineWidth(calcWidthOfLayer(e.getLineWidth(), layer));
+            e.setLineWidth(calcWidthOfLayer(e.getLineWidth(), libLayer));
             gen.drawEllipseOutline(e);
             if (e.isFilled()) {
                 gen.drawEllipseArea(e);
@@ -442,9 +455,10 @@ void BoardGerberExport::drawFootprint(GerberGenerator& gen, const BI_Footprint&
     }
 
     // draw stroke texts (from footprint instance, *NOT* from library footprint!)
+    const QString& layerName = GraphicsLayer::getLayerName(layer);
     foreach (const BI_StrokeText* text, sortedByUuid(footprint.getStrokeTexts())) {
         if (layerName == text->getText().getLayerName()) {
-            Length lineWidth = calcWidthOfLayer(text->getText().getStrokeWidth(), layerName);
+            Length lineWidth = calcWidthOfLayer(text->getText().getStrokeWidth(), layer);
             foreach (Path path, text->getText().getPaths()) {
                 path.rotate(text->getText().getRotation());
                 if (text->getText().getMirrored()) path.mirror(Qt::Horizontal);
@@ -455,14 +469,14 @@ void BoardGerberExport::drawFootprint(GerberGenerator& gen, const BI_Footprint&
     }
 }
 
-void BoardGerberExport::drawFootprintPad(GerberGenerator& gen, const BI_FootprintPad& pad, const QString& layerName) const
+void BoardGerberExport::drawFootprintPad(GerberGenerator& gen, const BI_FootprintPad& pad, GraphicsLayer::Id layer) const
 {
     bool isSmt = pad.getLibPad().getBoardSide() != library::FootprintPad::BoardSide::THT;
-    bool isOnCopperLayer = pad.isOnLayer(layerName);
-    bool isOnSolderMaskTop = pad.isOnLayer(GraphicsLayer::sTopCopper) && (layerName == GraphicsLayer::sTopStopMask);
-    bool isOnSolderMaskBottom = pad.isOnLayer(GraphicsLayer::sBotCopper) && (layerName == GraphicsLayer::sBotStopMask);
-    bool isOnSolderPasteTop = isSmt && pad.isOnLayer(GraphicsLayer::sTopCopper) && (layerName == GraphicsLayer::sTopSolderPaste);
-    bool isOnSolderPasteBottom = isSmt && pad.isOnLayer(GraphicsLayer::sBotCopper) && (layerName == GraphicsLayer::sBotSolderPaste);
+    bool isOnCopperLayer = pad.isOnLayer(layer);
+    bool isOnSolderMaskTop = pad.isOnLayer(GraphicsLayer::Id::TopCopper) && (layer == GraphicsLayer::Id::TopStopMask);
+    bool isOnSolderMaskBottom = pad.isOnLayer(GraphicsLayer::Id::BotCopper) && (layer == GraphicsLayer::Id::BotStopMask);
+    bool isOnSolderPasteTop = isSmt && pad.isOnLayer(GraphicsLayer::Id::TopCopper) && (layer == GraphicsLayer::Id::TopSolderPaste);
+    bool isOnSolderPasteBottom = isSmt && pad.isOnLayer(GraphicsLayer::Id::BotCopper) && (layer == GraphicsLayer::Id::BotSolderPaste);
     if (!isOnCopperLayer && !isOnSolderMaskTop && !isOnSolderMaskBottom && !isOnSolderPasteTop && !isOnSolderPasteBottom) {
         return;
     }
@@ -534,9 +548,9 @@ FilePath BoardGerberExport::getOutputFilePath(const QString& suffix) const noexc
  *  Static Methods
  ****************************************************************************************/
 
-Length BoardGerberExport::calcWidthOfLayer(const Length& width, const QString& name) noexcept
+Length BoardGerberExport::calcWidthOfLayer(const Length& width, GraphicsLayer::Id layer) noexcept
 {
-    if ((name == GraphicsLayer::sBoardOutlines) && (width < Length(1000))) {
+    if ((layer == GraphicsLayer::Id::BoardOutlines) && (width < Length(1000))) {
         return Length(1000); // outlines should have a minimum width of 1um
     } else {
         return width;
@@ -26,6 +26,7 @@
 #include <QtCore>
 #include <librepcb/common/attributes/attributeprovider.h>
 #include <librepcb/common/fileio/filepath.h>
+#include <librepcb/common/graphics/graphicslayer.h>
 #include <librepcb/common/units/all_length_units.h>
 
 /*****************************************************************************************
@@ -107,15 +108,15 @@ class BoardGerberExport final : public QObject, public AttributeProvider
 
         int drawNpthDrills(ExcellonGenerator& gen) const;
         int drawPthDrills(ExcellonGenerator& gen) const;
-        void drawLayer(GerberGenerator& gen, const QString& layerName) const;
-        void drawVia(GerberGenerator& gen, const BI_Via& via, const QString& layerName) const;
-        void drawFootprint(GerberGenerator& gen, const BI_Footprint& footprint, const QString& layerName) const;
-        void drawFootprintPad(GerberGenerator& gen, const BI_FootprintPad& pad, const QString& layerName) const;
+        void drawLayer(GerberGenerator& gen, GraphicsLayer::Id layer) const;
+        void drawVia(GerberGenerator& gen, const BI_Via& via, GraphicsLayer::Id layer) const;
+        void drawFootprint(GerberGenerator& gen, const BI_Footprint& footprint, GraphicsLayer::Id layer) const;
+        void drawFootprintPad(GerberGenerator& gen, const BI_FootprintPad& pad, GraphicsLayer::Id layer) const;
 
         FilePath getOutputFilePath(const QString& suffix) const noexcept;
 
         // Static Methods
-        static Length calcWidthOfLayer(const Length& width, const QString& name) noexcept;
+        static Length calcWidthOfLayer(const Length& width, GraphicsLayer::Id layer) noexcept;
         template <typename T>
         static QList<T*> sortedByUuid(const QList<T*>& list) noexcept {
             // sort a list of objects by their UUID to get reproducable gerber files
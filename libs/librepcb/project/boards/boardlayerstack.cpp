@@ -73,6 +73,7 @@ BoardLayerStack::BoardLayerStack(Board& board) :
 
 BoardLayerStack::~BoardLayerStack() noexcept
 {
+    mLayersById.clear();
     qDeleteAll(mLayers); mLayers.clear();
 }
 
@@ -203,6 +204,7 @@ void BoardLayerStack::addAllLayers() noexcept
     addLayer(GraphicsLayer::sBoardDocumentation);
     addLayer(GraphicsLayer::sBoardComments);
     addLayer(GraphicsLayer::sBoardGuide);
+    addLayer(GraphicsLayer::sBoardAirWires);
 
 #ifdef QT_DEBUG
     // debug layers
@@ -222,6 +224,14 @@ void BoardLayerStack::addLayer(const QString& name, bool disable) noexcept
 
 void BoardLayerStack::addLayer(GraphicsLayer* layer) noexcept
 {
+    Q_ASSERT(layer->getId() != GraphicsLayer::Id::Unknown);
+    if (mLayersById.isEmpty()) {
+        mLayersById.fill(nullptr, static_cast<int>(GraphicsLayer::Id::_COUNT));
+    }
+    if (layer->getId() != GraphicsLayer::Id::Unknown) {
+        // slot 0 (Id::Unknown) is never used, see #getLayer()
+        mLayersById[static_cast<int>(layer->getId())] = layer;
+    }
     connect(layer, &GraphicsLayer::attributesChanged,
             this, &BoardLayerStack::layerAttributesChanged,
             Qt::QueuedConnection);
@@ -68,12 +68,13 @@ class BoardLayerStack final : public QObject, public SerializableObject,
 
         /// @copydoc IF_BoardLayerProvider#getLayer()
         GraphicsLayer* getLayer(const QString& name) const noexcept override {
-            foreach (GraphicsLayer* layer, mLayers) {
-                if (layer->getName() == name) {
-                    return layer;
-                }
-            }
-            return nullptr;
+            return getLayer(GraphicsLayer::getLayerId(name));
+        }
+
+        /// @copydoc IF_BoardLayerProvider#getLayer()
+        GraphicsLayer* getLayer(GraphicsLayer::Id id) const noexcept override {
+            if (id == GraphicsLayer::Id::Unknown) return nullptr;
+            return mLayersById.value(static_cast<int>(id), nullptr);
         }
 
         // Setters
@@ -102,6 +103,7 @@ class BoardLayerStack final : public QObject, public SerializableObject,
         // General
         Board& mBoard; ///< A reference to the Board object (from the ctor)
         QList<GraphicsLayer*> mLayers;
+        QVector<GraphicsLayer*> mLayersById; ///< all layers of #mLayers, indexed by ID
         bool mLayersChanged;
 
         // Settings
@@ -127,7 +127,7 @@ void BoardPlaneFragmentsBuilder::subtractOtherObjects()
     foreach (const BI_Plane* plane, mPlane.getBoard().getPlanes()) {
         if (plane == &mPlane) continue;
         if (*plane < mPlane) continue; // ignore planes with lower priority
-        if (plane->getLayerName() != mPlane.getLayerName()) continue;
+        if (plane->getLayerId() != mPlane.getLayerId()) continue;
         if (&plane->getNetSignal() == &mPlane.getNetSignal()) continue;
         ClipperLib::Paths paths = ClipperHelpers::convert(plane->getFragments(),
                                                           maxArcTolerance());
@@ -145,7 +145,7 @@ void BoardPlaneFragmentsBuilder::subtractOtherObjects()
                       ClipperLib::ptClip, true);
         }
         foreach (const BI_FootprintPad* pad, device->getFootprint().getPads()) {
-            if (!pad->isOnLayer(mPlane.getLayerName())) continue;
+            if (!pad->isOnLayer(mPlane.getLayerId())) continue;
             if (pad->getCompSigInstNetSignal() == &mPlane.getNetSignal()) {
                 ClipperLib::Path path = ClipperHelpers::convert(pad->getSceneOutline(),
                                                                 maxArcTolerance());
@@ -178,7 +178,7 @@ void BoardPlaneFragmentsBuilder::subtractOtherObjects()
 
         // subtract netlines
         foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
-            if (netline->getLayer().getName() != mPlane.getLayerName()) continue;
+            if (netline->getLayer().getId() != mPlane.getLayerId()) continue;
             if (&netsegment->getNetSignal() == &mPlane.getNetSignal()) {
                 ClipperLib::Path path = ClipperHelpers::convert(netline->getSceneOutline(),
                                                                 maxArcTolerance());
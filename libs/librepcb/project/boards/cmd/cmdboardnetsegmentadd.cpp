@@ -53,6 +53,16 @@ CmdBoardNetSegmentAdd::~CmdBoardNetSegmentAdd() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdBoardNetSegmentAdd::getApproxMemoryUsage() const noexcept
+{
+    return UndoCommand::getApproxMemoryUsage() + sizeof(*this) - sizeof(UndoCommand) +
+           (mNetSegment ? mNetSegment->getApproxMemoryUsage() : 0);
+}
+
 /*****************************************************************************************
  *  Inherited from UndoCommand
  ****************************************************************************************/
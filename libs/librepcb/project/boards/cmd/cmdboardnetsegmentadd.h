@@ -53,6 +53,8 @@ class CmdBoardNetSegmentAdd final : public UndoCommand
         ~CmdBoardNetSegmentAdd() noexcept;
 
         // Getters
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
         BI_NetSegment* getNetSegment() const noexcept {return mNetSegment;}
 
 
@@ -46,6 +46,17 @@ CmdBoardNetSegmentAddElements::~CmdBoardNetSegmentAddElements() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdBoardNetSegmentAddElements::getApproxMemoryUsage() const noexcept
+{
+    return UndoCommand::getApproxMemoryUsage() + sizeof(*this) - sizeof(UndoCommand) +
+           (mVias.count() * sizeof(BI_Via)) + (mNetPoints.count() * sizeof(BI_NetPoint)) +
+           (mNetLines.count() * sizeof(BI_NetLine));
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -58,6 +58,10 @@ class CmdBoardNetSegmentAddElements final : public UndoCommand
         CmdBoardNetSegmentAddElements(BI_NetSegment& segment) noexcept;
         ~CmdBoardNetSegmentAddElements() noexcept;
 
+        // Getters
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
+
         // General Methods
         BI_Via* addVia(BI_Via& via);
         BI_Via* addVia(const Point& position, BI_Via::Shape shape,
@@ -45,6 +45,16 @@ CmdBoardNetSegmentRemove::~CmdBoardNetSegmentRemove() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdBoardNetSegmentRemove::getApproxMemoryUsage() const noexcept
+{
+    return UndoCommand::getApproxMemoryUsage() + sizeof(*this) - sizeof(UndoCommand) +
+           mNetSegment.getApproxMemoryUsage();
+}
+
 /*****************************************************************************************
  *  Inherited from UndoCommand
  ****************************************************************************************/
@@ -50,6 +50,10 @@ class CmdBoardNetSegmentRemove final : public UndoCommand
         explicit CmdBoardNetSegmentRemove(BI_NetSegment& segment) noexcept;
         ~CmdBoardNetSegmentRemove() noexcept;
 
+        // Getters
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
+
 
     private:
 
@@ -26,6 +26,7 @@
 #include "../items/bi_netpoint.h"
 #include "../items/bi_netline.h"
 #include "../items/bi_netsegment.h"
+#include "../items/bi_via.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -47,6 +48,17 @@ CmdBoardNetSegmentRemoveElements::~CmdBoardNetSegmentRemoveElements() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdBoardNetSegmentRemoveElements::getApproxMemoryUsage() const noexcept
+{
+    return UndoCommand::getApproxMemoryUsage() + sizeof(*this) - sizeof(UndoCommand) +
+           (mVias.count() * sizeof(BI_Via)) + (mNetPoints.count() * sizeof(BI_NetPoint)) +
+           (mNetLines.count() * sizeof(BI_NetLine));
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
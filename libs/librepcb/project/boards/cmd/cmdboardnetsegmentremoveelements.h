@@ -52,6 +52,10 @@ class CmdBoardNetSegmentRemoveElements final : public UndoCommand
         CmdBoardNetSegmentRemoveElements(BI_NetSegment& segment) noexcept;
         ~CmdBoardNetSegmentRemoveElements() noexcept;
 
+        // Getters
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
+
         // General Methods
         void removeVia(BI_Via& via);
         void removeNetPoint(BI_NetPoint& netpoint);
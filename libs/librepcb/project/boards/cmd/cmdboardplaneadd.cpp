@@ -45,6 +45,16 @@ CmdBoardPlaneAdd::~CmdBoardPlaneAdd() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdBoardPlaneAdd::getApproxMemoryUsage() const noexcept
+{
+    return UndoCommand::getApproxMemoryUsage() + sizeof(*this) - sizeof(UndoCommand) +
+           mPlane.getApproxMemoryUsage();
+}
+
 /*****************************************************************************************
  *  Inherited from UndoCommand
  ****************************************************************************************/
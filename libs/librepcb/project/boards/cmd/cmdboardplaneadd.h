@@ -52,6 +52,10 @@ class CmdBoardPlaneAdd final : public UndoCommand
         explicit CmdBoardPlaneAdd(BI_Plane& plane) noexcept;
         ~CmdBoardPlaneAdd() noexcept;
 
+        // Getters
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
+
 
     private: // Methods
 
@@ -55,6 +55,17 @@ CmdBoardPlaneEdit::~CmdBoardPlaneEdit() noexcept
     }
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdBoardPlaneEdit::getApproxMemoryUsage() const noexcept
+{
+    return UndoCommand::getApproxMemoryUsage() + sizeof(*this) - sizeof(UndoCommand) +
+           ((mOldOutline.getVertices().capacity() +
+             mNewOutline.getVertices().capacity()) * sizeof(Vertex));
+}
+
 /*****************************************************************************************
  *  Setters
  ****************************************************************************************/
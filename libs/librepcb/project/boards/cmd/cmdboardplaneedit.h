@@ -51,6 +51,10 @@ class CmdBoardPlaneEdit final : public UndoCommand
         CmdBoardPlaneEdit(BI_Plane& plane, bool rebuildOnChanges) noexcept;
         ~CmdBoardPlaneEdit() noexcept;
 
+        // Getters
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
+
         // Setters
         void setDeltaToStartPos(const Point& deltaPos, bool immediate) noexcept;
         void rotate(const Angle& angle, const Point& center, bool immediate) noexcept;
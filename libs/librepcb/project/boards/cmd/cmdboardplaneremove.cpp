@@ -45,6 +45,16 @@ CmdBoardPlaneRemove::~CmdBoardPlaneRemove() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdBoardPlaneRemove::getApproxMemoryUsage() const noexcept
+{
+    return UndoCommand::getApproxMemoryUsage() + sizeof(*this) - sizeof(UndoCommand) +
+           mPlane.getApproxMemoryUsage();
+}
+
 /*****************************************************************************************
  *  Inherited from UndoCommand
  ****************************************************************************************/
@@ -50,6 +50,10 @@ class CmdBoardPlaneRemove final : public UndoCommand
         explicit CmdBoardPlaneRemove(BI_Plane& plane) noexcept;
         ~CmdBoardPlaneRemove() noexcept;
 
+        // Getters
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
+
 
     private:
 
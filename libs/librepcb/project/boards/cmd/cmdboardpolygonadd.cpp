@@ -45,6 +45,16 @@ CmdBoardPolygonAdd::~CmdBoardPolygonAdd() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdBoardPolygonAdd::getApproxMemoryUsage() const noexcept
+{
+    return UndoCommand::getApproxMemoryUsage() + sizeof(*this) - sizeof(UndoCommand) +
+           mPolygon.getApproxMemoryUsage();
+}
+
 /*****************************************************************************************
  *  Inherited from UndoCommand
  ****************************************************************************************/
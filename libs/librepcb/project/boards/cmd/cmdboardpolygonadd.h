@@ -53,6 +53,8 @@ class CmdBoardPolygonAdd final : public UndoCommand
         ~CmdBoardPolygonAdd() noexcept;
 
         // Getters
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
         //BI_Device* getDeviceInstance() const noexcept {return mDeviceInstance;}
 
 
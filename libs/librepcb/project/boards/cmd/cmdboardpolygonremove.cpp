@@ -45,6 +45,16 @@ CmdBoardPolygonRemove::~CmdBoardPolygonRemove() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdBoardPolygonRemove::getApproxMemoryUsage() const noexcept
+{
+    return UndoCommand::getApproxMemoryUsage() + sizeof(*this) - sizeof(UndoCommand) +
+           mPolygon.getApproxMemoryUsage();
+}
+
 /*****************************************************************************************
  *  Inherited from UndoCommand
  ****************************************************************************************/
@@ -50,6 +50,10 @@ class CmdBoardPolygonRemove final : public UndoCommand
         explicit CmdBoardPolygonRemove(BI_Polygon& polygon) noexcept;
         ~CmdBoardPolygonRemove() noexcept;
 
+        // Getters
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
+
 
     private:
 
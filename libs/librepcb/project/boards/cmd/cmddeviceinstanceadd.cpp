@@ -57,6 +57,16 @@ CmdDeviceInstanceAdd::~CmdDeviceInstanceAdd() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdDeviceInstanceAdd::getApproxMemoryUsage() const noexcept
+{
+    return UndoCommand::getApproxMemoryUsage() + sizeof(*this) - sizeof(UndoCommand) +
+           (mDeviceInstance ? mDeviceInstance->getApproxMemoryUsage() : 0);
+}
+
 /*****************************************************************************************
  *  Inherited from UndoCommand
  ****************************************************************************************/
@@ -62,6 +62,8 @@ class CmdDeviceInstanceAdd final : public UndoCommand
         ~CmdDeviceInstanceAdd() noexcept;
 
         // Getters
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
         BI_Device* getDeviceInstance() const noexcept {return mDeviceInstance;}
 
 
@@ -50,6 +50,10 @@ class CmdDeviceInstanceRemove final : public UndoCommand
         CmdDeviceInstanceRemove(Board& board, BI_Device& dev) noexcept;
         ~CmdDeviceInstanceRemove() noexcept;
 
+        // Getters
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
+
 
     private:
 
@@ -21,6 +21,8 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QtWidgets>
+#include <QPrinter>
 #include "bgi_base.h"
 #include <librepcb/common/graphics/graphicslayer.h>
 #include "../board.h"
@@ -65,6 +67,40 @@ qreal BGI_Base::getZValueOfCopperLayer(const QString& name) noexcept
     }
 }
 
+BGI_Base::DetailLevel BGI_Base::getDetailLevel(const QPainter& painter,
+                                               const QStyleOptionGraphicsItem& option,
+                                               const QRectF& rect) noexcept
+{
+    // sizes on the screen (in pixels) below which the details are reduced
+    static const qreal sMinimalDetailSize = 4;
+    static const qreal sFullDetailSize = 24;
+
+    if (dynamic_cast<QPrinter*>(painter.device())) {
+        return DetailLevel::Full; // never omit anything in exported files
+    }
+
+    qreal lod = option.levelOfDetailFromTransform(painter.worldTransform());
+    qreal size = lod * qMax(rect.width(), rect.height());
+    if (size < sMinimalDetailSize) {
+        return DetailLevel::Minimal;
+    } else if (size < sFullDetailSize) {
+        return DetailLevel::Reduced;
+    } else {
+        return DetailLevel::Full;
+    }
+}
+
+qreal BGI_Base::getPenWidth(const QPainter& painter, const QStyleOptionGraphicsItem& option,
+                            qreal width) noexcept
+{
+    if (dynamic_cast<QPrinter*>(painter.device())) {
+        return width; // exact line widths in exported files
+    }
+
+    qreal lod = option.levelOfDetailFromTransform(painter.worldTransform());
+    return (lod * width < 1) ? 0 : width;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
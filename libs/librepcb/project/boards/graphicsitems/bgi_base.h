@@ -51,8 +51,50 @@ class BGI_Base : public QGraphicsItem
 
     protected:
 
+        /**
+         * @brief The level of detail an item should be painted with
+         *
+         * Items which appear very small on the screen don't need to be painted exactly,
+         * so the paint() methods use this to skip details (e.g. texts) or to draw
+         * simplified shapes (e.g. bounding rects instead of paths) when zoomed out.
+         */
+        enum class DetailLevel {
+            Minimal,    ///< Only a rough outline (e.g. the bounding rect) is visible
+            Reduced,    ///< Shapes are visible, but texts would be too small to read
+            Full,       ///< Everything is visible
+        };
+
         static qreal getZValueOfCopperLayer(const QString& name) noexcept;
 
+        /**
+         * @brief Get the level of detail to paint an item with
+         *
+         * @param painter   The painter passed to paint()
+         * @param option    The style option passed to paint()
+         * @param rect      The area of the relevant part of the item (in item coordinates)
+         *
+         * @return Full details for printers (exports), otherwise the detail level
+         *         depending on the size of the given rect on the screen
+         */
+        static DetailLevel getDetailLevel(const QPainter& painter,
+                                          const QStyleOptionGraphicsItem& option,
+                                          const QRectF& rect) noexcept;
+
+        /**
+         * @brief Get the pen width to draw a line with the given width
+         *
+         * Lines which are thinner than one pixel on the screen are drawn with a cosmetic
+         * pen (width 0) since they look the same, but are much faster to draw.
+         *
+         * @param painter   The painter passed to paint()
+         * @param option    The style option passed to paint()
+         * @param width     The width of the line (in pixels of the scene)
+         *
+         * @return The pen width to use
+         */
+        static qreal getPenWidth(const QPainter& painter, const QStyleOptionGraphicsItem& option,
+                                 qreal width) noexcept;
+
 
     private:
 
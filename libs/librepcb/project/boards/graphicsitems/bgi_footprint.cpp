@@ -58,7 +58,7 @@ BGI_Footprint::~BGI_Footprint() noexcept
 
 bool BGI_Footprint::isSelectable() const noexcept
 {
-    GraphicsLayer* layer = getLayer(GraphicsLayer::sTopReferences);
+    GraphicsLayer* layer = getLayer(GraphicsLayer::Id::TopReferences);
     return layer && layer->isVisible();
 }
 
@@ -73,6 +73,7 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept
 
     mBoundingRect = QRectF();
     mShape = QPainterPath();
+    mBatches.clear();
 
     // set Z value
     if (mFootprint.getIsMirrored())
@@ -81,7 +82,7 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept
         setZValue(Board::ZValue_FootprintsTop);
 
     // cross rect
-    layer = getLayer(GraphicsLayer::sTopReferences);
+    layer = getLayer(GraphicsLayer::Id::TopReferences);
     if (layer) {
         if (layer->isVisible()) {
             qreal width = Length(700000).toPx();
@@ -95,18 +96,51 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept
     for (const Polygon& polygon : mLibFootprint.getPolygons()) {
         layer = getLayer(polygon.getLayerName());
         if (!layer) continue;
-        if (!layer->isVisible()) continue;
 
+        // the batches are built for all layers since paint() checks the visibility
         QPainterPath polygonPath = polygon.getPath().toQPainterPathPx();
+        GraphicsLayer* fillLayer = nullptr;
+        if (polygon.isFilled())
+            fillLayer = layer;
+        else if (polygon.isGrabArea())
+            fillLayer = getLayer(GraphicsLayer::Id::TopGrabAreas);
+        addToBatch(layer, polygon.getLineWidth().toPx(), fillLayer, polygonPath);
+        if (!layer->isVisible()) continue;
+
         qreal w = polygon.getLineWidth().toPx() / 2;
         mBoundingRect = mBoundingRect.united(polygonPath.boundingRect().adjusted(-w, -w, w, w));
         if (!polygon.isGrabArea()) continue;
-        layer = getLayer(GraphicsLayer::sTopGrabAreas);
+        layer = getLayer(GraphicsLayer::Id::TopGrabAreas);
         if (!layer) continue;
         if (!layer->isVisible()) continue;
         mShape = mShape.united(polygonPath);
     }
 
+    // ellipses
+    for (const Ellipse& ellipse : mLibFootprint.getEllipses()) {
+        layer = getLayer(ellipse.getLayerName());
+        if (!layer) continue;
+
+        QPainterPath ellipsePath; // TODO: rotation
+        ellipsePath.addEllipse(ellipse.getCenter().toPxQPointF(), ellipse.getRadiusX().toPx(),
+                               ellipse.getRadiusY().toPx());
+        GraphicsLayer* fillLayer = nullptr;
+        if (ellipse.isFilled())
+            fillLayer = layer;
+        else if (ellipse.isGrabArea())
+            fillLayer = getLayer(GraphicsLayer::Id::TopGrabAreas);
+        addToBatch(layer, ellipse.getLineWidth().toPx(), fillLayer, ellipsePath);
+    }
+
+    // holes
+    for (const Hole& hole : mLibFootprint.getHoles()) {
+        qreal radius = (hole.getDiameter() / 2).toPx();
+        QPainterPath holePath;
+        holePath.addEllipse(hole.getPosition().toPxQPointF(), radius, radius);
+        layer = getLayer(GraphicsLayer::Id::BoardDrillsNpth);
+        addToBatch(layer, 0, layer, holePath);
+    }
+
     if (!mShape.isEmpty())
         mShape.setFillRule(Qt::WindingFill);
 
@@ -121,101 +155,36 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept
 
 void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
-    Q_UNUSED(option);
     Q_UNUSED(widget);
 
     const GraphicsLayer* layer = 0;
     const bool selected = mFootprint.isSelected();
     const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
+    const DetailLevel detail = getDetailLevel(*painter, *option, mBoundingRect);
 
-    // draw all polygons
-    for (const Polygon& polygon : mLibFootprint.getPolygons()) {
-        // get layer
-        layer = getLayer(polygon.getLayerName());
-        if (!layer) continue;
-        if (!layer->isVisible()) continue;
+    // draw all polygons, ellipses and holes (in their original order)
+    foreach (const LayerBatch& batch, mBatches) {
+        if (!batch.layer->isVisible()) continue;
 
         // set pen
-        if (polygon.getLineWidth() > 0)
-            painter->setPen(QPen(layer->getColor(selected), polygon.getLineWidth().toPx(), Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
+        if (batch.penWidth > 0)
+            painter->setPen(QPen(batch.layer->getColor(selected), getPenWidth(*painter, *option, batch.penWidth), Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
         else
             painter->setPen(Qt::NoPen);
 
         // set brush
-        if (!polygon.isFilled()) {
-            if (polygon.isGrabArea())
-                layer = getLayer(GraphicsLayer::sTopGrabAreas);
-            else
-                layer = nullptr;
-        }
-        if (layer) {
-            if (layer->isVisible())
-                painter->setBrush(QBrush(layer->getColor(selected), Qt::SolidPattern));
-            else
-                painter->setBrush(Qt::NoBrush);
-        } else {
-            painter->setBrush(Qt::NoBrush);
-        }
-
-        // draw polygon
-        painter->drawPath(polygon.getPath().toQPainterPathPx());
-    }
-
-    // draw all ellipses
-    for (const Ellipse& ellipse : mLibFootprint.getEllipses()) {
-        // get layer
-        layer = getLayer(ellipse.getLayerName());
-        if (!layer) continue;
-        if (!layer->isVisible()) continue;
-
-        // set pen
-        if (ellipse.getLineWidth() > 0)
-            painter->setPen(QPen(layer->getColor(selected), ellipse.getLineWidth().toPx(), Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
+        if (batch.fillLayer && batch.fillLayer->isVisible())
+            painter->setBrush(QBrush(batch.fillLayer->getColor(selected), Qt::SolidPattern));
         else
-            painter->setPen(Qt::NoPen);
-
-        // set brush
-        if (!ellipse.isFilled()) {
-            if (ellipse.isGrabArea())
-                layer = getLayer(GraphicsLayer::sTopGrabAreas);
-            else
-                layer = nullptr;
-        }
-        if (layer) {
-            if (layer->isVisible())
-                painter->setBrush(QBrush(layer->getColor(selected), Qt::SolidPattern));
-            else
-                painter->setBrush(Qt::NoBrush);
-        } else {
             painter->setBrush(Qt::NoBrush);
-        }
 
-        // draw ellipse
-        painter->drawEllipse(ellipse.getCenter().toPxQPointF(), ellipse.getRadiusX().toPx(),
-                             ellipse.getRadiusY().toPx());
-        // TODO: rotation
-    }
-
-    // draw all holes
-    for (const Hole& hole : mLibFootprint.getHoles()) {
-        // get layer
-        layer = getLayer(GraphicsLayer::sBoardDrillsNpth);
-        if (!layer) continue;
-        if (!layer->isVisible()) continue;
-
-        // set pen/brush
-        painter->setPen(Qt::NoPen);
-        painter->setBrush(QBrush(layer->getColor(selected), Qt::SolidPattern));
-
-        // draw hole
-        qreal radius = (hole.getDiameter() / 2).toPx();
-        painter->drawEllipse(hole.getPosition().toPxQPointF(), radius, radius);
+        painter->drawPath(batch.path);
     }
 
     // draw origin cross
-    layer = getLayer(GraphicsLayer::sTopReferences);
+    layer = getLayer(GraphicsLayer::Id::TopReferences);
     if (layer) {
-        if ((!deviceIsPrinter) && layer->isVisible()) {
+        if ((!deviceIsPrinter) && (detail == DetailLevel::Full) && layer->isVisible()) {
             qreal width = Length(700000).toPx();
             painter->setPen(QPen(layer->getColor(selected), 0));
             painter->drawLine(-width, 0, width, 0);
@@ -225,7 +194,7 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
 
 #ifdef QT_DEBUG
     // draw bounding rect
-    layer = getLayer(GraphicsLayer::sDebugGraphicsItemsBoundingRects);
+    layer = getLayer(GraphicsLayer::Id::DebugGraphicsItemsBoundingRects);
     if (layer) {
         if (layer->isVisible()) {
             painter->setPen(QPen(layer->getColor(selected), 0));
@@ -240,10 +209,40 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
  *  Private Methods
  ****************************************************************************************/
 
-GraphicsLayer* BGI_Footprint::getLayer(QString name) const noexcept
+GraphicsLayer* BGI_Footprint::getLayer(const QString& name) const noexcept
+{
+    return getLayer(GraphicsLayer::getLayerId(name));
+}
+
+GraphicsLayer* BGI_Footprint::getLayer(GraphicsLayer::Id id) const noexcept
+{
+    if (mFootprint.getIsMirrored()) id = GraphicsLayer::getMirroredLayerId(id);
+    return mFootprint.getDeviceInstance().getBoard().getLayerStack().getLayer(id);
+}
+
+void BGI_Footprint::addToBatch(GraphicsLayer* layer, qreal penWidth,
+                               GraphicsLayer* fillLayer, const QPainterPath& path) noexcept
 {
-    if (mFootprint.getIsMirrored()) name = GraphicsLayer::getMirroredLayerName(name);
-    return mFootprint.getDeviceInstance().getBoard().getLayerStack().getLayer(name);
+    if (!layer) return;
+
+    // Only merge with the previous batch to keep the drawing order. Filled primitives
+    // are only merged if they don't overlap, otherwise the fill rule or the outline of
+    // one primitive drawn over the fill of the next one would change the result.
+    if (!mBatches.isEmpty()) {
+        LayerBatch& batch = mBatches.last();
+        if ((batch.layer == layer) && (batch.penWidth == penWidth) &&
+            (batch.fillLayer == fillLayer) && (batch.path.fillRule() == path.fillRule()))
+        {
+            qreal w = penWidth / 2;
+            if ((!fillLayer) || (!batch.path.boundingRect().adjusted(-w, -w, w, w)
+                                 .intersects(path.boundingRect().adjusted(-w, -w, w, w))))
+            {
+                batch.path.addPath(path);
+                return;
+            }
+        }
+    }
+    mBatches.append(LayerBatch{layer, penWidth, fillLayer, path});
 }
 
 /*****************************************************************************************
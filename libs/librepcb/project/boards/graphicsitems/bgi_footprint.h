@@ -26,6 +26,7 @@
 #include <QtCore>
 #include <QtWidgets>
 #include "bgi_base.h"
+#include <librepcb/common/graphics/graphicslayer.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -80,8 +81,22 @@ class BGI_Footprint final : public BGI_Base
         BGI_Footprint(const BGI_Footprint& other) = delete;
         BGI_Footprint& operator=(const BGI_Footprint& rhs) = delete;
 
+        /**
+         * @brief Consecutive primitives with the same pen, brush and fill rule, merged
+         *        into a single path to draw all of them with one call
+         */
+        struct LayerBatch {
+            GraphicsLayer* layer;       ///< Layer of the primitives (outline color)
+            qreal penWidth;             ///< Width of the outline, or 0 for no outline
+            GraphicsLayer* fillLayer;   ///< Layer of the fill color, or nullptr
+            QPainterPath path;
+        };
+
         // Private Methods
-        GraphicsLayer* getLayer(QString name) const noexcept;
+        GraphicsLayer* getLayer(const QString& name) const noexcept;
+        GraphicsLayer* getLayer(GraphicsLayer::Id id) const noexcept;
+        void addToBatch(GraphicsLayer* layer, qreal penWidth, GraphicsLayer* fillLayer,
+                        const QPainterPath& path) noexcept;
 
 
         // General Attributes
@@ -91,6 +106,7 @@ class BGI_Footprint final : public BGI_Base
         // Cached Attributes
         QRectF mBoundingRect;
         QPainterPath mShape;
+        QVector<LayerBatch> mBatches;
 };
 
 /*****************************************************************************************
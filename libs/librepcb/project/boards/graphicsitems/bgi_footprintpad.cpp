@@ -42,6 +42,39 @@
 namespace librepcb {
 namespace project {
 
+/*****************************************************************************************
+ *  Geometry Cache
+ ****************************************************************************************/
+
+/**
+ * @brief Everything the local geometry of a pad depends on
+ */
+struct BGI_FootprintPad_GeometryKey {
+    int shape;
+    int boardSide;
+    Length width;
+    Length height;
+    Length drillDiameter;
+    Length stopMaskClearance;
+    Length creamMaskClearance;
+
+    bool operator==(const BGI_FootprintPad_GeometryKey& rhs) const noexcept {
+        return (shape == rhs.shape) && (boardSide == rhs.boardSide)
+            && (width == rhs.width) && (height == rhs.height)
+            && (drillDiameter == rhs.drillDiameter)
+            && (stopMaskClearance == rhs.stopMaskClearance)
+            && (creamMaskClearance == rhs.creamMaskClearance);
+    }
+};
+
+static uint qHash(const BGI_FootprintPad_GeometryKey& key, uint seed = 0) noexcept
+{
+    seed = ::qHash(key.shape, seed) ^ ::qHash(key.boardSide, seed);
+    seed = qHash(key.width, seed) ^ (qHash(key.height, seed) << 1);
+    seed = qHash(key.drillDiameter, seed) ^ (qHash(key.stopMaskClearance, seed) << 1);
+    return qHash(key.creamMaskClearance, seed);
+}
+
 /*****************************************************************************************
  *  Constructors / Destructor
  ****************************************************************************************/
@@ -49,7 +82,8 @@ namespace project {
 BGI_FootprintPad::BGI_FootprintPad(BI_FootprintPad& pad) noexcept :
     BGI_Base(), mPad(pad), mLibPad(pad.getLibPad()), mPadLayer(nullptr),
     mTopStopMaskLayer(nullptr), mBottomStopMaskLayer(nullptr),
-    mTopCreamMaskLayer(nullptr), mBottomCreamMaskLayer(nullptr)
+    mTopCreamMaskLayer(nullptr), mBottomCreamMaskLayer(nullptr),
+    mGeometry(new Geometry())
 {
     setToolTip(mPad.getDisplayText());
 
@@ -92,19 +126,19 @@ void BGI_FootprintPad::updateCacheAndRepaint() noexcept
     // set layers
     mPadLayer = getLayer(mLibPad.getLayerName());
     if (mLibPad.getBoardSide() == library::FootprintPad::BoardSide::THT) {
-        mTopStopMaskLayer = getLayer(GraphicsLayer::sTopStopMask);
-        mBottomStopMaskLayer = getLayer(GraphicsLayer::sBotStopMask);
+        mTopStopMaskLayer = getLayer(GraphicsLayer::Id::TopStopMask);
+        mBottomStopMaskLayer = getLayer(GraphicsLayer::Id::BotStopMask);
         mTopCreamMaskLayer = nullptr;
         mBottomCreamMaskLayer = nullptr;
     } else if (mLibPad.getBoardSide() == library::FootprintPad::BoardSide::BOTTOM) {
         mTopStopMaskLayer = nullptr;
-        mBottomStopMaskLayer = getLayer(GraphicsLayer::sBotStopMask);
+        mBottomStopMaskLayer = getLayer(GraphicsLayer::Id::BotStopMask);
         mTopCreamMaskLayer = nullptr;
-        mBottomCreamMaskLayer = getLayer(GraphicsLayer::sBotSolderPaste);
+        mBottomCreamMaskLayer = getLayer(GraphicsLayer::Id::BotSolderPaste);
     } else {
-        mTopStopMaskLayer = getLayer(GraphicsLayer::sTopStopMask);
+        mTopStopMaskLayer = getLayer(GraphicsLayer::Id::TopStopMask);
         mBottomStopMaskLayer = nullptr;
-        mTopCreamMaskLayer = getLayer(GraphicsLayer::sTopSolderPaste);
+        mTopCreamMaskLayer = getLayer(GraphicsLayer::Id::TopSolderPaste);
         mBottomCreamMaskLayer = nullptr;
     }
 
@@ -113,12 +147,8 @@ void BGI_FootprintPad::updateCacheAndRepaint() noexcept
     Length stopMaskClearance = mPad.getBoard().getDesignRules().calcStopMaskClearance(size);
     Length creamMaskClearance = -mPad.getBoard().getDesignRules().calcCreamMaskClearance(size);
 
-    // set shapes and bounding rect
-    mShape = mLibPad.getOutline().toQPainterPathPx();
-    mCopper = mLibPad.toQPainterPathPx();
-    mStopMask = mLibPad.getOutline(stopMaskClearance).toQPainterPathPx();
-    mCreamMask = mLibPad.getOutline(creamMaskClearance).toQPainterPathPx();
-    mBoundingRect = mStopMask.boundingRect();
+    // get shapes and bounding rect (shared with all identical pads)
+    mGeometry = getSharedGeometry(mLibPad, stopMaskClearance, creamMaskClearance);
 
     update();
 }
@@ -129,61 +159,71 @@ void BGI_FootprintPad::updateCacheAndRepaint() noexcept
 
 void BGI_FootprintPad::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
-    Q_UNUSED(option);
     Q_UNUSED(widget);
-    //const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
-    //const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
 
     const NetSignal* netsignal = mPad.getCompSigInstNetSignal();
     bool highlight = mPad.isSelected() || (netsignal && netsignal->isHighlighted());
 
+    // when zoomed out, draw tiny pads as rects and omit the pad text
+    const QRectF padRect = mGeometry->shape.boundingRect();
+    const DetailLevel detail = getDetailLevel(*painter, *option, padRect);
+    auto drawShape = [painter, detail](const QPainterPath& path) {
+        if (detail == DetailLevel::Minimal) {
+            painter->drawRect(path.boundingRect());
+        } else {
+            painter->drawPath(path);
+        }
+    };
+
     if (mBottomCreamMaskLayer && mBottomCreamMaskLayer->isVisible()) {
         // draw bottom cream mask
         painter->setPen(Qt::NoPen);
         painter->setBrush(mBottomCreamMaskLayer->getColor(highlight));
-        painter->drawPath(mCreamMask);
+        drawShape(mGeometry->creamMask);
     }
 
     if (mBottomStopMaskLayer && mBottomStopMaskLayer->isVisible()) {
         // draw bottom stop mask
         painter->setPen(Qt::NoPen);
         painter->setBrush(mBottomStopMaskLayer->getColor(highlight));
-        painter->drawPath(mStopMask);
+        drawShape(mGeometry->stopMask);
     }
 
     if (mPadLayer && mPadLayer->isVisible()) {
         // draw pad
         painter->setPen(Qt::NoPen);
         painter->setBrush(mPadLayer->getColor(highlight));
-        painter->drawPath(mCopper);
+        drawShape(mGeometry->copper);
         // draw pad text
-        painter->setFont(mFont);
-        painter->setPen(mPadLayer->getColor(highlight).lighter(150));
-        painter->drawText(mShape.boundingRect(), Qt::AlignCenter, mPad.getDisplayText());
+        if (detail == DetailLevel::Full) {
+            painter->setFont(mFont);
+            painter->setPen(mPadLayer->getColor(highlight).lighter(150));
+            painter->drawText(padRect, Qt::AlignCenter, mPad.getDisplayText());
+        }
     }
 
     if (mTopStopMaskLayer && mTopStopMaskLayer->isVisible()) {
         // draw top stop mask
         painter->setPen(Qt::NoPen);
         painter->setBrush(mTopStopMaskLayer->getColor(highlight));
-        painter->drawPath(mStopMask);
+        drawShape(mGeometry->stopMask);
     }
 
     if (mTopCreamMaskLayer && mTopCreamMaskLayer->isVisible()) {
         // draw top cream mask
         painter->setPen(Qt::NoPen);
         painter->setBrush(mTopCreamMaskLayer->getColor(highlight));
-        painter->drawPath(mCreamMask);
+        drawShape(mGeometry->creamMask);
     }
 
 #ifdef QT_DEBUG
-    GraphicsLayer* layer = getLayer(GraphicsLayer::sDebugGraphicsItemsBoundingRects);
+    GraphicsLayer* layer = getLayer(GraphicsLayer::Id::DebugGraphicsItemsBoundingRects);
     if (layer) {
         if (layer->isVisible()) {
             // draw bounding rect
             painter->setPen(QPen(layer->getColor(highlight), 0));
             painter->setBrush(Qt::NoBrush);
-            painter->drawRect(mBoundingRect);
+            painter->drawRect(mGeometry->boundingRect);
         }
     }
 #endif
@@ -193,10 +233,55 @@ void BGI_FootprintPad::paint(QPainter* painter, const QStyleOptionGraphicsItem*
  *  Private Methods
  ****************************************************************************************/
 
-GraphicsLayer* BGI_FootprintPad::getLayer(QString name) const noexcept
+GraphicsLayer* BGI_FootprintPad::getLayer(const QString& name) const noexcept
+{
+    return getLayer(GraphicsLayer::getLayerId(name));
+}
+
+GraphicsLayer* BGI_FootprintPad::getLayer(GraphicsLayer::Id id) const noexcept
 {
-    if (mPad.getIsMirrored()) name = GraphicsLayer::getMirroredLayerName(name);
-    return mPad.getFootprint().getDeviceInstance().getBoard().getLayerStack().getLayer(name);
+    if (mPad.getIsMirrored()) id = GraphicsLayer::getMirroredLayerId(id);
+    return mPad.getFootprint().getDeviceInstance().getBoard().getLayerStack().getLayer(id);
+}
+
+QSharedPointer<const BGI_FootprintPad::Geometry> BGI_FootprintPad::getSharedGeometry(
+    const library::FootprintPad& pad, const Length& stopMaskClearance,
+    const Length& creamMaskClearance) noexcept
+{
+    // The cache only holds weak references, so the geometry is released as soon as the
+    // last pad using it is destroyed or changes its geometry. Expired entries are removed
+    // whenever the cache has grown to twice its size since the last cleanup.
+    static QMutex mutex;
+    static QHash<BGI_FootprintPad_GeometryKey, QWeakPointer<const Geometry>> cache;
+    static int cleanupThreshold = 64;
+
+    BGI_FootprintPad_GeometryKey key{static_cast<int>(pad.getShape()),
+        static_cast<int>(pad.getBoardSide()), pad.getWidth(), pad.getHeight(),
+        pad.getDrillDiameter(), stopMaskClearance, creamMaskClearance};
+
+    QMutexLocker locker(&mutex);
+    QSharedPointer<const Geometry> geometry = cache.value(key).toStrongRef();
+    if (!geometry) {
+        Geometry* newGeometry = new Geometry();
+        newGeometry->shape = pad.getOutline().toQPainterPathPx();
+        newGeometry->copper = pad.toQPainterPathPx();
+        newGeometry->stopMask = pad.getOutline(stopMaskClearance).toQPainterPathPx();
+        newGeometry->creamMask = pad.getOutline(creamMaskClearance).toQPainterPathPx();
+        newGeometry->boundingRect = newGeometry->stopMask.boundingRect();
+        geometry.reset(newGeometry);
+        cache.insert(key, geometry);
+        if (cache.count() >= cleanupThreshold) {
+            for (auto it = cache.begin(); it != cache.end();) {
+                if (it.value().isNull()) {
+                    it = cache.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            cleanupThreshold = qMax(64, cache.count() * 2);
+        }
+    }
+    return geometry;
 }
 
 /*****************************************************************************************
@@ -26,6 +26,7 @@
 #include <QtCore>
 #include <QtWidgets>
 #include "bgi_base.h"
+#include <librepcb/common/graphics/graphicslayer.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -68,8 +69,8 @@ class BGI_FootprintPad final : public BGI_Base
         void updateCacheAndRepaint() noexcept;
 
         // Inherited from QGraphicsItem
-        QRectF boundingRect() const noexcept {return mBoundingRect;}
-        QPainterPath shape() const noexcept {return mShape;}
+        QRectF boundingRect() const noexcept {return mGeometry->boundingRect;}
+        QPainterPath shape() const noexcept {return mGeometry->shape;}
         void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = 0);
 
 
@@ -80,8 +81,28 @@ class BGI_FootprintPad final : public BGI_Base
         BGI_FootprintPad(const BGI_FootprintPad& other) = delete;
         BGI_FootprintPad& operator=(const BGI_FootprintPad& rhs) = delete;
 
+        /**
+         * @brief The local (untransformed) geometry of a pad
+         *
+         * Boards often contain many identical pads (e.g. hundreds of 0402 resistors), so
+         * the geometry is shared between all pads with the same shape, size and mask
+         * clearances (see #getSharedGeometry()). Each graphics item only holds its own
+         * transformation.
+         */
+        struct Geometry {
+            QPainterPath shape;
+            QPainterPath copper;
+            QPainterPath stopMask;
+            QPainterPath creamMask;
+            QRectF boundingRect;
+        };
+
         // Private Methods
-        GraphicsLayer* getLayer(QString name) const noexcept;
+        GraphicsLayer* getLayer(const QString& name) const noexcept;
+        GraphicsLayer* getLayer(GraphicsLayer::Id id) const noexcept;
+        static QSharedPointer<const Geometry> getSharedGeometry(const library::FootprintPad& pad,
+                                                               const Length& stopMaskClearance,
+                                                               const Length& creamMaskClearance) noexcept;
 
 
         // General Attributes
@@ -94,11 +115,7 @@ class BGI_FootprintPad final : public BGI_Base
         GraphicsLayer* mBottomStopMaskLayer;
         GraphicsLayer* mTopCreamMaskLayer;
         GraphicsLayer* mBottomCreamMaskLayer;
-        QPainterPath mShape;
-        QPainterPath mCopper;
-        QPainterPath mStopMask;
-        QPainterPath mCreamMask;
-        QRectF mBoundingRect;
+        QSharedPointer<const Geometry> mGeometry;
         QFont mFont;
 };
 
@@ -98,7 +98,6 @@ void BGI_NetLine::updateCacheAndRepaint() noexcept
 
 void BGI_NetLine::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
-    Q_UNUSED(option);
     Q_UNUSED(widget);
 
     bool highlight = mNetLine.isSelected() || mNetLine.getNetSignalOfNetSegment().isHighlighted();
@@ -106,7 +105,8 @@ void BGI_NetLine::paint(QPainter* painter, const QStyleOptionGraphicsItem* optio
     // draw line
     if (mLayer->isVisible())
     {
-        QPen pen(mLayer->getColor(highlight), mNetLine.getWidth().toPx(), Qt::SolidLine, Qt::RoundCap);
+        qreal width = getPenWidth(*painter, *option, mNetLine.getWidth().toPx());
+        QPen pen(mLayer->getColor(highlight), width, Qt::SolidLine, Qt::RoundCap);
         painter->setPen(pen);
         painter->drawLine(mLineF);
     }
@@ -77,12 +77,12 @@ void BGI_Plane::updateCacheAndRepaint() noexcept
     mShape = mShape = Toolbox::shapeFromPath(mOutline, QPen(Length::fromMm(0.3).toPx()), QBrush());
     mBoundingRect = mShape.boundingRect();
 
-    // get areas
-    mAreas.clear();
+    // get areas (the fragments never overlap, so they can be merged into one path)
+    mAreas = QPainterPath();
     for (const Path& r : mPlane.getFragments()) {
-        mAreas.append(r.toQPainterPathPx());
-        mBoundingRect = mBoundingRect.united(mAreas.last().boundingRect());
+        mAreas.addPath(r.toQPainterPathPx());
     }
+    mBoundingRect = mBoundingRect.united(mAreas.boundingRect());
 
     update();
 }
@@ -109,15 +109,13 @@ void BGI_Plane::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
         // draw plane
         painter->setPen(Qt::NoPen);
         painter->setBrush(mLayer->getColor(selected));
-        foreach (const QPainterPath& area, mAreas) {
-            painter->drawPath(area);
-        }
+        painter->drawPath(mAreas);
     }
 
 #ifdef QT_DEBUG
     // draw bounding rect
     const GraphicsLayer* layer = mPlane.getBoard().getLayerStack().getLayer(
-        GraphicsLayer::sDebugGraphicsItemsBoundingRects);
+        GraphicsLayer::Id::DebugGraphicsItemsBoundingRects);
     if (layer) {
         if (layer->isVisible()) {
             painter->setPen(QPen(layer->getColor(selected), 0));
@@ -132,10 +130,15 @@ void BGI_Plane::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
  *  Private Methods
  ****************************************************************************************/
 
-GraphicsLayer* BGI_Plane::getLayer(QString name) const noexcept
+GraphicsLayer* BGI_Plane::getLayer(const QString& name) const noexcept
+{
+    return getLayer(GraphicsLayer::getLayerId(name));
+}
+
+GraphicsLayer* BGI_Plane::getLayer(GraphicsLayer::Id id) const noexcept
 {
-    if (mPlane.getIsMirrored()) name = GraphicsLayer::getMirroredLayerName(name);
-    return mPlane.getBoard().getLayerStack().getLayer(name);
+    if (mPlane.getIsMirrored()) id = GraphicsLayer::getMirroredLayerId(id);
+    return mPlane.getBoard().getLayerStack().getLayer(id);
 }
 
 /*****************************************************************************************
@@ -26,6 +26,7 @@
 #include <QtCore>
 #include <QtWidgets>
 #include "bgi_base.h"
+#include <librepcb/common/graphics/graphicslayer.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -78,7 +79,8 @@ class BGI_Plane final : public BGI_Base
         BGI_Plane& operator=(const BGI_Plane& rhs) = delete;
 
         // Private Methods
-        GraphicsLayer* getLayer(QString name) const noexcept;
+        GraphicsLayer* getLayer(const QString& name) const noexcept;
+        GraphicsLayer* getLayer(GraphicsLayer::Id id) const noexcept;
 
         // General Attributes
         BI_Plane& mPlane;
@@ -88,7 +90,7 @@ class BGI_Plane final : public BGI_Base
         QRectF mBoundingRect;
         QPainterPath mShape;
         QPainterPath mOutline;
-        QVector<QPainterPath> mAreas;
+        QPainterPath mAreas;    ///< All fragments merged to draw them with one call
 };
 
 /*****************************************************************************************
@@ -101,36 +101,48 @@ void BGI_Via::updateCacheAndRepaint() noexcept
 
 void BGI_Via::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
-    Q_UNUSED(option);
     Q_UNUSED(widget);
 
     NetSignal& netsignal = mVia.getNetSignalOfNetSegment();
     bool highlight = mVia.isSelected() || (netsignal.isHighlighted());
 
+    // when zoomed out, draw tiny vias as rects and omit the netsignal name
+    const QRectF viaRect = mShape.boundingRect();
+    const DetailLevel detail = getDetailLevel(*painter, *option, viaRect);
+    auto drawShape = [painter, detail](const QPainterPath& path) {
+        if (detail == DetailLevel::Minimal) {
+            painter->drawRect(path.boundingRect());
+        } else {
+            painter->drawPath(path);
+        }
+    };
+
     if (mDrawStopMask && mBottomStopMaskLayer && mBottomStopMaskLayer->isVisible()) {
         // draw bottom stop mask
         painter->setPen(Qt::NoPen);
         painter->setBrush(mBottomStopMaskLayer->getColor(highlight));
-        painter->drawPath(mStopMask);
+        drawShape(mStopMask);
     }
 
     if (mViaLayer && mViaLayer->isVisible()) {
         // draw via
         painter->setPen(Qt::NoPen);
         painter->setBrush(mViaLayer->getColor(highlight));
-        painter->drawPath(mCopper);
+        drawShape(mCopper);
 
         // draw netsignal name
-        painter->setFont(mFont);
-        painter->setPen(mViaLayer->getColor(highlight).lighter(150));
-        painter->drawText(mShape.boundingRect(), Qt::AlignCenter, netsignal.getName());
+        if (detail == DetailLevel::Full) {
+            painter->setFont(mFont);
+            painter->setPen(mViaLayer->getColor(highlight).lighter(150));
+            painter->drawText(viaRect, Qt::AlignCenter, netsignal.getName());
+        }
     }
 
     if (mDrawStopMask && mTopStopMaskLayer && mTopStopMaskLayer->isVisible()) {
         // draw top stop mask
         painter->setPen(Qt::NoPen);
         painter->setBrush(mTopStopMaskLayer->getColor(highlight));
-        painter->drawPath(mStopMask);
+        drawShape(mStopMask);
     }
 
 #ifdef QT_DEBUG
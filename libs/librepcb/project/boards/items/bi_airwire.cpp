@@ -0,0 +1,101 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "bi_airwire.h"
+#include "../board.h"
+#include "../graphicsitems/bgi_airwire.h"
+#include "../../circuit/netsignal.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BI_AirWire::BI_AirWire(Board& board, const NetSignal& netsignal, const Point& p1,
+                       const Point& p2) noexcept :
+    BI_Base(board), mNetSignal(netsignal), mP1(p1), mP2(p2)
+{
+}
+
+BI_AirWire::~BI_AirWire() noexcept
+{
+    mGraphicsItem.reset();
+}
+
+/*****************************************************************************************
+ *  Setters
+ ****************************************************************************************/
+
+void BI_AirWire::setPoints(const Point& p1, const Point& p2) noexcept
+{
+    if ((p1 != mP1) || (p2 != mP2)) {
+        mP1 = p1;
+        mP2 = p2;
+        if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+    }
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void BI_AirWire::addToBoard()
+{
+    if (isAddedToBoard()) {
+        throw LogicError(__FILE__, __LINE__);
+    }
+    createGraphicsItems();
+    mHighlightChangedConnection = connect(&mNetSignal, &NetSignal::highlightedChanged,
+                                          [this](){if (mGraphicsItem) mGraphicsItem->update();});
+    BI_Base::addToBoard(mGraphicsItem.data());
+}
+
+void BI_AirWire::removeFromBoard()
+{
+    if (!isAddedToBoard()) {
+        throw LogicError(__FILE__, __LINE__);
+    }
+    disconnect(mHighlightChangedConnection);
+    BI_Base::removeFromBoard(mGraphicsItem.data());
+}
+
+void BI_AirWire::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem || (!mBoard.hasGraphicsScene())) {
+        return;
+    }
+    mGraphicsItem.reset(new BGI_AirWire(*this));
+    addCreatedGraphicsItem(*mGraphicsItem);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
@@ -92,6 +92,14 @@ void BI_Base::removeFromBoard(QGraphicsItem* item) noexcept
     mIsAddedToBoard = false;
 }
 
+void BI_Base::addCreatedGraphicsItem(QGraphicsItem& item) noexcept
+{
+    // items which are not added to the board will add it in addToBoard() later
+    if (mIsAddedToBoard) {
+        mBoard.getGraphicsScene().addItem(item);
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
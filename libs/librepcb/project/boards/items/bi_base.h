@@ -67,6 +67,7 @@ class BI_Base : public QObject
             StrokeText,     ///< librepcb#project#BI_StrokeText
             Hole,           ///< librepcb#project#BI_Hole
             Plane,          ///< librepcb#project#BI_Plane
+            AirWire,        ///< librepcb#project#BI_AirWire
         };
 
         // Constructors / Destructor
@@ -94,6 +95,17 @@ class BI_Base : public QObject
         virtual void addToBoard() = 0;
         virtual void removeFromBoard() = 0;
 
+        /**
+         * @brief Create the graphics items of this item and all its child items
+         *
+         * Graphics items are not created by the constructors, but only when the board
+         * gets a graphics scene, i.e. as soon as it is shown in a view or rendered (see
+         * librepcb::project::Board::showInView()). Thus projects opened only to read or
+         * export data never construct any graphics items. Does nothing if the graphics
+         * items already exist or if the board has no graphics scene yet.
+         */
+        virtual void createGraphicsItems() noexcept = 0;
+
         // Operator Overloadings
         BI_Base& operator=(const BI_Base& rhs) = delete;
 
@@ -103,6 +115,7 @@ class BI_Base : public QObject
         // General Methods
         void addToBoard(QGraphicsItem* item) noexcept;
         void removeFromBoard(QGraphicsItem* item) noexcept;
+        void addCreatedGraphicsItem(QGraphicsItem& item) noexcept;
 
 
     protected:
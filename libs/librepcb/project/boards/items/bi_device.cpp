@@ -31,6 +31,8 @@
 #include "../../circuit/circuit.h"
 #include "../../circuit/componentinstance.h"
 #include "bi_footprint.h"
+#include "bi_footprintpad.h"
+#include "bi_stroketext.h"
 #include <librepcb/common/scopeguard.h>
 
 /*****************************************************************************************
@@ -169,6 +171,14 @@ bool BI_Device::isUsed() const noexcept
     return mFootprint->isUsed();
 }
 
+qint64 BI_Device::getApproxMemoryUsage() const noexcept
+{
+    return sizeof(*this) + sizeof(BI_Footprint) +
+           (mFootprint->getPads().count() * sizeof(BI_FootprintPad)) +
+           (mFootprint->getStrokeTexts().count() * sizeof(BI_StrokeText)) +
+           (mAttributes.count() * sizeof(Attribute));
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -226,6 +236,11 @@ void BI_Device::removeFromBoard()
     updateErcMessages();
 }
 
+void BI_Device::createGraphicsItems() noexcept
+{
+    mFootprint->createGraphicsItems();
+}
+
 void BI_Device::serialize(SExpression& root) const
 {
     if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
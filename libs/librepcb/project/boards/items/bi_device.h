@@ -86,6 +86,14 @@ class BI_Device final : public BI_Base, public AttributeProvider,
         bool isSelectable() const noexcept override;
         bool isUsed() const noexcept;
 
+        /**
+         * @brief Get the approximate amount of heap memory used by this device (including its footprint)
+         *
+         * Used by undo commands which keep removed items alive (see
+         * librepcb::UndoCommand::getApproxMemoryUsage()).
+         */
+        qint64 getApproxMemoryUsage() const noexcept;
+
         // Setters
         void setPosition(const Point& pos) noexcept;
         void setRotation(const Angle& rot) noexcept;
@@ -94,6 +102,7 @@ class BI_Device final : public BI_Base, public AttributeProvider,
         // General Methods
         void addToBoard() override;
         void removeFromBoard() override;
+        void createGraphicsItems() noexcept override;
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
@@ -133,7 +142,7 @@ class BI_Device final : public BI_Base, public AttributeProvider,
                                               const Uuid& footprintUuid);
         void init();
         bool checkAttributesValidity() const noexcept;
-        void updateErcMessages() noexcept;
+        void updateErcMessages() noexcept override;
         const QStringList& getLocaleOrder() const noexcept;
 
 
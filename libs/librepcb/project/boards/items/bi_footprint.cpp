@@ -73,11 +73,6 @@ BI_Footprint::BI_Footprint(BI_Device& device) :
 
 void BI_Footprint::init()
 {
-    // create graphics item
-    mGraphicsItem.reset(new BGI_Footprint(*this));
-    mGraphicsItem->setPos(mDevice.getPosition().toPxQPointF());
-    updateGraphicsItemTransform();
-
     // load pads
     const library::Device& libDev = mDevice.getLibDevice();
     for (const library::FootprintPad& libPad : getLibFootprint().getPads()) {
@@ -197,6 +192,7 @@ void BI_Footprint::addToBoard()
         text->addToBoard(); // can throw
         sgl.add([text](){text->removeFromBoard();});
     }
+    createGraphicsItems();
     BI_Base::addToBoard(mGraphicsItem.data());
     sgl.dismiss();
 }
@@ -219,6 +215,23 @@ void BI_Footprint::removeFromBoard()
     sgl.dismiss();
 }
 
+void BI_Footprint::createGraphicsItems() noexcept
+{
+    foreach (BI_FootprintPad* pad, mPads) {
+        pad->createGraphicsItems();
+    }
+    foreach (BI_StrokeText* text, mStrokeTexts) {
+        text->createGraphicsItems();
+    }
+    if (mGraphicsItem || (!mBoard.hasGraphicsScene())) {
+        return;
+    }
+    mGraphicsItem.reset(new BGI_Footprint(*this));
+    mGraphicsItem->setPos(mDevice.getPosition().toPxQPointF());
+    updateGraphicsItemTransform();
+    addCreatedGraphicsItem(*mGraphicsItem);
+}
+
 void BI_Footprint::serialize(SExpression& root) const
 {
     foreach (const BI_StrokeText* text, mStrokeTexts) {
@@ -267,18 +280,19 @@ bool BI_Footprint::getIsMirrored() const noexcept
 
 QPainterPath BI_Footprint::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
 bool BI_Footprint::isSelectable() const noexcept
 {
-    return mGraphicsItem->isSelectable();
+    return mGraphicsItem && mGraphicsItem->isSelectable();
 }
 
 void BI_Footprint::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
     foreach (BI_FootprintPad* pad, mPads)
         pad->setSelected(selected);
     foreach (BI_StrokeText* text, mStrokeTexts)
@@ -291,14 +305,16 @@ void BI_Footprint::setSelected(bool selected) noexcept
 
 void BI_Footprint::deviceInstanceAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     emit attributesChanged();
 }
 
 void BI_Footprint::deviceInstanceMoved(const Point& pos)
 {
-    mGraphicsItem->setPos(pos.toPxQPointF());
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        mGraphicsItem->setPos(pos.toPxQPointF());
+        mGraphicsItem->updateCacheAndRepaint();
+    }
     foreach (BI_FootprintPad* pad, mPads) {
         pad->updatePosition();
     }
@@ -311,7 +327,7 @@ void BI_Footprint::deviceInstanceRotated(const Angle& rot)
 {
     Q_UNUSED(rot);
     updateGraphicsItemTransform();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     foreach (BI_FootprintPad* pad, mPads) {
         pad->updatePosition();
     }
@@ -321,7 +337,7 @@ void BI_Footprint::deviceInstanceMirrored(bool mirrored)
 {
     Q_UNUSED(mirrored);
     updateGraphicsItemTransform();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     foreach (BI_FootprintPad* pad, mPads) {
         pad->updatePosition();
     }
@@ -336,7 +352,7 @@ void BI_Footprint::updateGraphicsItemTransform() noexcept
     QTransform t;
     if (mDevice.getIsMirrored()) t.scale(qreal(-1), qreal(1));
     t.rotate(-mDevice.getRotation().toDeg());
-    mGraphicsItem->setTransform(t);
+    if (mGraphicsItem) mGraphicsItem->setTransform(t);
 }
 
 /*****************************************************************************************
@@ -90,6 +90,7 @@ class BI_Footprint final : public BI_Base, public SerializableObject,
         void resetStrokeTextsToLibraryFootprint();
         void addToBoard() override;
         void removeFromBoard() override;
+        void createGraphicsItems() noexcept override;
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
@@ -61,8 +61,12 @@ BI_FootprintPad::BI_FootprintPad(BI_Footprint& footprint, const Uuid& padUuid) :
     mComponentSignalInstance = mFootprint.getDeviceInstance().getComponentInstance().getSignalInstance(cmpSignalUuid);
     connect(mComponentSignalInstance, &ComponentSignalInstance::netSignalChanged,
             this, &BI_FootprintPad::componentSignalInstanceNetSignalChanged);
+    connect(mComponentSignalInstance, &ComponentSignalInstance::netSignalChanged,
+            this, [this](){
+        // the previous net signal is not known anymore, so rebuild all airwires
+        if (isAddedToBoard()) mBoard.scheduleAirWiresRebuild(nullptr);
+    });
 
-    mGraphicsItem.reset(new BGI_FootprintPad(*this));
     updatePosition();
 
     // connect to the "attributes changed" signal of the footprint
@@ -103,6 +107,23 @@ QString BI_FootprintPad::getLayerName() const noexcept
         return mFootprintPad->getLayerName();
 }
 
+GraphicsLayer::Id BI_FootprintPad::getLayerId() const noexcept
+{
+    if (getIsMirrored())
+        return GraphicsLayer::getMirroredLayerId(mFootprintPad->getLayerId());
+    else
+        return mFootprintPad->getLayerId();
+}
+
+bool BI_FootprintPad::isOnLayer(GraphicsLayer::Id layerId) const noexcept
+{
+    if (getIsMirrored()) {
+        return mFootprintPad->isOnLayer(GraphicsLayer::getMirroredLayerId(layerId));
+    } else {
+        return mFootprintPad->isOnLayer(layerId);
+    }
+}
+
 bool BI_FootprintPad::isOnLayer(const QString& layerName) const noexcept
 {
     if (getIsMirrored()) {
@@ -134,7 +155,9 @@ void BI_FootprintPad::addToBoard()
         mComponentSignalInstance->registerFootprintPad(*this); // can throw
     }
     componentSignalInstanceNetSignalChanged(getCompSigInstNetSignal());
+    createGraphicsItems();
     BI_Base::addToBoard(mGraphicsItem.data());
+    scheduleAirWiresRebuild();
 }
 
 void BI_FootprintPad::removeFromBoard()
@@ -146,9 +169,21 @@ void BI_FootprintPad::removeFromBoard()
         mComponentSignalInstance->unregisterFootprintPad(*this); // can throw
     }
     componentSignalInstanceNetSignalChanged(nullptr);
+    scheduleAirWiresRebuild();
     BI_Base::removeFromBoard(mGraphicsItem.data());
 }
 
+void BI_FootprintPad::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem || (!mBoard.hasGraphicsScene())) {
+        return;
+    }
+    mGraphicsItem.reset(new BGI_FootprintPad(*this));
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    updateGraphicsItemTransform();
+    addCreatedGraphicsItem(*mGraphicsItem);
+}
+
 void BI_FootprintPad::registerNetPoint(BI_NetPoint& netpoint)
 {
     if ((!isAddedToBoard()) || (!mComponentSignalInstance)
@@ -156,7 +191,7 @@ void BI_FootprintPad::registerNetPoint(BI_NetPoint& netpoint)
         || (mRegisteredNetPoints.contains(netpoint.getLayer().getName()))
         || (&netpoint.getNetSignalOfNetSegment() != mComponentSignalInstance->getNetSignal())
         || (!netpoint.getLayer().isCopperLayer())
-        || (!isOnLayer(netpoint.getLayer().getName())))
+        || (!isOnLayer(netpoint.getLayer().getId())))
     {
         throw LogicError(__FILE__, __LINE__);
     }
@@ -180,12 +215,17 @@ void BI_FootprintPad::updatePosition() noexcept
 {
     mPosition = mFootprint.mapToScene(mFootprintPad->getPosition());
     mRotation = mFootprint.getRotation() + mFootprintPad->getRotation();
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
-    updateGraphicsItemTransform();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        updateGraphicsItemTransform();
+        mGraphicsItem->updateCacheAndRepaint();
+    }
     foreach (BI_NetPoint* netpoint, mRegisteredNetPoints) {
         netpoint->setPosition(mPosition);
     }
+    if (isAddedToBoard()) {
+        scheduleAirWiresRebuild();
+    }
 }
 
 /*****************************************************************************************
@@ -199,18 +239,19 @@ bool BI_FootprintPad::getIsMirrored() const noexcept
 
 QPainterPath BI_FootprintPad::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
 bool BI_FootprintPad::isSelectable() const noexcept
 {
-    return mFootprint.isSelectable() && mGraphicsItem->isSelectable();
+    return mFootprint.isSelectable() && mGraphicsItem && mGraphicsItem->isSelectable();
 }
 
 void BI_FootprintPad::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 Path BI_FootprintPad::getOutline(const Length& expansion) const noexcept
@@ -229,7 +270,7 @@ Path BI_FootprintPad::getSceneOutline(const Length& expansion) const noexcept
 
 void BI_FootprintPad::footprintAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void BI_FootprintPad::componentSignalInstanceNetSignalChanged(NetSignal* netsignal)
@@ -239,7 +280,7 @@ void BI_FootprintPad::componentSignalInstanceNetSignalChanged(NetSignal* netsign
     }
     if (netsignal) {
         mHighlightChangedConnection = connect(netsignal, &NetSignal::highlightedChanged,
-                                              [this](){mGraphicsItem->update();});
+                                              [this](){if (mGraphicsItem) mGraphicsItem->update();});
     }
 }
 
@@ -247,6 +288,13 @@ void BI_FootprintPad::componentSignalInstanceNetSignalChanged(NetSignal* netsign
  *  Private Methods
  ****************************************************************************************/
 
+void BI_FootprintPad::scheduleAirWiresRebuild() noexcept
+{
+    if (NetSignal* netsignal = getCompSigInstNetSignal()) {
+        mBoard.scheduleAirWiresRebuild(netsignal);
+    }
+}
+
 void BI_FootprintPad::updateGraphicsItemTransform() noexcept
 {
     QTransform t;
@@ -27,6 +27,7 @@
 #include "bi_base.h"
 #include "../graphicsitems/bgi_footprintpad.h"
 #include <librepcb/common/geometry/path.h>
+#include <librepcb/common/graphics/graphicslayer.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -72,7 +73,9 @@ class BI_FootprintPad final : public BI_Base
         const QMap<QString, BI_NetPoint*>& getNetPoints() const noexcept {return mRegisteredNetPoints;}
         BI_NetPoint* getNetPointOfLayer(const QString& layerName) const noexcept {return mRegisteredNetPoints.value(layerName, nullptr);}
         QString getLayerName() const noexcept;
+        GraphicsLayer::Id getLayerId() const noexcept;
         bool isOnLayer(const QString& layerName) const noexcept;
+        bool isOnLayer(GraphicsLayer::Id layerId) const noexcept;
         const library::FootprintPad& getLibPad() const noexcept {return *mFootprintPad;}
         ComponentSignalInstance* getComponentSignalInstance() const noexcept {return mComponentSignalInstance;}
         NetSignal* getCompSigInstNetSignal() const noexcept;
@@ -84,6 +87,7 @@ class BI_FootprintPad final : public BI_Base
         // General Methods
         void addToBoard() override;
         void removeFromBoard() override;
+        void createGraphicsItems() noexcept override;
         void registerNetPoint(BI_NetPoint& netpoint);
         void unregisterNetPoint(BI_NetPoint& netpoint);
         void updatePosition() noexcept;
@@ -108,6 +112,7 @@ class BI_FootprintPad final : public BI_Base
 
     private:
 
+        void scheduleAirWiresRebuild() noexcept;
         void updateGraphicsItemTransform() noexcept;
 
 
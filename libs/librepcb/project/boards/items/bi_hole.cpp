@@ -42,27 +42,18 @@ BI_Hole::BI_Hole(Board& board, const BI_Hole& other) :
     BI_Base(board)
 {
     mHole.reset(new Hole(Uuid::createRandom(), *other.mHole));
-    init();
 }
 
 BI_Hole::BI_Hole(Board& board, const SExpression& node) :
     BI_Base(board)
 {
     mHole.reset(new Hole(node));
-    init();
-
 }
 
 BI_Hole::BI_Hole(Board& board, const Hole& hole) :
     BI_Base(board)
 {
     mHole.reset(new Hole(hole));
-    init();
-}
-
-void BI_Hole::init()
-{
-    mGraphicsItem.reset(new HoleGraphicsItem(*mHole, mBoard.getLayerStack()));
 }
 
 BI_Hole::~BI_Hole() noexcept
@@ -80,6 +71,7 @@ void BI_Hole::addToBoard()
     if (isAddedToBoard()) {
         throw LogicError(__FILE__, __LINE__);
     }
+    createGraphicsItems();
     BI_Base::addToBoard(mGraphicsItem.data());
 }
 
@@ -91,6 +83,16 @@ void BI_Hole::removeFromBoard()
     BI_Base::removeFromBoard(mGraphicsItem.data());
 }
 
+void BI_Hole::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem || (!mBoard.hasGraphicsScene())) {
+        return;
+    }
+    mGraphicsItem.reset(new HoleGraphicsItem(*mHole, mBoard.getLayerStack()));
+    mGraphicsItem->setSelected(isSelected());
+    addCreatedGraphicsItem(*mGraphicsItem);
+}
+
 void BI_Hole::serialize(SExpression& root) const
 {
     mHole->serialize(root);
@@ -107,6 +109,7 @@ const Point& BI_Hole::getPosition() const noexcept
 
 QPainterPath BI_Hole::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
@@ -124,7 +127,7 @@ bool BI_Hole::isSelectable() const noexcept
 void BI_Hole::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->setSelected(selected);
+    if (mGraphicsItem) mGraphicsItem->setSelected(selected);
 }
 
 /*****************************************************************************************
@@ -70,6 +70,7 @@ class BI_Hole final : public BI_Base, public SerializableObject
         // General Methods
         void addToBoard() override;
         void removeFromBoard() override;
+        void createGraphicsItems() noexcept override;
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
@@ -85,10 +86,6 @@ class BI_Hole final : public BI_Base, public SerializableObject
         BI_Hole& operator=(const BI_Hole& rhs) = delete;
 
 
-    private: // Methods
-        void init();
-
-
     private: // Data
         QScopedPointer<Hole> mHole;
         QScopedPointer<HoleGraphicsItem> mGraphicsItem;
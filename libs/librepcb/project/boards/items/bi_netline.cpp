@@ -107,7 +107,6 @@ void BI_NetLine::init()
             tr("BI_NetLine: both endpoints are the same."));
     }
 
-    mGraphicsItem.reset(new BGI_NetLine(*this));
     updateLine();
 
     if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
@@ -185,7 +184,7 @@ void BI_NetLine::setWidth(const Length& width) noexcept
     Q_ASSERT(width >= 0);
     if ((width != mWidth) && (width >= 0)) {
         mWidth = width;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     }
 }
 
@@ -206,10 +205,12 @@ void BI_NetLine::addToBoard()
     auto sg = scopeGuard([&](){mStartPoint->unregisterNetLine(*this);});
     mEndPoint->registerNetLine(*this); // can throw
 
+    createGraphicsItems();
     mHighlightChangedConnection = connect(&getNetSignalOfNetSegment(),
                                               &NetSignal::highlightedChanged,
-                                              [this](){mGraphicsItem->update();});
+                                              [this](){if (mGraphicsItem) mGraphicsItem->update();});
     BI_Base::addToBoard(mGraphicsItem.data());
+    mBoard.scheduleAirWiresRebuild(&getNetSignalOfNetSegment());
     sg.dismiss();
 }
 
@@ -228,13 +229,23 @@ void BI_NetLine::removeFromBoard()
 
     disconnect(mHighlightChangedConnection);
     BI_Base::removeFromBoard(mGraphicsItem.data());
+    mBoard.scheduleAirWiresRebuild(&getNetSignalOfNetSegment());
     sg.dismiss();
 }
 
+void BI_NetLine::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem || (!mBoard.hasGraphicsScene())) {
+        return;
+    }
+    mGraphicsItem.reset(new BGI_NetLine(*this));
+    addCreatedGraphicsItem(*mGraphicsItem);
+}
+
 void BI_NetLine::updateLine() noexcept
 {
     mPosition = (mStartPoint->getPosition() + mEndPoint->getPosition()) / 2;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void BI_NetLine::serialize(SExpression& root) const
@@ -253,18 +264,19 @@ void BI_NetLine::serialize(SExpression& root) const
 
 QPainterPath BI_NetLine::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->shape();
 }
 
 bool BI_NetLine::isSelectable() const noexcept
 {
-    return mGraphicsItem->isSelectable();
+    return mGraphicsItem && mGraphicsItem->isSelectable();
 }
 
 void BI_NetLine::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
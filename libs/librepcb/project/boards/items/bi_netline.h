@@ -85,6 +85,7 @@ class BI_NetLine final : public BI_Base, public SerializableObject
         // General Methods
         void addToBoard() override;
         void removeFromBoard() override;
+        void createGraphicsItems() noexcept override;
         void updateLine() noexcept;
 
         /// @copydoc librepcb::SerializableObject::serialize()
@@ -146,17 +146,13 @@ void BI_NetPoint::init()
             .arg(mUuid.toStr()).arg(mLayer->getName()));
     }
     if (mFootprintPad) {
-        if (!mFootprintPad->isOnLayer(mLayer->getName())) {
+        if (!mFootprintPad->isOnLayer(mLayer->getId())) {
             throw RuntimeError(__FILE__, __LINE__,
                 QString(tr("The layer of netpoint \"%1\" is invalid (%2)."))
                 .arg(mUuid.toStr()).arg(mLayer->getName()));
         }
     }
 
-    // create the graphics item
-    mGraphicsItem.reset(new BGI_NetPoint(*this));
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
-
     // create ERC messages
     mErcMsgDeadNetPoint.reset(new ErcMsg(mBoard.getProject(), *this,
         mUuid.toStr(), "Dead", ErcMsg::ErcMsgType_t::BoardError,
@@ -230,9 +226,10 @@ void BI_NetPoint::setPadToAttach(BI_FootprintPad* pad)
             setPosition(pad->getPosition());
         }
         sgl.dismiss();
+        mBoard.scheduleAirWiresRebuild(&getNetSignalOfNetSegment());
     }
     mFootprintPad = pad;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void BI_NetPoint::setViaToAttach(BI_Via* via)
@@ -260,17 +257,21 @@ void BI_NetPoint::setViaToAttach(BI_Via* via)
             setPosition(via->getPosition());
         }
         sgl.dismiss();
+        mBoard.scheduleAirWiresRebuild(&getNetSignalOfNetSegment());
     }
     mVia = via;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void BI_NetPoint::setPosition(const Point& position) noexcept
 {
     if (position != mPosition) {
         mPosition = position;
-        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        if (mGraphicsItem) mGraphicsItem->setPos(mPosition.toPxQPointF());
         updateLines();
+        if (isAddedToBoard()) {
+            mBoard.scheduleAirWiresRebuild(&getNetSignalOfNetSegment());
+        }
     }
 }
 
@@ -296,11 +297,13 @@ void BI_NetPoint::addToBoard()
         }
         mVia->registerNetPoint(*this); // can throw
     }
+    createGraphicsItems();
     mHighlightChangedConnection = connect(&getNetSignalOfNetSegment(),
                                           &NetSignal::highlightedChanged,
-                                          [this](){mGraphicsItem->update();});
-    mErcMsgDeadNetPoint->setVisible(true);
+                                          [this](){if (mGraphicsItem) mGraphicsItem->update();});
     BI_Base::addToBoard(mGraphicsItem.data());
+    updateErcMessages();
+    mBoard.scheduleAirWiresRebuild(&getNetSignalOfNetSegment());
 }
 
 void BI_NetPoint::removeFromBoard()
@@ -322,8 +325,19 @@ void BI_NetPoint::removeFromBoard()
         mVia->unregisterNetPoint(*this); // can throw
     }
     disconnect(mHighlightChangedConnection);
-    mErcMsgDeadNetPoint->setVisible(false);
     BI_Base::removeFromBoard(mGraphicsItem.data());
+    updateErcMessages();
+    mBoard.scheduleAirWiresRebuild(&getNetSignalOfNetSegment());
+}
+
+void BI_NetPoint::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem || (!mBoard.hasGraphicsScene())) {
+        return;
+    }
+    mGraphicsItem.reset(new BGI_NetPoint(*this));
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    addCreatedGraphicsItem(*mGraphicsItem);
 }
 
 void BI_NetPoint::registerNetLine(BI_NetLine& netline)
@@ -335,8 +349,8 @@ void BI_NetPoint::registerNetLine(BI_NetLine& netline)
     }
     mRegisteredLines.append(&netline);
     netline.updateLine();
-    mGraphicsItem->updateCacheAndRepaint();
-    mErcMsgDeadNetPoint->setVisible(mRegisteredLines.isEmpty());
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+    updateErcMessages();
 }
 
 void BI_NetPoint::unregisterNetLine(BI_NetLine& netline)
@@ -346,8 +360,8 @@ void BI_NetPoint::unregisterNetLine(BI_NetLine& netline)
     }
     mRegisteredLines.removeOne(&netline);
     netline.updateLine();
-    mGraphicsItem->updateCacheAndRepaint();
-    mErcMsgDeadNetPoint->setVisible(mRegisteredLines.isEmpty());
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+    updateErcMessages();
 }
 
 void BI_NetPoint::updateLines() const noexcept
@@ -379,18 +393,19 @@ void BI_NetPoint::serialize(SExpression& root) const
 
 QPainterPath BI_NetPoint::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->shape().translated(mPosition.toPxQPointF());
 }
 
 bool BI_NetPoint::isSelectable() const noexcept
 {
-    return mGraphicsItem->isSelectable();
+    return mGraphicsItem && mGraphicsItem->isSelectable();
 }
 
 void BI_NetPoint::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
@@ -405,6 +420,11 @@ bool BI_NetPoint::checkAttributesValidity() const noexcept
     return true;
 }
 
+void BI_NetPoint::updateErcMessages() noexcept
+{
+    mErcMsgDeadNetPoint->setVisible(isAddedToBoard() && mRegisteredLines.isEmpty());
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -99,6 +99,7 @@ class BI_NetPoint final : public BI_Base, public SerializableObject,
         // General Methods
         void addToBoard() override;
         void removeFromBoard() override;
+        void createGraphicsItems() noexcept override;
         void registerNetLine(BI_NetLine& netline);
         void unregisterNetLine(BI_NetLine& netline);
         void updateLines() const noexcept;
@@ -124,6 +125,7 @@ class BI_NetPoint final : public BI_Base, public SerializableObject,
     private:
 
         void init();
+        void updateErcMessages() noexcept override;
         bool checkAttributesValidity() const noexcept;
 
 
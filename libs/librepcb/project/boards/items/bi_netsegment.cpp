@@ -169,6 +169,13 @@ bool BI_NetSegment::isUsed() const noexcept
     return ((!mVias.isEmpty()) || (!mNetPoints.isEmpty()) || (!mNetLines.isEmpty()));
 }
 
+qint64 BI_NetSegment::getApproxMemoryUsage() const noexcept
+{
+    return sizeof(*this) + (mVias.count() * sizeof(BI_Via)) +
+           (mNetPoints.count() * sizeof(BI_NetPoint)) +
+           (mNetLines.count() * sizeof(BI_NetLine));
+}
+
 int BI_NetSegment::getViasAtScenePos(const Point& pos, QList<BI_Via*>& vias) const noexcept
 {
     int count = 0;
@@ -443,6 +450,19 @@ void BI_NetSegment::removeFromBoard()
     sgl.dismiss();
 }
 
+void BI_NetSegment::createGraphicsItems() noexcept
+{
+    foreach (BI_Via* via, mVias) {
+        via->createGraphicsItems();
+    }
+    foreach (BI_NetPoint* netpoint, mNetPoints) {
+        netpoint->createGraphicsItems();
+    }
+    foreach (BI_NetLine* netline, mNetLines) {
+        netline->createGraphicsItems();
+    }
+}
+
 void BI_NetSegment::setSelectionRect(const QRectF rectPx) noexcept
 {
     foreach (BI_Via* via, mVias)
@@ -77,6 +77,14 @@ class BI_NetSegment final : public BI_Base, public SerializableObject
         int getNetLinesAtScenePos(const Point& pos, const GraphicsLayer* layer,
                                   QList<BI_NetLine*>& lines) const noexcept;
 
+        /**
+         * @brief Get the approximate amount of heap memory used by this net segment (including all its elements)
+         *
+         * Used by undo commands which keep removed items alive (see
+         * librepcb::UndoCommand::getApproxMemoryUsage()).
+         */
+        qint64 getApproxMemoryUsage() const noexcept;
+
         // Setters
         void setNetSignal(NetSignal& netsignal);
 
@@ -101,6 +109,7 @@ class BI_NetSegment final : public BI_Base, public SerializableObject
         // General Methods
         void addToBoard() override;
         void removeFromBoard() override;
+        void createGraphicsItems() noexcept override;
         void setSelectionRect(const QRectF rectPx) noexcept;
         void clearSelection() const noexcept;
 
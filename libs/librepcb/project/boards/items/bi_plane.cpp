@@ -26,6 +26,7 @@
 #include "../../circuit/circuit.h"
 #include "../../circuit/netsignal.h"
 #include "../graphicsitems/bgi_plane.h"
+#include "../board.h"
 #include "../boardplanefragmentsbuilder.h"
 #include <librepcb/common/scopeguard.h>
 
@@ -41,7 +42,8 @@ namespace project {
 
 BI_Plane::BI_Plane(Board& board, const BI_Plane& other) :
     BI_Base(board), mUuid(Uuid::createRandom()),
-    mLayerName(other.mLayerName), mNetSignal(other.mNetSignal), mOutline(other.mOutline),
+    mLayerName(other.mLayerName), mLayerId(other.mLayerId), mNetSignal(other.mNetSignal),
+    mOutline(other.mOutline),
     mMinWidth(other.mMinWidth), mMinClearance(other.mMinClearance),
     mKeepOrphans(other.mKeepOrphans), mPriority(other.mPriority),
     mConnectStyle(other.mConnectStyle),
@@ -56,6 +58,7 @@ BI_Plane::BI_Plane(Board& board, const SExpression& node) :
 {
     mUuid = node.getChildByIndex(0).getValue<Uuid>(true);
     mLayerName = node.getValueByPath<QString>("layer", true);
+    mLayerId = GraphicsLayer::getLayerId(mLayerName);
     Uuid netSignalUuid = node.getValueByPath<Uuid>("net", true);
     mNetSignal = mBoard.getProject().getCircuit().getNetSignalByUuid(netSignalUuid);
     if(!mNetSignal) {
@@ -83,7 +86,8 @@ BI_Plane::BI_Plane(Board& board, const SExpression& node) :
 
 BI_Plane::BI_Plane(Board& board, const Uuid& uuid, const QString& layerName,
                    NetSignal& netsignal, const Path& outline) :
-    BI_Base(board), mUuid(uuid), mLayerName(layerName), mNetSignal(&netsignal),
+    BI_Base(board), mUuid(uuid), mLayerName(layerName),
+    mLayerId(GraphicsLayer::getLayerId(layerName)), mNetSignal(&netsignal),
     mOutline(outline), mMinWidth(200000), mMinClearance(300000), mKeepOrphans(false),
     mPriority(0), mConnectStyle(ConnectStyle::Solid),
     //mThermalGapWidth(100000), mThermalSpokeWidth(100000),
@@ -94,10 +98,6 @@ BI_Plane::BI_Plane(Board& board, const Uuid& uuid, const QString& layerName,
 
 void BI_Plane::init()
 {
-    mGraphicsItem.reset(new BGI_Plane(*this));
-    mGraphicsItem->setPos(getPosition().toPxQPointF());
-    mGraphicsItem->setRotation(Angle::deg0().toDeg());
-
     // connect to the "attributes changed" signal of the board
     connect(&mBoard, &Board::attributesChanged, this, &BI_Plane::boardAttributesChanged);
 }
@@ -107,6 +107,20 @@ BI_Plane::~BI_Plane() noexcept
     mGraphicsItem.reset();
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 BI_Plane::getApproxMemoryUsage() const noexcept
+{
+    qint64 size = sizeof(*this) + (mOutline.getVertices().capacity() * sizeof(Vertex));
+    size += mFragments.capacity() * sizeof(Path);
+    foreach (const Path& fragment, mFragments) {
+        size += fragment.getVertices().capacity() * sizeof(Vertex);
+    }
+    return size;
+}
+
 /*****************************************************************************************
  *  Setters
  ****************************************************************************************/
@@ -115,7 +129,7 @@ void BI_Plane::setOutline(const Path& outline) noexcept
 {
     if (outline != mOutline) {
         mOutline = outline;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     }
 }
 
@@ -123,7 +137,8 @@ void BI_Plane::setLayerName(const QString& layerName) noexcept
 {
     if (layerName != mLayerName) {
         mLayerName = layerName;
-        mGraphicsItem->updateCacheAndRepaint();
+        mLayerId = GraphicsLayer::getLayerId(mLayerName);
+        if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     }
 }
 
@@ -138,6 +153,8 @@ void BI_Plane::setNetSignal(NetSignal& netsignal)
             auto sg = scopeGuard([&](){mNetSignal->registerBoardPlane(*this);});
             netsignal.registerBoardPlane(*this); // can throw
             sg.dismiss();
+            mBoard.scheduleAirWiresRebuild(mNetSignal);
+            mBoard.scheduleAirWiresRebuild(&netsignal);
         }
         mNetSignal = &netsignal;
     }
@@ -188,8 +205,10 @@ void BI_Plane::addToBoard()
         throw LogicError(__FILE__, __LINE__);
     }
     mNetSignal->registerBoardPlane(*this); // can throw
+    createGraphicsItems();
     BI_Base::addToBoard(mGraphicsItem.data());
-    mGraphicsItem->updateCacheAndRepaint(); // TODO: remove this
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint(); // TODO: remove this
+    mBoard.scheduleAirWiresRebuild(mNetSignal);
 }
 
 void BI_Plane::removeFromBoard()
@@ -199,19 +218,33 @@ void BI_Plane::removeFromBoard()
     }
     mNetSignal->unregisterBoardPlane(*this); // can throw
     BI_Base::removeFromBoard(mGraphicsItem.data());
+    mBoard.scheduleAirWiresRebuild(mNetSignal);
+}
+
+void BI_Plane::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem || (!mBoard.hasGraphicsScene())) {
+        return;
+    }
+    mGraphicsItem.reset(new BGI_Plane(*this));
+    mGraphicsItem->setPos(getPosition().toPxQPointF());
+    mGraphicsItem->setRotation(Angle::deg0().toDeg());
+    addCreatedGraphicsItem(*mGraphicsItem);
 }
 
 void BI_Plane::clear() noexcept
 {
     mFragments.clear();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+    mBoard.scheduleAirWiresRebuild(mNetSignal);
 }
 
 void BI_Plane::rebuild() noexcept
 {
     BoardPlaneFragmentsBuilder builder(*this);
     mFragments = builder.buildFragments();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+    mBoard.scheduleAirWiresRebuild(mNetSignal);
 }
 
 void BI_Plane::serialize(SExpression& root) const
@@ -242,18 +275,19 @@ void BI_Plane::serialize(SExpression& root) const
 
 QPainterPath BI_Plane::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
 bool BI_Plane::isSelectable() const noexcept
 {
-    return mGraphicsItem->isSelectable();
+    return mGraphicsItem && mGraphicsItem->isSelectable();
 }
 
 void BI_Plane::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
@@ -278,7 +312,7 @@ bool BI_Plane::operator<(const BI_Plane& rhs) const noexcept
 
 void BI_Plane::boardAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 /*****************************************************************************************
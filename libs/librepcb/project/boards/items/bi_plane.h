@@ -27,6 +27,7 @@
 #include "bi_base.h"
 #include <librepcb/common/fileio/serializableobject.h>
 #include <librepcb/common/geometry/path.h>
+#include <librepcb/common/graphics/graphicslayer.h>
 #include <librepcb/common/uuid.h>
 
 /*****************************************************************************************
@@ -75,6 +76,7 @@ class BI_Plane final : public BI_Base, public SerializableObject
         // Getters
         const Uuid& getUuid() const noexcept {return mUuid;}
         const QString& getLayerName() const noexcept {return mLayerName;}
+        GraphicsLayer::Id getLayerId() const noexcept {return mLayerId;}
         NetSignal& getNetSignal() const noexcept {return *mNetSignal;}
         const Length& getMinWidth() const noexcept {return mMinWidth;}
         const Length& getMinClearance() const noexcept {return mMinClearance;}
@@ -87,6 +89,14 @@ class BI_Plane final : public BI_Base, public SerializableObject
         const QVector<Path>& getFragments() const noexcept {return mFragments;}
         bool isSelectable() const noexcept override;
 
+        /**
+         * @brief Get the approximate amount of heap memory used by this plane (including its fragments)
+         *
+         * Used by undo commands which keep removed items alive (see
+         * librepcb::UndoCommand::getApproxMemoryUsage()).
+         */
+        qint64 getApproxMemoryUsage() const noexcept;
+
         // Setters
         void setOutline(const Path& outline) noexcept;
         void setLayerName(const QString& layerName) noexcept;
@@ -100,6 +110,7 @@ class BI_Plane final : public BI_Base, public SerializableObject
         // General Methods
         void addToBoard() override;
         void removeFromBoard() override;
+        void createGraphicsItems() noexcept override;
         void clear() noexcept;
         void rebuild() noexcept;
 
@@ -130,6 +141,7 @@ class BI_Plane final : public BI_Base, public SerializableObject
     private: // Data
         Uuid mUuid;
         QString mLayerName;
+        GraphicsLayer::Id mLayerId; ///< same as #mLayerName, but cheaper to compare
         NetSignal* mNetSignal;
         Path mOutline;
         Length mMinWidth;
@@ -70,9 +70,6 @@ BI_Polygon::BI_Polygon(Board& board, const Uuid& uuid, const QString& layerName,
 
 void BI_Polygon::init()
 {
-    mGraphicsItem.reset(new PolygonGraphicsItem(*mPolygon, mBoard.getLayerStack()));
-    mGraphicsItem->setZValue(Board::ZValue_Default);
-
     // connect to the "attributes changed" signal of the board
     connect(&mBoard, &Board::attributesChanged, this, &BI_Polygon::boardAttributesChanged);
 }
@@ -83,6 +80,16 @@ BI_Polygon::~BI_Polygon() noexcept
     mPolygon.reset();
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 BI_Polygon::getApproxMemoryUsage() const noexcept
+{
+    return sizeof(*this) + sizeof(Polygon) +
+           (mPolygon->getPath().getVertices().capacity() * sizeof(Vertex));
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -92,6 +99,7 @@ void BI_Polygon::addToBoard()
     if (isAddedToBoard()) {
         throw LogicError(__FILE__, __LINE__);
     }
+    createGraphicsItems();
     BI_Base::addToBoard(mGraphicsItem.data());
 }
 
@@ -103,6 +111,17 @@ void BI_Polygon::removeFromBoard()
     BI_Base::removeFromBoard(mGraphicsItem.data());
 }
 
+void BI_Polygon::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem || (!mBoard.hasGraphicsScene())) {
+        return;
+    }
+    mGraphicsItem.reset(new PolygonGraphicsItem(*mPolygon, mBoard.getLayerStack()));
+    mGraphicsItem->setZValue(Board::ZValue_Default);
+    mGraphicsItem->setSelected(isSelected());
+    addCreatedGraphicsItem(*mGraphicsItem);
+}
+
 void BI_Polygon::serialize(SExpression& root) const
 {
     mPolygon->serialize(root);
@@ -114,6 +133,7 @@ void BI_Polygon::serialize(SExpression& root) const
 
 QPainterPath BI_Polygon::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
@@ -131,7 +151,7 @@ bool BI_Polygon::isSelectable() const noexcept
 void BI_Polygon::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->setSelected(selected);
+    if (mGraphicsItem) mGraphicsItem->setSelected(selected);
 }
 
 /*****************************************************************************************
@@ -140,7 +160,7 @@ void BI_Polygon::setSelected(bool selected) noexcept
 
 void BI_Polygon::boardAttributesChanged()
 {
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
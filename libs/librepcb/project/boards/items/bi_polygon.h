@@ -75,9 +75,18 @@ class BI_Polygon final : public BI_Base, public SerializableObject
         const Uuid& getUuid() const noexcept; // convenience function, e.g. for template usage
         bool isSelectable() const noexcept override;
 
+        /**
+         * @brief Get the approximate amount of heap memory used by this polygon
+         *
+         * Used by undo commands which keep removed items alive (see
+         * librepcb::UndoCommand::getApproxMemoryUsage()).
+         */
+        qint64 getApproxMemoryUsage() const noexcept;
+
         // General Methods
         void addToBoard() override;
         void removeFromBoard() override;
+        void createGraphicsItems() noexcept override;
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
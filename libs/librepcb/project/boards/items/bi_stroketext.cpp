@@ -70,10 +70,6 @@ void BI_StrokeText::init()
     mText->setAttributeProvider(&mBoard);
     mText->setFont(&getProject().getStrokeFonts().getFont(mBoard.getDefaultFontName())); // can throw
 
-    mGraphicsItem.reset(new StrokeTextGraphicsItem(*mText, mBoard.getLayerStack()));
-    mAnchorGraphicsItem.reset(new LineGraphicsItem());
-    updateGraphicsItems();
-
     // connect to the "attributes changed" signal of the board
     connect(&mBoard, &Board::attributesChanged, this, &BI_StrokeText::boardAttributesChanged);
 }
@@ -98,6 +94,10 @@ void BI_StrokeText::setFootprint(BI_Footprint* footprint) noexcept
 
 void BI_StrokeText::updateGraphicsItems() noexcept
 {
+    if (!mGraphicsItem) {
+        return;
+    }
+
     // update z-value
     Board::ItemZValue zValue = Board::ZValue_Texts;
     if (GraphicsLayer::isTopLayer(mText->getLayerName())) {
@@ -122,8 +122,9 @@ void BI_StrokeText::addToBoard()
     if (isAddedToBoard()) {
         throw LogicError(__FILE__, __LINE__);
     }
+    createGraphicsItems();
     BI_Base::addToBoard(mGraphicsItem.data());
-    mBoard.getGraphicsScene().addItem(*mAnchorGraphicsItem);
+    if (mAnchorGraphicsItem) mBoard.getGraphicsScene().addItem(*mAnchorGraphicsItem);
 }
 
 void BI_StrokeText::removeFromBoard()
@@ -132,7 +133,20 @@ void BI_StrokeText::removeFromBoard()
         throw LogicError(__FILE__, __LINE__);
     }
     BI_Base::removeFromBoard(mGraphicsItem.data());
-    mBoard.getGraphicsScene().removeItem(*mAnchorGraphicsItem);
+    if (mAnchorGraphicsItem) mBoard.getGraphicsScene().removeItem(*mAnchorGraphicsItem);
+}
+
+void BI_StrokeText::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem || (!mBoard.hasGraphicsScene())) {
+        return;
+    }
+    mGraphicsItem.reset(new StrokeTextGraphicsItem(*mText, mBoard.getLayerStack()));
+    mGraphicsItem->setSelected(isSelected());
+    mAnchorGraphicsItem.reset(new LineGraphicsItem());
+    updateGraphicsItems();
+    addCreatedGraphicsItem(*mGraphicsItem);
+    addCreatedGraphicsItem(*mAnchorGraphicsItem);
 }
 
 void BI_StrokeText::serialize(SExpression& root) const
@@ -151,6 +165,7 @@ const Point& BI_StrokeText::getPosition() const noexcept
 
 QPainterPath BI_StrokeText::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
@@ -168,7 +183,7 @@ bool BI_StrokeText::isSelectable() const noexcept
 void BI_StrokeText::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->setSelected(selected);
+    if (mGraphicsItem) mGraphicsItem->setSelected(selected);
     updateGraphicsItems();
 }
 
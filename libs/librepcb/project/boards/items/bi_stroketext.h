@@ -78,6 +78,7 @@ class BI_StrokeText final : public BI_Base, public SerializableObject,
         void updateGraphicsItems() noexcept;
         void addToBoard() override;
         void removeFromBoard() override;
+        void createGraphicsItems() noexcept override;
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
@@ -83,10 +83,6 @@ BI_Via::BI_Via(BI_NetSegment& netsegment, const Point& position, Shape shape, co
 
 void BI_Via::init()
 {
-    // create the graphics item
-    mGraphicsItem.reset(new BGI_Via(*this));
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
-
     // connect to the "attributes changed" signal of the board
     connect(&mBoard, &Board::attributesChanged,
             this, &BI_Via::boardAttributesChanged);
@@ -113,6 +109,11 @@ bool BI_Via::isOnLayer(const QString& layerName) const noexcept
     return GraphicsLayer::isCopperLayer(layerName);
 }
 
+bool BI_Via::isOnLayer(GraphicsLayer::Id layerId) const noexcept
+{
+    return GraphicsLayer::isCopperLayer(layerId);
+}
+
 Path BI_Via::getOutline(const Length& expansion) const noexcept
 {
     Length size = mSize + (expansion * 2);
@@ -148,8 +149,11 @@ void BI_Via::setPosition(const Point& position) noexcept
 {
     if (position != mPosition) {
         mPosition = position;
-        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        if (mGraphicsItem) mGraphicsItem->setPos(mPosition.toPxQPointF());
         updateNetPoints();
+        if (isAddedToBoard()) {
+            mBoard.scheduleAirWiresRebuild(&getNetSignalOfNetSegment());
+        }
     }
 }
 
@@ -157,7 +161,7 @@ void BI_Via::setShape(Shape shape) noexcept
 {
     if (shape != mShape) {
         mShape = shape;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     }
 }
 
@@ -165,7 +169,7 @@ void BI_Via::setSize(const Length& size) noexcept
 {
     if (size != mSize) {
         mSize = size;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     }
 }
 
@@ -173,7 +177,7 @@ void BI_Via::setDrillDiameter(const Length& diameter) noexcept
 {
     if (diameter != mDrillDiameter) {
         mDrillDiameter = diameter;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     }
 }
 
@@ -186,10 +190,12 @@ void BI_Via::addToBoard()
     if (isAddedToBoard() || isUsed()) {
         throw LogicError(__FILE__, __LINE__);
     }
+    createGraphicsItems();
     mHighlightChangedConnection = connect(&getNetSignalOfNetSegment(),
                                           &NetSignal::highlightedChanged,
-                                          [this](){mGraphicsItem->update();});
+                                          [this](){if (mGraphicsItem) mGraphicsItem->update();});
     BI_Base::addToBoard(mGraphicsItem.data());
+    mBoard.scheduleAirWiresRebuild(&getNetSignalOfNetSegment());
 }
 
 void BI_Via::removeFromBoard()
@@ -199,6 +205,17 @@ void BI_Via::removeFromBoard()
     }
     disconnect(mHighlightChangedConnection);
     BI_Base::removeFromBoard(mGraphicsItem.data());
+    mBoard.scheduleAirWiresRebuild(&getNetSignalOfNetSegment());
+}
+
+void BI_Via::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem || (!mBoard.hasGraphicsScene())) {
+        return;
+    }
+    mGraphicsItem.reset(new BGI_Via(*this));
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    addCreatedGraphicsItem(*mGraphicsItem);
 }
 
 void BI_Via::registerNetPoint(BI_NetPoint& netpoint)
@@ -210,7 +227,7 @@ void BI_Via::registerNetPoint(BI_NetPoint& netpoint)
     }
     mRegisteredNetPoints.insert(netpoint.getLayer().getName(), &netpoint);
     netpoint.updateLines();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void BI_Via::unregisterNetPoint(BI_NetPoint& netpoint)
@@ -220,7 +237,7 @@ void BI_Via::unregisterNetPoint(BI_NetPoint& netpoint)
     }
     mRegisteredNetPoints.remove(netpoint.getLayer().getName());
     netpoint.updateLines();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void BI_Via::updateNetPoints() const noexcept
@@ -252,18 +269,19 @@ void BI_Via::serialize(SExpression& root) const
 
 QPainterPath BI_Via::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->shape().translated(mPosition.toPxQPointF());
 }
 
 bool BI_Via::isSelectable() const noexcept
 {
-    return mGraphicsItem->isSelectable();
+    return mGraphicsItem && mGraphicsItem->isSelectable();
 }
 
 void BI_Via::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
@@ -272,7 +290,7 @@ void BI_Via::setSelected(bool selected) noexcept
 
 void BI_Via::boardAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 bool BI_Via::checkAttributesValidity() const noexcept
@@ -27,6 +27,7 @@
 #include "bi_base.h"
 #include <librepcb/common/fileio/serializableobject.h>
 #include <librepcb/common/geometry/path.h>
+#include <librepcb/common/graphics/graphicslayer.h>
 #include <librepcb/common/uuid.h>
 #include "../graphicsitems/bgi_via.h"
 
@@ -81,6 +82,7 @@ class BI_Via final : public BI_Base, public SerializableObject
         BI_NetPoint* getNetPointOfLayer(const QString& layerName) const noexcept {return mRegisteredNetPoints.value(layerName, nullptr);}
         bool isUsed() const noexcept {return (mRegisteredNetPoints.count() > 0);}
         bool isOnLayer(const QString& layerName) const noexcept;
+        bool isOnLayer(GraphicsLayer::Id layerId) const noexcept;
         bool isSelectable() const noexcept override;
         Path getOutline(const Length& expansion = Length(0)) const noexcept;
         Path getSceneOutline(const Length& expansion = Length(0)) const noexcept;
@@ -95,6 +97,7 @@ class BI_Via final : public BI_Base, public SerializableObject
         // General Methods
         void addToBoard() override;
         void removeFromBoard() override;
+        void createGraphicsItems() noexcept override;
         void registerNetPoint(BI_NetPoint& netpoint);
         void unregisterNetPoint(BI_NetPoint& netpoint);
         void updateNetPoints() const noexcept;
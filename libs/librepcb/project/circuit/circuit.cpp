@@ -374,8 +374,7 @@ bool Circuit::save(bool toOriginal, QStringList& errors) noexcept
     // Save "core/circuit.lp"
     try
     {
-        SExpression doc(serializeToDomElement("librepcb_circuit"));
-        mFile->save(doc, toOriginal);
+        prepareSave(toOriginal)(); // can throw
     }
     catch (Exception& e)
     {
@@ -386,6 +385,13 @@ bool Circuit::save(bool toOriginal, QStringList& errors) noexcept
     return success;
 }
 
+std::function<void()> Circuit::prepareSave(bool toOriginal)
+{
+    SmartSExprFile* file = mFile.data();
+    SExpression doc(serializeToDomElement("librepcb_circuit")); // can throw
+    return [file, doc, toOriginal](){file->save(doc, toOriginal);};
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
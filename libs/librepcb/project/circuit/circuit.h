@@ -23,6 +23,7 @@
 /*****************************************************************************************
  *  Includes
  ****************************************************************************************/
+#include <functional>
 #include <QtCore>
 #include <librepcb/common/uuid.h>
 #include <librepcb/common/fileio/serializableobject.h>
@@ -113,6 +114,19 @@ class Circuit final : public QObject, public SerializableObject
 
         // General Methods
         bool save(bool toOriginal, QStringList& errors) noexcept;
+        /**
+         * @brief Serialize the circuit and return a function which writes it to the file
+         *
+         * This allows to serialize the circuit in the main thread, but to write the file
+         * (which is much slower) in a worker thread.
+         *
+         * @param toOriginal    See #save()
+         *
+         * @return A function which writes the file (and throws on error)
+         *
+         * @throw Exception on error
+         */
+        std::function<void()> prepareSave(bool toOriginal);
 
         // Operator Overloadings
         Circuit& operator=(const Circuit& rhs) = delete;
@@ -31,6 +31,7 @@
 #include "componentsignalinstance.h"
 #include <librepcb/library/cmp/component.h>
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
 #include "../schematics/items/si_symbol.h"
 #include "../boards/items/bi_device.h"
 
@@ -136,6 +137,7 @@ ComponentInstance::~ComponentInstance() noexcept
 {
     Q_ASSERT(!mIsAddedToCircuit);
     Q_ASSERT(!isUsed());
+    mCircuit.getProject().getErcMsgList().unscheduleUpdate(*this);
 
     qDeleteAll(mSignals);       mSignals.clear();
 }
@@ -213,7 +215,7 @@ void ComponentInstance::setName(const QString& name)
                 tr("The new component name must not be empty!"));
         }
         mName = name;
-        updateErcMessages();
+        scheduleErcMessagesUpdate();
         emit attributesChanged();
     }
 }
@@ -249,7 +251,7 @@ void ComponentInstance::addToCircuit()
         sgl.add([signal](){signal->removeFromCircuit();});
     }
     mIsAddedToCircuit = true;
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
     sgl.dismiss();
 }
 
@@ -269,7 +271,7 @@ void ComponentInstance::removeFromCircuit()
         sgl.add([signal](){signal->addToCircuit();});
     }
     mIsAddedToCircuit = false;
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
     sgl.dismiss();
 }
 
@@ -299,7 +301,7 @@ void ComponentInstance::registerSymbol(SI_Symbol& symbol)
         }
     }
     mRegisteredSymbols.insert(itemUuid, &symbol);
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void ComponentInstance::unregisterSymbol(SI_Symbol& symbol)
@@ -311,7 +313,7 @@ void ComponentInstance::unregisterSymbol(SI_Symbol& symbol)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredSymbols.remove(itemUuid);
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void ComponentInstance::registerDevice(BI_Device& device)
@@ -322,7 +324,7 @@ void ComponentInstance::registerDevice(BI_Device& device)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredDevices.append(&device);
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
     emit attributesChanged(); // parent attribute provider may have changed!
 }
 
@@ -332,7 +334,7 @@ void ComponentInstance::unregisterDevice(BI_Device& device)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredDevices.removeOne(&device);
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
     emit attributesChanged(); // parent attribute provider may have changed!
 }
 
@@ -397,6 +399,11 @@ bool ComponentInstance::checkAttributesValidity() const noexcept
     return true;
 }
 
+void ComponentInstance::scheduleErcMessagesUpdate() noexcept
+{
+    mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
+}
+
 void ComponentInstance::updateErcMessages() noexcept
 {
     int required = getUnplacedRequiredSymbolsCount();
@@ -158,7 +158,8 @@ class ComponentInstance : public QObject, public AttributeProvider,
 
         void init();
         bool checkAttributesValidity() const noexcept;
-        void updateErcMessages() noexcept;
+        void scheduleErcMessagesUpdate() noexcept;
+        void updateErcMessages() noexcept override;
         const QStringList& getLocaleOrder() const noexcept;
 
 
@@ -115,7 +115,8 @@ class NetSignal final : public QObject, public IF_ErcMsgProvider, public Seriali
 
     private:
         bool checkAttributesValidity() const noexcept;
-        void updateErcMessages() noexcept;
+        void scheduleErcMessagesUpdate() noexcept;
+        void updateErcMessages() noexcept override;
 
 
         // General
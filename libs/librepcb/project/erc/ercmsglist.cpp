@@ -48,10 +48,15 @@ ErcMsgList::ErcMsgList(Project& project, bool restore, bool readOnly, bool creat
     } else {
         mFile.reset(new SmartSExprFile(mFilepath, restore, readOnly));
     }
+
+    mUpdateTimer.setSingleShot(true);
+    connect(&mUpdateTimer, &QTimer::timeout, this, &ErcMsgList::triggerScheduledUpdates);
 }
 
 ErcMsgList::~ErcMsgList() noexcept
 {
+    Q_ASSERT(mScheduledProvidersSet.isEmpty());
+    applyPendingChanges(false);
     Q_ASSERT(mItems.isEmpty());
 }
 
@@ -62,31 +67,91 @@ ErcMsgList::~ErcMsgList() noexcept
 void ErcMsgList::add(ErcMsg* ercMsg) noexcept
 {
     Q_ASSERT(ercMsg);
-    Q_ASSERT(!mItems.contains(ercMsg));
     Q_ASSERT(!ercMsg->isIgnored());
-    mItems.append(ercMsg);
-    emit ercMsgAdded(ercMsg);
+    Q_ASSERT(!mPendingAddedItemsSet.contains(ercMsg));
+    // the address of a removed (and deleted) message may be reused by a new message
+    Q_ASSERT((!mItems.contains(ercMsg)) || mPendingRemovedItemsSet.contains(ercMsg));
+    mPendingAddedItems.append(ercMsg);
+    mPendingAddedItemsSet.insert(ercMsg);
+    if (!mUpdateTimer.isActive()) {
+        mUpdateTimer.start(0);
+    }
 }
 
 void ErcMsgList::remove(ErcMsg* ercMsg) noexcept
 {
     Q_ASSERT(ercMsg);
-    Q_ASSERT(mItems.contains(ercMsg));
     Q_ASSERT(!ercMsg->isIgnored());
-    mItems.removeOne(ercMsg);
-    emit ercMsgRemoved(ercMsg);
+    if (mPendingAddedItemsSet.remove(ercMsg)) {
+        return; // the message was never reported
+    }
+    Q_ASSERT(mItems.contains(ercMsg));
+    Q_ASSERT(!mPendingRemovedItemsSet.contains(ercMsg));
+    mPendingChangedItemsSet.remove(ercMsg);
+    mPendingRemovedItems.append(ercMsg);
+    mPendingRemovedItemsSet.insert(ercMsg);
+    if (!mUpdateTimer.isActive()) {
+        mUpdateTimer.start(0);
+    }
 }
 
 void ErcMsgList::update(ErcMsg* ercMsg) noexcept
 {
     Q_ASSERT(ercMsg);
-    Q_ASSERT(mItems.contains(ercMsg));
     Q_ASSERT(ercMsg->isVisible());
-    emit ercMsgChanged(ercMsg);
+    if (mPendingAddedItemsSet.contains(ercMsg) || mPendingChangedItemsSet.contains(ercMsg)) {
+        return; // the change will be reported anyway
+    }
+    Q_ASSERT(mItems.contains(ercMsg));
+    Q_ASSERT(!mPendingRemovedItemsSet.contains(ercMsg));
+    mPendingChangedItems.append(ercMsg);
+    mPendingChangedItemsSet.insert(ercMsg);
+    if (!mUpdateTimer.isActive()) {
+        mUpdateTimer.start(0);
+    }
+}
+
+void ErcMsgList::scheduleUpdate(IF_ErcMsgProvider& provider) noexcept
+{
+    if (mScheduledProvidersSet.contains(&provider)) {
+        return;
+    }
+    // keep the order to get deterministic results (e.g. the order in the saved file)
+    mScheduledProviders.append(&provider);
+    mScheduledProvidersSet.insert(&provider);
+    if (!mUpdateTimer.isActive()) {
+        mUpdateTimer.start(0);
+    }
+}
+
+void ErcMsgList::unscheduleUpdate(IF_ErcMsgProvider& provider) noexcept
+{
+    if (mScheduledProvidersSet.remove(&provider)) {
+        mScheduledProviders.removeOne(&provider);
+    }
+}
+
+void ErcMsgList::triggerScheduledUpdates() noexcept
+{
+    mUpdateTimer.stop();
+
+    // updating an object does normally not schedule other objects, but if it does,
+    // they are updated in the next iteration
+    while (!mScheduledProviders.isEmpty()) {
+        QList<IF_ErcMsgProvider*> providers;
+        providers.swap(mScheduledProviders);
+        mScheduledProvidersSet.clear();
+        foreach (IF_ErcMsgProvider* provider, providers) {
+            provider->updateErcMessages();
+        }
+    }
+
+    applyPendingChanges(true);
 }
 
 void ErcMsgList::restoreIgnoreState()
 {
+    triggerScheduledUpdates(); // make sure all messages exist
     if (mFile->isCreated()) return; // the file does not yet exist
 
     SExpression root = mFile->parseFileAndBuildDomTree();
@@ -112,6 +177,9 @@ bool ErcMsgList::save(bool toOriginal, QStringList& errors) noexcept
 {
     bool success = true;
 
+    // make sure all messages are up to date
+    triggerScheduledUpdates();
+
     // Save "core/erc.lp"
     try
     {
@@ -143,6 +211,45 @@ void ErcMsgList::serialize(SExpression& root) const
     }
 }
 
+void ErcMsgList::applyPendingChanges(bool emitSignals) noexcept
+{
+    // take the pending changes first because the signal receivers may modify them
+    QList<ErcMsg*> removedItems = takeValidItems(mPendingRemovedItems, mPendingRemovedItemsSet);
+    QSet<ErcMsg*> removedItemsSet = removedItems.toSet();
+    QList<ErcMsg*> addedItems = takeValidItems(mPendingAddedItems, mPendingAddedItemsSet);
+    QList<ErcMsg*> changedItems = takeValidItems(mPendingChangedItems, mPendingChangedItemsSet);
+
+    // remove all messages at once to avoid quadratic runtime (removals must be applied
+    // before additions since the address of a removed message may be reused)
+    if (!removedItems.isEmpty()) {
+        QList<ErcMsg*> items;
+        items.reserve(mItems.count() - removedItems.count());
+        foreach (ErcMsg* ercMsg, mItems) {
+            if (!removedItemsSet.contains(ercMsg)) items.append(ercMsg);
+        }
+        mItems.swap(items);
+    }
+    mItems.append(addedItems);
+
+    if (emitSignals) {
+        foreach (ErcMsg* ercMsg, removedItems) emit ercMsgRemoved(ercMsg);
+        foreach (ErcMsg* ercMsg, addedItems) emit ercMsgAdded(ercMsg);
+        foreach (ErcMsg* ercMsg, changedItems) emit ercMsgChanged(ercMsg);
+    }
+}
+
+QList<ErcMsg*> ErcMsgList::takeValidItems(QList<ErcMsg*>& list, QSet<ErcMsg*>& set) noexcept
+{
+    QList<ErcMsg*> items;
+    items.reserve(set.count());
+    foreach (ErcMsg* ercMsg, list) {
+        if (set.remove(ercMsg)) items.append(ercMsg); // skips invalid and duplicate entries
+    }
+    list.clear();
+    Q_ASSERT(set.isEmpty());
+    return items;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -39,6 +39,7 @@ namespace project {
 
 class Project;
 class ErcMsg;
+class IF_ErcMsgProvider;
 
 /*****************************************************************************************
  *  Class ErcMsgList
@@ -46,6 +47,20 @@ class ErcMsg;
 
 /**
  * @brief The ErcMsgList class contains a list of ERC messages which are visible for the user
+ *
+ * The ERC messages are not evaluated immediately on every modification of the project.
+ * Instead, modified objects (implementing librepcb::project::IF_ErcMsgProvider) schedule
+ * an update with #scheduleUpdate() and all scheduled objects are updated together as
+ * soon as the control returns to the event loop (i.e. once at the end of an undo
+ * command or a bulk operation like pasting or importing). The resulting changes of the
+ * message list are then reported with the #ercMsgRemoved(), #ercMsgAdded() and
+ * #ercMsgChanged() signals as one diff (in this order).
+ *
+ * @note    A removed message is often deleted right after its removal, i.e. before the
+ *          removal is reported. Therefore the pointer passed to #ercMsgRemoved() must
+ *          only be used as an identifier and must never be dereferenced. Since its
+ *          address may be reused by a message added in the same batch, removals are
+ *          always reported before additions.
  */
 class ErcMsgList final : public QObject, public SerializableObject
 {
@@ -60,15 +75,28 @@ class ErcMsgList final : public QObject, public SerializableObject
         ~ErcMsgList() noexcept;
 
         // Getters
+
+        /**
+         * @brief Get all visible ERC messages
+         *
+         * @warning Pending removals are not yet applied, so the list may contain already
+         *          deleted messages. Call #triggerScheduledUpdates() before accessing the
+         *          messages.
+         *
+         * @return All visible ERC messages
+         */
         const QList<ErcMsg*>& getItems() const noexcept {return mItems;}
 
         // General Methods
         void add(ErcMsg* ercMsg) noexcept;
         void remove(ErcMsg* ercMsg) noexcept;
         void update(ErcMsg* ercMsg) noexcept;
+        void scheduleUpdate(IF_ErcMsgProvider& provider) noexcept;
+        void unscheduleUpdate(IF_ErcMsgProvider& provider) noexcept;
+        void triggerScheduledUpdates() noexcept;
         void restoreIgnoreState();
         bool save(bool toOriginal, QStringList& errors) noexcept;
-        
+
         // Operator Overloadings
         ErcMsgList& operator=(const ErcMsgList& rhs) = delete;
 
@@ -85,6 +113,10 @@ class ErcMsgList final : public QObject, public SerializableObject
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
 
+        void applyPendingChanges(bool emitSignals) noexcept;
+        static QList<ErcMsg*> takeValidItems(QList<ErcMsg*>& list, QSet<ErcMsg*>& set) noexcept;
+
+
 
         // General
         Project& mProject;
@@ -95,6 +127,19 @@ class ErcMsgList final : public QObject, public SerializableObject
 
         // Misc
         QList<ErcMsg*> mItems; ///< contains all visible ERC messages
+
+        // Deferred Updates
+        QList<IF_ErcMsgProvider*> mScheduledProviders; ///< objects to update, in scheduling order
+        QSet<IF_ErcMsgProvider*> mScheduledProvidersSet; ///< for fast lookup in #mScheduledProviders
+        // Note: Entries of the lists are only valid if they are also contained in the
+        // corresponding set. This allows to remove pending entries in constant time.
+        QList<ErcMsg*> mPendingAddedItems;      ///< shown since the last update
+        QSet<ErcMsg*> mPendingAddedItemsSet;    ///< valid entries of #mPendingAddedItems
+        QList<ErcMsg*> mPendingRemovedItems;    ///< hidden since the last update
+        QSet<ErcMsg*> mPendingRemovedItemsSet;  ///< valid entries of #mPendingRemovedItems
+        QList<ErcMsg*> mPendingChangedItems;    ///< modified since the last update
+        QSet<ErcMsg*> mPendingChangedItemsSet;  ///< valid entries of #mPendingChangedItems
+        QTimer mUpdateTimer;
 };
 
 /*****************************************************************************************
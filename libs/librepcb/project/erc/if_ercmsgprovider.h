@@ -63,6 +63,16 @@ class IF_ErcMsgProvider
 
         // Getters
         virtual const char* getErcMsgOwnerClassName() const noexcept = 0;
+
+        // General Methods
+
+        /**
+         * @brief Update all ERC messages of this object
+         *
+         * This is called by librepcb::project::ErcMsgList for all objects which have
+         * scheduled an update with librepcb::project::ErcMsgList::scheduleUpdate().
+         */
+        virtual void updateErcMessages() noexcept = 0;
 };
 
 /*****************************************************************************************
@@ -21,10 +21,12 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QtConcurrent/QtConcurrent>
 #include <librepcb/common/exceptions.h>
 #include "projectlibrary.h"
 #include <librepcb/common/fileio/filepath.h>
 #include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/fileio/filesavetransaction.h>
 #include "../project.h"
 #include <librepcb/library/sym/symbol.h>
 #include <librepcb/library/pkg/package.h>
@@ -56,16 +58,27 @@ ProjectLibrary::ProjectLibrary(Project& project, bool restore, bool readOnly) :
         FileUtils::makePath(mLibraryPath); // can throw
     }
 
+    // start loading all library elements in worker threads
+    QList<QFuture<Symbol*>>    symbols    = startLoadingElements<Symbol>    (mLibraryPath.getPathTo("sym"));
+    QList<QFuture<Package*>>   packages   = startLoadingElements<Package>   (mLibraryPath.getPathTo("pkg"));
+    QList<QFuture<Component*>> components = startLoadingElements<Component> (mLibraryPath.getPathTo("cmp"));
+    QList<QFuture<Device*>>    devices    = startLoadingElements<Device>    (mLibraryPath.getPathTo("dev"));
+
     try
     {
-        // Load all library elements
-        loadElements<Symbol>    (mLibraryPath.getPathTo("sym"),    "symbols",      mSymbols);
-        loadElements<Package>   (mLibraryPath.getPathTo("pkg"),    "packages",     mPackages);
-        loadElements<Component> (mLibraryPath.getPathTo("cmp"),    "components",   mComponents);
-        loadElements<Device>    (mLibraryPath.getPathTo("dev"),    "devices",      mDevices);
+        finishLoadingElements<Symbol>    (symbols,      "symbols",      mSymbols);
+        finishLoadingElements<Package>   (packages,     "packages",     mPackages);
+        finishLoadingElements<Component> (components,   "components",   mComponents);
+        finishLoadingElements<Device>    (devices,      "devices",      mDevices);
     }
     catch (Exception &e)
     {
+        // wait for all still running workers and free the elements loaded by them...
+        discardLoadingElements<Device>(devices);
+        discardLoadingElements<Component>(components);
+        discardLoadingElements<Package>(packages);
+        discardLoadingElements<Symbol>(symbols);
+
         // free the allocated memory in the reverse order of their allocation...
         qDeleteAll(mDevices);       mDevices.clear();
         qDeleteAll(mComponents);    mComponents.clear();
@@ -184,6 +197,12 @@ bool ProjectLibrary::save(bool toOriginal, QStringList& errors) noexcept
 {
     bool success = true;
 
+    // The element directories are copied, moved and removed directly in the file system,
+    // which is not covered by a FileSaveTransaction. To keep the content of these
+    // directories consistent, the element files are written immediately as well (each
+    // file atomically) instead of within the transaction of the project.
+    FileSaveTransaction::Scope noTransaction(nullptr);
+
     // Save all elements
     if (!saveElements<Symbol>(toOriginal, errors, mLibraryPath.getPathTo("sym"), mSymbols, mAddedSymbols, mRemovedSymbols))
         success = false;
@@ -202,9 +221,9 @@ bool ProjectLibrary::save(bool toOriginal, QStringList& errors) noexcept
  ****************************************************************************************/
 
 template <typename ElementType>
-void ProjectLibrary::loadElements(const FilePath& directory, const QString& type,
-                                  QHash<Uuid, ElementType*>& elementList)
+QList<QFuture<ElementType*>> ProjectLibrary::startLoadingElements(const FilePath& directory) noexcept
 {
+    QList<QFuture<ElementType*>> futures;
     QDir dir(directory.toStr());
 
     // search all subdirectories which have a valid UUID as directory name
@@ -225,10 +244,31 @@ void ProjectLibrary::loadElements(const FilePath& directory, const QString& type
             continue;
         }
 
-        // load the library element --> an exception will be thrown on error
-        ElementType* element = new ElementType(subdirPath, false);
+        // load the library element in a worker thread --> an exception thrown on error
+        // will be rethrown by QFuture::result()
+        QThread* targetThread = thread();
+        futures.append(QtConcurrent::run([subdirPath, targetThread](){
+            ElementType* element = new ElementType(subdirPath, false);
+            element->moveToThread(targetThread); // must be called from the worker thread
+            return element;
+        }));
+    }
+
+    return futures;
+}
+
+template <typename ElementType>
+void ProjectLibrary::finishLoadingElements(QList<QFuture<ElementType*>>& futures,
+                                           const QString& type,
+                                           QHash<Uuid, ElementType*>& elementList)
+{
+    while (!futures.isEmpty()) {
+        // wait until the element is loaded --> rethrows the exception of the worker
+        ElementType* element = futures.takeFirst().result();
 
         if (elementList.contains(element->getUuid())) {
+            FilePath subdirPath = element->getFilePath();
+            delete element;
             throw RuntimeError(__FILE__, __LINE__,
                 QString(tr("There are multiple library elements with the same "
                 "UUID in the directory \"%1\"")).arg(subdirPath.toNative()));
@@ -240,6 +280,19 @@ void ProjectLibrary::loadElements(const FilePath& directory, const QString& type
     qDebug() << "successfully loaded" << elementList.count() << qPrintable(type);
 }
 
+template <typename ElementType>
+void ProjectLibrary::discardLoadingElements(QList<QFuture<ElementType*>>& futures) noexcept
+{
+    foreach (QFuture<ElementType*> future, futures) {
+        try {
+            delete future.result(); // waits until the worker is finished
+        } catch (...) {
+            // the element could not be loaded, so there is nothing to free
+        }
+    }
+    futures.clear();
+}
+
 template <typename ElementType>
 void ProjectLibrary::addElement(ElementType& element,
                                 QHash<Uuid, ElementType*>& elementList,
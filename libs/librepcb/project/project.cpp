@@ -21,6 +21,7 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QtConcurrent/QtConcurrent>
 #include <QPrinter>
 #include <librepcb/common/exceptions.h>
 #include <librepcb/common/fileio/directorylock.h>
@@ -29,6 +30,7 @@
 #include <librepcb/common/fileio/smartversionfile.h>
 #include <librepcb/common/fileio/sexpression.h>
 #include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/fileio/filesavetransaction.h>
 #include <librepcb/common/font/strokefontpool.h>
 #include "project.h"
 #include "library/projectlibrary.h"
@@ -47,11 +49,20 @@
 namespace librepcb {
 namespace project {
 
+/*****************************************************************************************
+ *  Types
+ ****************************************************************************************/
+
+struct Project::ParsedFile {
+    SExpression root;       ///< The parsed DOM tree
+    QByteArray content;     ///< The raw content of the file
+};
+
 /*****************************************************************************************
  *  Constructors / Destructor
  ****************************************************************************************/
 
-Project::Project(const FilePath& filepath, bool create, bool readOnly) :
+Project::Project(const FilePath& filepath, bool create, bool readOnly, bool interactive) :
     QObject(nullptr), AttributeProvider(), mPath(filepath.getParentDir()),
     mFilepath(filepath), mLock(filepath.getParentDir()), mIsRestored(false),
     mIsReadOnly(readOnly)
@@ -103,7 +114,11 @@ Project::Project(const FilePath& filepath, bool create, bool readOnly) :
             break;
         }
         case DirectoryLock::LockStatus::Locked: {
-            if (!mIsReadOnly) {
+            if ((!mIsReadOnly) && (!interactive)) {
+                throw RuntimeError(__FILE__, __LINE__, QString(tr(
+                    "The project is already opened by another application instance or "
+                    "user: %1")).arg(mFilepath.toNative()));
+            } else if (!mIsReadOnly) {
                 // the project is locked by another application instance! open read only?
                 QMessageBox::StandardButton btn = QMessageBox::question(0, tr("Open Read-Only?"),
                     tr("The project is already opened by another application instance or user. "
@@ -121,6 +136,16 @@ Project::Project(const FilePath& filepath, bool create, bool readOnly) :
             break;
         }
         case DirectoryLock::LockStatus::StaleLock: {
+            if (!interactive) {
+                if (!mIsReadOnly) {
+                    throw RuntimeError(__FILE__, __LINE__, QString(tr(
+                        "The project was not closed properly, open it with the graphical "
+                        "user interface to restore the last backup: %1"))
+                        .arg(mFilepath.toNative()));
+                }
+                // in read-only mode, just open the project without restoring the backup
+                break;
+            }
             // the application crashed while this project was open! ask the user what to do
             QMessageBox::StandardButton btn = QMessageBox::question(0, tr("Restore Project?"),
                 tr("It seems that the application was crashed while this project was open. "
@@ -190,6 +215,25 @@ Project::Project(const FilePath& filepath, bool create, bool readOnly) :
         }
         mStrokeFontPool.reset(new StrokeFontPool(fontobeneDir));
 
+        // Open the schematic and board list files and start parsing all schematic and
+        // board files in worker threads, so they are parsed in parallel to each other
+        // and to the loading of the library and the circuit
+        FilePath schematicsFilepath = mPath.getPathTo("core/schematics.lp");
+        FilePath boardsFilepath = mPath.getPathTo("core/boards.lp");
+        QList<QPair<FilePath, QFuture<ParsedFile>>> schematicFiles;
+        QList<QPair<FilePath, QFuture<ParsedFile>>> boardFiles;
+        if (create) {
+            mSchematicsFile.reset(SmartSExprFile::create(schematicsFilepath));
+            mBoardsFile.reset(SmartSExprFile::create(boardsFilepath));
+        } else {
+            mSchematicsFile.reset(new SmartSExprFile(schematicsFilepath, mIsRestored, mIsReadOnly));
+            schematicFiles = parseFilesInBackground(
+                mSchematicsFile->parseFileAndBuildDomTree(), "schematic");
+            mBoardsFile.reset(new SmartSExprFile(boardsFilepath, mIsRestored, mIsReadOnly));
+            boardFiles = parseFilesInBackground(
+                mBoardsFile->parseFileAndBuildDomTree(), "board");
+        }
+
         // Create all needed objects
         mProjectMetadata.reset(new ProjectMetadata(*this, mIsRestored, mIsReadOnly, create));
         connect(mProjectMetadata.data(), &ProjectMetadata::attributesChanged,
@@ -202,35 +246,25 @@ Project::Project(const FilePath& filepath, bool create, bool readOnly) :
         // Load all schematic layers
         mSchematicLayerProvider.reset(new SchematicLayerProvider(*this));
 
-        // Load all schematics
-        FilePath schematicsFilepath = mPath.getPathTo("core/schematics.lp");
-        if (create) {
-            mSchematicsFile.reset(SmartSExprFile::create(schematicsFilepath));
-        } else {
-            mSchematicsFile.reset(new SmartSExprFile(schematicsFilepath, mIsRestored, mIsReadOnly));
-            SExpression schRoot = mSchematicsFile->parseFileAndBuildDomTree();
-            foreach (const SExpression& node, schRoot.getChildren("schematic")) {
-                FilePath fp = FilePath::fromRelative(mPath, node.getValueOfFirstChild<QString>(true));
-                Schematic* schematic = new Schematic(*this, fp, mIsRestored, mIsReadOnly);
-                addSchematic(*schematic);
-            }
-            qDebug() << mSchematics.count() << "schematics successfully loaded!";
+        // Load all schematics (from the DOM trees parsed in the background)
+        for (int i = 0; i < schematicFiles.count(); ++i) {
+            const FilePath& fp = schematicFiles.at(i).first;
+            ParsedFile file = schematicFiles.at(i).second.result(); // can throw
+            Schematic* schematic = new Schematic(*this, fp, mIsRestored, mIsReadOnly,
+                                                 file.root, file.content);
+            addSchematic(*schematic);
         }
-
-        // Load all boards
-        FilePath boardsFilepath = mPath.getPathTo("core/boards.lp");
-        if (create) {
-            mBoardsFile.reset(SmartSExprFile::create(boardsFilepath));
-        } else {
-            mBoardsFile.reset(new SmartSExprFile(boardsFilepath, mIsRestored, mIsReadOnly));
-            SExpression brdRoot = mBoardsFile->parseFileAndBuildDomTree();
-            foreach (const SExpression& node, brdRoot.getChildren("board")) {
-                FilePath fp = FilePath::fromRelative(mPath, node.getValueOfFirstChild<QString>(true));
-                Board* board = new Board(*this, fp, mIsRestored, mIsReadOnly);
-                addBoard(*board);
-            }
-            qDebug() << mBoards.count() << "boards successfully loaded!";
+        if (!create) qDebug() << mSchematics.count() << "schematics successfully loaded!";
+
+        // Load all boards (from the DOM trees parsed in the background)
+        for (int i = 0; i < boardFiles.count(); ++i) {
+            const FilePath& fp = boardFiles.at(i).first;
+            ParsedFile file = boardFiles.at(i).second.result(); // can throw
+            Board* board = new Board(*this, fp, mIsRestored, mIsReadOnly,
+                                     file.root, file.content);
+            addBoard(*board);
         }
+        if (!create) qDebug() << mBoards.count() << "boards successfully loaded!";
 
         // at this point, the whole circuit with all schematics and boards is successfully
         // loaded, so the ERC list now contains all the correct ERC messages.
@@ -257,6 +291,9 @@ Project::Project(const FilePath& filepath, bool create, bool readOnly) :
 
 Project::~Project() noexcept
 {
+    // the files must not be written anymore when they are destroyed
+    mBackgroundSave.waitForFinished();
+
     // free the allocated memory in the reverse order of their allocation
 
     // delete all boards and schematics (and catch all throwed exceptions)
@@ -386,8 +423,6 @@ void Project::exportSchematicsAsPdf(const FilePath& filepath)
         pages.append(i);
 
     printSchematicPages(printer, pages);
-
-    QDesktopServices::openUrl(QUrl::fromLocalFile(filepath.toStr()));
 }
 
 /*****************************************************************************************
@@ -517,6 +552,43 @@ void Project::save(bool toOriginal)
     Q_ASSERT(errors.isEmpty());
 }
 
+QFuture<QStringList> Project::saveTemporaryFilesInBackground() noexcept
+{
+    mBackgroundSave.waitForFinished(); // do not write the same files concurrently
+
+    QStringList errors;
+    QList<std::function<void()>> writers;
+    QSharedPointer<FileSaveTransaction> transaction(new FileSaveTransaction());
+    {
+        FileSaveTransaction::Scope scope(*transaction);
+        prepareSave(false, errors, writers);
+    }
+    mBackgroundSave = QtConcurrent::run([errors, writers, transaction](){
+        QStringList allErrors = errors;
+        FileSaveTransaction::Scope scope(*transaction);
+        foreach (const std::function<void()>& writer, writers) {
+            try {
+                writer(); // can throw
+            } catch (const Exception& e) {
+                allErrors.append(e.getMsg());
+            }
+        }
+        if (allErrors.isEmpty()) {
+            try {
+                transaction->commit(); // can throw
+            } catch (const Exception& e) {
+                allErrors.append(e.getMsg()); // already rolled back
+            }
+        } else {
+            // remove the temporary files now instead of whenever the last reference to
+            // the transaction is released
+            transaction->rollback();
+        }
+        return allErrors;
+    });
+    return mBackgroundSave;
+}
+
 /*****************************************************************************************
  *  Inherited from AttributeProvider
  ****************************************************************************************/
@@ -601,6 +673,57 @@ Version Project::getProjectFileFormatVersion(const FilePath& dir)
  ****************************************************************************************/
 
 bool Project::save(bool toOriginal, QStringList& errors) noexcept
+{
+    mBackgroundSave.waitForFinished(); // do not write the same files concurrently
+
+    // All files are written (or removed) within a transaction, i.e. they are modified
+    // only if all of them were written successfully. The big schematic/board files are
+    // written in parallel. Note that the project library is not part of the transaction.
+    FileSaveTransaction transaction;
+    QList<std::function<void()>> writers;
+    bool success;
+    {
+        FileSaveTransaction::Scope scope(transaction);
+        success = prepareSave(toOriginal, errors, writers);
+    }
+    QList<QFuture<QString>> futures;
+    foreach (const std::function<void()>& writer, writers) {
+        futures.append(QtConcurrent::run([&transaction, writer]() -> QString {
+            FileSaveTransaction::Scope scope(transaction);
+            try {
+                writer(); // can throw
+            } catch (const Exception& e) {
+                return e.getMsg();
+            }
+            return QString();
+        }));
+    }
+    for (int i = 0; i < futures.count(); ++i) {
+        QString error = futures[i].result();
+        if (!error.isEmpty()) {
+            success = false;
+            errors.append(error);
+        }
+    }
+    if (success) {
+        try {
+            transaction.commit(); // can throw
+        } catch (const Exception& e) {
+            success = false;
+            errors.append(e.getMsg());
+        }
+    }
+
+    // if the project was restored from a backup, reset the mIsRestored flag as the current
+    // state of the project is no longer a restored backup but a properly saved project
+    if (mIsRestored && success && toOriginal)
+        mIsRestored = false;
+
+    return success;
+}
+
+bool Project::prepareSave(bool toOriginal, QStringList& errors,
+                          QList<std::function<void()>>& writers) noexcept
 {
     bool success = true;
 
@@ -658,34 +781,28 @@ bool Project::save(bool toOriginal, QStringList& errors) noexcept
     if (!mProjectMetadata->save(toOriginal, errors))
         success = false;
 
-    // Save circuit
-    if (!mCircuit->save(toOriginal, errors))
+    // Serialize circuit, all schematics and all boards (removed ones to remove the files)
+    try {
+        writers.append(mCircuit->prepareSave(toOriginal)); // can throw
+    } catch (const Exception& e) {
         success = false;
-
-    // Save all removed schematics (*.lp files)
-    foreach (Schematic* schematic, mRemovedSchematics)
-    {
-        if (!schematic->save(toOriginal, errors))
-            success = false;
-    }
-    // Save all added schematics (*.lp files)
-    foreach (Schematic* schematic, mSchematics)
-    {
-        if (!schematic->save(toOriginal, errors))
-            success = false;
+        errors.append(e.getMsg());
     }
-
-    // Save all removed boards (*.lp files)
-    foreach (Board* board, mRemovedBoards)
-    {
-        if (!board->save(toOriginal, errors))
+    foreach (Schematic* schematic, mRemovedSchematics + mSchematics) {
+        try {
+            writers.append(schematic->prepareSave(toOriginal)); // can throw
+        } catch (const Exception& e) {
             success = false;
+            errors.append(e.getMsg());
+        }
     }
-    // Save all added boards (*.lp files)
-    foreach (Board* board, mBoards)
-    {
-        if (!board->save(toOriginal, errors))
+    foreach (Board* board, mRemovedBoards + mBoards) {
+        try {
+            writers.append(board->prepareSave(toOriginal)); // can throw
+        } catch (const Exception& e) {
             success = false;
+            errors.append(e.getMsg());
+        }
     }
 
     // Save library
@@ -700,11 +817,6 @@ bool Project::save(bool toOriginal, QStringList& errors) noexcept
     if (!mErcMsgList->save(toOriginal, errors))
         success = false;
 
-    // if the project was restored from a backup, reset the mIsRestored flag as the current
-    // state of the project is no longer a restored backup but a properly saved project
-    if (mIsRestored && success && toOriginal)
-        mIsRestored = false;
-
     // update the "last modified datetime" attribute of the project
     mProjectMetadata->updateLastModified();
 
@@ -740,6 +852,27 @@ void Project::printSchematicPages(QPrinter& printer, QList<int>& pages)
     }
 }
 
+QList<QPair<FilePath, QFuture<Project::ParsedFile>>> Project::parseFilesInBackground(
+    const SExpression& listRoot, const QString& childName) const
+{
+    QList<QPair<FilePath, QFuture<ParsedFile>>> files;
+    foreach (const SExpression& node, listRoot.getChildren(childName)) {
+        FilePath fp = FilePath::fromRelative(mPath, node.getValueOfFirstChild<QString>(true));
+        bool restore = mIsRestored;
+        // Note: The file is opened in read-only mode only to parse it, the constructors of
+        // the schematics/boards open the files again in the requested mode. The content
+        // is passed to them too, so they don't write unmodified files when saving.
+        QFuture<ParsedFile> future = QtConcurrent::run([fp, restore](){
+            ParsedFile file;
+            file.root = SmartSExprFile(fp, restore, true)
+                        .parseFileAndBuildDomTree(&file.content); // can throw
+            return file;
+        });
+        files.append(qMakePair(fp, future));
+    }
+    return files;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
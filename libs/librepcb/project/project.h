@@ -23,6 +23,7 @@
 /*****************************************************************************************
  *  Includes
  ****************************************************************************************/
+#include <functional>
 #include <QtCore>
 #include <librepcb/common/attributes/attributeprovider.h>
 #include <librepcb/common/exceptions.h>
@@ -38,6 +39,7 @@ class QPrinter;
 
 namespace librepcb {
 
+class SExpression;
 class SmartTextFile;
 class SmartSExprFile;
 class SmartVersionFile;
@@ -92,11 +94,16 @@ class Project final : public QObject, public AttributeProvider
          *
          * @param filepath      The filepath to the an existing *.lpp project file
          * @param readOnly      It true, the project will be opened in read-only mode
+         * @param interactive   If true, the user will be asked with message boxes what
+         *                      to do if the project is locked. If false (e.g. for
+         *                      command line tools), no message boxes will be shown:
+         *                      a locked project can then only be opened in read-only
+         *                      mode, and backups are never restored.
          *
          * @throw Exception     If the project could not be opened successfully
          */
-        Project(const FilePath& filepath, bool readOnly) :
-            Project(filepath, false, readOnly) {}
+        Project(const FilePath& filepath, bool readOnly, bool interactive = true) :
+            Project(filepath, false, readOnly, interactive) {}
 
         /**
          * @brief The destructor will close the whole project (without saving!)
@@ -378,6 +385,24 @@ class Project final : public QObject, public AttributeProvider
          */
         void save(bool toOriginal);
 
+        /**
+         * @brief Save the whole project to the temporary files in a worker thread
+         *
+         * Used for autosaving. All schematics, boards and the circuit are serialized
+         * immediately, so the project can be modified right after calling this method.
+         * Only converting them to text and writing the files is done in a worker thread.
+         * All files are written within one librepcb::FileSaveTransaction which is
+         * committed (or rolled back) in the worker thread, so the temporary files are
+         * only replaced if all of them were written successfully.
+         *
+         * @note If a previous background save is still running, this method waits until
+         *       it is finished. The same applies to #save() and the destructor.
+         *
+         * @return A future which contains all errors (translated), or an empty list on
+         *         success
+         */
+        QFuture<QStringList> saveTemporaryFilesInBackground() noexcept;
+
 
         // Inherited from AttributeProvider
         /// @copydoc librepcb::AttributeProvider::getUserDefinedAttributeValue()
@@ -394,7 +419,7 @@ class Project final : public QObject, public AttributeProvider
         // Static Methods
 
         static Project* create(const FilePath& filepath)
-        {return new Project(filepath, true, false);}
+        {return new Project(filepath, true, false, true);}
 
         static bool isFilePathInsideProjectDirectory(const FilePath& fp) noexcept;
         static bool isProjectFile(const FilePath& file) noexcept;
@@ -438,6 +463,12 @@ class Project final : public QObject, public AttributeProvider
 
     private:
 
+        // Types
+
+        /// @brief The DOM tree and the raw content of a file parsed in the background
+        struct ParsedFile;
+
+
         // Private Methods
 
         /**
@@ -447,10 +478,12 @@ class Project final : public QObject, public AttributeProvider
          * @param create        True if the specified project does not exist already and
          *                      must be created.
          * @param readOnly      If true, the project will be opened in read-only mode
+         * @param interactive   See #Project(const FilePath&, bool, bool)
          *
          * @throw Exception     If the project could not be created/opened successfully
          */
-        explicit Project(const FilePath& filepath, bool create, bool readOnly);
+        explicit Project(const FilePath& filepath, bool create, bool readOnly,
+                         bool interactive);
 
         /**
          * @brief Save the project to the harddisc (to temporary or original files)
@@ -458,10 +491,29 @@ class Project final : public QObject, public AttributeProvider
          * @param toOriginal    True: save to original files; False: save to temporary files
          * @param errors        All errors will be added to this string list (translated)
          *
+         * All files are written (or removed) within one librepcb::FileSaveTransaction,
+         * i.e. they are only modified if all of them were written successfully. The
+         * directories of the project library elements are not part of the transaction,
+         * and if the commit itself fails, already replaced files are not restored.
+         *
          * @return True on success (then the error list should be empty), false otherwise
          */
         bool save(bool toOriginal, QStringList& errors) noexcept;
 
+        /**
+         * @brief Save all small files and serialize the big ones (see #save())
+         *
+         * @param toOriginal    True: save to original files; False: save to temporary files
+         * @param errors        All errors will be added to this string list (translated)
+         * @param writers       Functions to write the serialized schematics, boards and
+         *                      circuit will be appended to this list. They can be called
+         *                      from any thread, but must be called before the next save.
+         *
+         * @return True on success (then the error list should be empty), false otherwise
+         */
+        bool prepareSave(bool toOriginal, QStringList& errors,
+                         QList<std::function<void()>>& writers) noexcept;
+
         /**
          * @brief Print some schematics to a QPrinter (printer or file)
          *
@@ -472,6 +524,24 @@ class Project final : public QObject, public AttributeProvider
          */
         void printSchematicPages(QPrinter& printer, QList<int>& pages);
 
+        /**
+         * @brief Start parsing all files listed in a schematics/boards list file
+         *
+         * Each file is read and parsed in a worker thread of the global thread pool, so
+         * multiple files are parsed in parallel. Exceptions thrown while parsing are
+         * rethrown by QFuture::result().
+         *
+         * @param listRoot      The DOM tree of "core/schematics.lp" or "core/boards.lp"
+         * @param childName     The name of the child nodes ("schematic" or "board")
+         *
+         * @return The filepath and the future DOM tree (and content) of each file (in
+         *         the same order as listed in the list file)
+         *
+         * @throw Exception     If the list file contains invalid entries
+         */
+        QList<QPair<FilePath, QFuture<ParsedFile>>> parseFilesInBackground(
+            const SExpression& listRoot, const QString& childName) const;
+
 
         // Project File (*.lpp)
         FilePath mPath; ///< the path to the project directory
@@ -481,6 +551,7 @@ class Project final : public QObject, public AttributeProvider
         DirectoryLock mLock; ///< Lock for the whole project directory (see @ref doc_project_lock)
         bool mIsRestored; ///< the constructor will set this to true if the project was restored
         bool mIsReadOnly; ///< the constructor will set this to true if the project was opened in read only mode
+        QFuture<QStringList> mBackgroundSave; ///< see #saveTemporaryFilesInBackground()
 
         // schematic and board list files
         QScopedPointer<SmartSExprFile> mSchematicsFile; ///< core/schematics.lp
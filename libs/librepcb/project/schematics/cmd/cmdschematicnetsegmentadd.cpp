@@ -53,6 +53,16 @@ CmdSchematicNetSegmentAdd::~CmdSchematicNetSegmentAdd() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdSchematicNetSegmentAdd::getApproxMemoryUsage() const noexcept
+{
+    return UndoCommand::getApproxMemoryUsage() + sizeof(*this) - sizeof(UndoCommand) +
+           (mNetSegment ? mNetSegment->getApproxMemoryUsage() : 0);
+}
+
 /*****************************************************************************************
  *  Inherited from UndoCommand
  ****************************************************************************************/
@@ -53,6 +53,8 @@ class CmdSchematicNetSegmentAdd final : public UndoCommand
         ~CmdSchematicNetSegmentAdd() noexcept;
 
         // Getters
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
         SI_NetSegment* getNetSegment() const noexcept {return mNetSegment;}
 
 
@@ -46,6 +46,16 @@ CmdSchematicNetSegmentAddElements::~CmdSchematicNetSegmentAddElements() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdSchematicNetSegmentAddElements::getApproxMemoryUsage() const noexcept
+{
+    return UndoCommand::getApproxMemoryUsage() + sizeof(*this) - sizeof(UndoCommand) +
+           (mNetPoints.count() * sizeof(SI_NetPoint)) + (mNetLines.count() * sizeof(SI_NetLine));
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -54,6 +54,10 @@ class CmdSchematicNetSegmentAddElements final : public UndoCommand
         CmdSchematicNetSegmentAddElements(SI_NetSegment& segment) noexcept;
         ~CmdSchematicNetSegmentAddElements() noexcept;
 
+        // Getters
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
+
         // General Methods
         SI_NetPoint* addNetPoint(SI_NetPoint& netpoint);
         SI_NetPoint* addNetPoint(const Point& position);
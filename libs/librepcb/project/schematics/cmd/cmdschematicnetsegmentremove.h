@@ -50,6 +50,10 @@ class CmdSchematicNetSegmentRemove final : public UndoCommand
         explicit CmdSchematicNetSegmentRemove(SI_NetSegment& segment) noexcept;
         ~CmdSchematicNetSegmentRemove() noexcept;
 
+        // Getters
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
+
 
     private:
 
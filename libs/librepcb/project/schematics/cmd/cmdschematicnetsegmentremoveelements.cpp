@@ -47,6 +47,16 @@ CmdSchematicNetSegmentRemoveElements::~CmdSchematicNetSegmentRemoveElements() no
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdSchematicNetSegmentRemoveElements::getApproxMemoryUsage() const noexcept
+{
+    return UndoCommand::getApproxMemoryUsage() + sizeof(*this) - sizeof(UndoCommand) +
+           (mNetPoints.count() * sizeof(SI_NetPoint)) + (mNetLines.count() * sizeof(SI_NetLine));
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
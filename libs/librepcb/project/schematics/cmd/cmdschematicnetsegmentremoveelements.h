@@ -51,6 +51,10 @@ class CmdSchematicNetSegmentRemoveElements final : public UndoCommand
         CmdSchematicNetSegmentRemoveElements(SI_NetSegment& segment) noexcept;
         ~CmdSchematicNetSegmentRemoveElements() noexcept;
 
+        // Getters
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
+
         // General Methods
         void removeNetPoint(SI_NetPoint& netpoint);
         void removeNetLine(SI_NetLine& netline);
@@ -57,6 +57,16 @@ CmdSymbolInstanceAdd::~CmdSymbolInstanceAdd() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdSymbolInstanceAdd::getApproxMemoryUsage() const noexcept
+{
+    return UndoCommand::getApproxMemoryUsage() + sizeof(*this) - sizeof(UndoCommand) +
+           (mSymbolInstance ? mSymbolInstance->getApproxMemoryUsage() : 0);
+}
+
 /*****************************************************************************************
  *  Inherited from UndoCommand
  ****************************************************************************************/
@@ -57,6 +57,8 @@ class CmdSymbolInstanceAdd final : public UndoCommand
         ~CmdSymbolInstanceAdd() noexcept;
 
         // Getters
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
         SI_Symbol* getSymbolInstance() const noexcept {return mSymbolInstance;}
 
 
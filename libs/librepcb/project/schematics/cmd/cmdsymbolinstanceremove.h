@@ -50,6 +50,10 @@ class CmdSymbolInstanceRemove final : public UndoCommand
         CmdSymbolInstanceRemove(Schematic& schematic, SI_Symbol& symbol) noexcept;
         ~CmdSymbolInstanceRemove() noexcept;
 
+        // Getters
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
+
 
     private:
 
@@ -77,11 +77,33 @@ void SGI_Symbol::updateCacheAndRepaint() noexcept
     mShape.addRect(crossRect);
 
     // polygons
+    mBatches.clear();
     for (const Polygon& polygon : mLibSymbol.getPolygons()) {
         QPainterPath polygonPath = polygon.getPath().toQPainterPathPx();
         qreal w = polygon.getLineWidth().toPx() / 2;
         mBoundingRect = mBoundingRect.united(polygonPath.boundingRect().adjusted(-w, -w, w, w));
         if (polygon.isGrabArea()) mShape = mShape.united(polygonPath);
+        GraphicsLayer* fillLayer = nullptr;
+        if (polygon.isFilled())
+            fillLayer = getLayer(polygon.getLayerName());
+        else if (polygon.isGrabArea())
+            fillLayer = getLayer(GraphicsLayer::sSymbolGrabAreas);
+        addToBatch(getLayer(polygon.getLayerName()), polygon.getLineWidth().toPx(), fillLayer,
+                   polygonPath);
+    }
+
+    // ellipses
+    for (const Ellipse& ellipse : mLibSymbol.getEllipses()) {
+        QPainterPath ellipsePath; // TODO: rotation
+        ellipsePath.addEllipse(ellipse.getCenter().toPxQPointF(), ellipse.getRadiusX().toPx(),
+                               ellipse.getRadiusY().toPx());
+        GraphicsLayer* fillLayer = nullptr;
+        if (ellipse.isFilled())
+            fillLayer = getLayer(ellipse.getLayerName());
+        else if (ellipse.isGrabArea())
+            fillLayer = getLayer(GraphicsLayer::sSymbolGrabAreas);
+        addToBatch(getLayer(ellipse.getLayerName()), ellipse.getLineWidth().toPx(), fillLayer,
+                   ellipsePath);
     }
 
     // texts
@@ -147,50 +169,21 @@ void SGI_Symbol::paint(QPainter* painter, const QStyleOptionGraphicsItem* option
     const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
     const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
 
-    // draw all polygons
-    for (const Polygon& polygon : mLibSymbol.getPolygons()) {
+    // draw all polygons and ellipses (in their original order)
+    foreach (const LayerBatch& batch, mBatches) {
         // set colors
-        layer = getLayer(polygon.getLayerName());
+        layer = batch.layer;
         if (layer) {if (!layer->isVisible()) layer = nullptr;}
         if (layer)
-            painter->setPen(QPen(layer->getColor(selected), polygon.getLineWidth().toPx(), Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
+            painter->setPen(QPen(layer->getColor(selected), batch.penWidth, Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
         else
             painter->setPen(Qt::NoPen);
-        if (polygon.isFilled())
-            layer = getLayer(polygon.getLayerName());
-        else if (polygon.isGrabArea())
-            layer = getLayer(GraphicsLayer::sSymbolGrabAreas);
-        else
-            layer = nullptr;
+        layer = batch.fillLayer;
         if (layer) {if (!layer->isVisible()) layer = nullptr;}
         painter->setBrush(layer ? QBrush(layer->getColor(selected), Qt::SolidPattern) : Qt::NoBrush);
 
-        // draw polygon
-        painter->drawPath(polygon.getPath().toQPainterPathPx());
-    }
-
-    // draw all ellipses
-    for (const Ellipse& ellipse : mLibSymbol.getEllipses()) {
-        // set colors
-        layer = getLayer(ellipse.getLayerName());
-        if (layer) {if (!layer->isVisible()) layer = nullptr;}
-        if (layer)
-            painter->setPen(QPen(layer->getColor(selected), ellipse.getLineWidth().toPx(), Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
-        else
-            painter->setPen(Qt::NoPen);
-        if (ellipse.isFilled())
-            layer = getLayer(ellipse.getLayerName());
-        else if (ellipse.isGrabArea())
-            layer = getLayer(GraphicsLayer::sSymbolGrabAreas);
-        else
-            layer = nullptr;
-        if (layer) {if (!layer->isVisible()) layer = nullptr;}
-        painter->setBrush(layer ? QBrush(layer->getColor(selected), Qt::SolidPattern) : Qt::NoBrush);
-
-        // draw ellipse
-        painter->drawEllipse(ellipse.getCenter().toPxQPointF(), ellipse.getRadiusX().toPx(),
-                             ellipse.getRadiusY().toPx());
-        // TODO: rotation
+        // draw primitives
+        painter->drawPath(batch.path);
     }
 
     // draw all texts
@@ -282,6 +275,28 @@ GraphicsLayer* SGI_Symbol::getLayer(const QString& name) const noexcept
     return mSymbol.getProject().getLayers().getLayer(name);
 }
 
+void SGI_Symbol::addToBatch(GraphicsLayer* layer, qreal penWidth, GraphicsLayer* fillLayer,
+                            const QPainterPath& path) noexcept
+{
+    // Only merge with the previous batch to keep the drawing order. Filled primitives
+    // are only merged if they don't overlap, otherwise the result would change.
+    if (!mBatches.isEmpty()) {
+        LayerBatch& batch = mBatches.last();
+        if ((batch.layer == layer) && (batch.penWidth == penWidth) &&
+            (batch.fillLayer == fillLayer) && (batch.path.fillRule() == path.fillRule()))
+        {
+            qreal w = penWidth / 2;
+            if ((!fillLayer) || (!batch.path.boundingRect().adjusted(-w, -w, w, w)
+                                 .intersects(path.boundingRect().adjusted(-w, -w, w, w))))
+            {
+                batch.path.addPath(path);
+                return;
+            }
+        }
+    }
+    mBatches.append(LayerBatch{layer, penWidth, fillLayer, path});
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -80,6 +80,8 @@ class SGI_Symbol final : public SGI_Base
 
         // Private Methods
         GraphicsLayer* getLayer(const QString& name) const noexcept;
+        void addToBatch(GraphicsLayer* layer, qreal penWidth, GraphicsLayer* fillLayer,
+                        const QPainterPath& path) noexcept;
 
 
         // Types
@@ -93,6 +95,13 @@ class SGI_Symbol final : public SGI_Base
             QRectF textRect;    // not scaled
         };
 
+        struct LayerBatch {
+            GraphicsLayer* layer;       // layer of the outline (may be nullptr)
+            qreal penWidth;
+            GraphicsLayer* fillLayer;   // nullptr if the primitives are not filled
+            QPainterPath path;  // consecutive primitives with the same pen and brush
+        };
+
 
         // General Attributes
         SI_Symbol& mSymbol;
@@ -103,6 +112,7 @@ class SGI_Symbol final : public SGI_Base
         QRectF mBoundingRect;
         QPainterPath mShape;
         QHash<const Text*, CachedTextProperties_t> mCachedTextProperties;
+        QVector<LayerBatch> mBatches;
 };
 
 /*****************************************************************************************
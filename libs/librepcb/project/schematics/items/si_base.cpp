@@ -93,6 +93,14 @@ void SI_Base::removeFromSchematic(SGI_Base* item) noexcept
     mIsAddedToSchematic = false;
 }
 
+void SI_Base::addCreatedGraphicsItem(SGI_Base& item) noexcept
+{
+    // items which are not added to the schematic will add it in addToSchematic() later
+    if (mIsAddedToSchematic) {
+        mSchematic.getGraphicsScene().addItem(item);
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
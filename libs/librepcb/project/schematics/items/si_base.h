@@ -87,6 +87,15 @@ class SI_Base : public QObject
         virtual void addToSchematic() = 0;
         virtual void removeFromSchematic() = 0;
 
+        /**
+         * @brief Create the graphics items of this item and all its child items
+         *
+         * Like for board items, graphics items are created lazily as soon as the
+         * schematic gets a graphics scene (see librepcb::project::Schematic::showInView()).
+         * Does nothing if they already exist or if there is no graphics scene yet.
+         */
+        virtual void createGraphicsItems() noexcept = 0;
+
         // Operator Overloadings
         SI_Base& operator=(const SI_Base& rhs) = delete;
 
@@ -96,6 +105,7 @@ class SI_Base : public QObject
         // General Methods
         void addToSchematic(SGI_Base* item) noexcept;
         void removeFromSchematic(SGI_Base* item) noexcept;
+        void addCreatedGraphicsItem(SGI_Base& item) noexcept;
 
 
     protected:
@@ -61,11 +61,6 @@ SI_NetLabel::SI_NetLabel(SI_NetSegment& segment, const Point& position) :
 
 void SI_NetLabel::init()
 {
-    // create the graphics item
-    mGraphicsItem.reset(new SGI_NetLabel(*this));
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
-    mGraphicsItem->setRotation(-mRotation.toDeg());
-
     if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
 }
 
@@ -91,7 +86,7 @@ void SI_NetLabel::setPosition(const Point& position) noexcept
 {
     if (position != mPosition) {
         mPosition = position;
-        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        if (mGraphicsItem) mGraphicsItem->setPos(mPosition.toPxQPointF());
         updateAnchor();
     }
 }
@@ -100,8 +95,10 @@ void SI_NetLabel::setRotation(const Angle& rotation) noexcept
 {
     if (rotation != mRotation) {
         mRotation = rotation;
-        mGraphicsItem->setRotation(-mRotation.toDeg());
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) {
+            mGraphicsItem->setRotation(-mRotation.toDeg());
+            mGraphicsItem->updateCacheAndRepaint();
+        }
         updateAnchor();
     }
 }
@@ -112,7 +109,7 @@ void SI_NetLabel::setRotation(const Angle& rotation) noexcept
 
 void SI_NetLabel::updateAnchor() noexcept
 {
-    mGraphicsItem->setAnchor(mNetSegment.calcNearestPoint(mPosition));
+    if (mGraphicsItem) mGraphicsItem->setAnchor(mNetSegment.calcNearestPoint(mPosition));
 }
 
 void SI_NetLabel::addToSchematic()
@@ -120,11 +117,12 @@ void SI_NetLabel::addToSchematic()
     if (isAddedToSchematic()) {
         throw LogicError(__FILE__, __LINE__);
     }
+    createGraphicsItems();
     mHighlightChangedConnection = connect(&getNetSignalOfNetSegment(),
                                           &NetSignal::highlightedChanged,
-                                          [this](){mGraphicsItem->update();});
+                                          [this](){if (mGraphicsItem) mGraphicsItem->update();});
     SI_Base::addToSchematic(mGraphicsItem.data());
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     updateAnchor();
 }
 
@@ -137,6 +135,18 @@ void SI_NetLabel::removeFromSchematic()
     SI_Base::removeFromSchematic(mGraphicsItem.data());
 }
 
+void SI_NetLabel::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem || (!mSchematic.hasGraphicsScene())) {
+        return;
+    }
+    mGraphicsItem.reset(new SGI_NetLabel(*this));
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    mGraphicsItem->setRotation(-mRotation.toDeg());
+    updateAnchor();
+    addCreatedGraphicsItem(*mGraphicsItem);
+}
+
 void SI_NetLabel::serialize(SExpression& root) const
 {
     if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
@@ -152,13 +162,14 @@ void SI_NetLabel::serialize(SExpression& root) const
 
 QPainterPath SI_NetLabel::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
 void SI_NetLabel::setSelected(bool selected) noexcept
 {
     SI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
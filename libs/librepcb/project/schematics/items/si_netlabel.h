@@ -73,6 +73,7 @@ class SI_NetLabel final : public SI_Base, public SerializableObject
         void updateAnchor() noexcept;
         void addToSchematic() override;
         void removeFromSchematic() override;
+        void createGraphicsItems() noexcept override;
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
@@ -95,7 +95,6 @@ void SI_NetLine::init()
             tr("SI_NetLine: both endpoints are the same."));
     }
 
-    mGraphicsItem.reset(new SGI_NetLine(*this));
     updateLine();
 
     if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
@@ -147,7 +146,7 @@ void SI_NetLine::setWidth(const Length& width) noexcept
     Q_ASSERT(width >= 0);
     if ((width != mWidth) && (width >= 0)) {
         mWidth = width;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     }
 }
 
@@ -165,9 +164,10 @@ void SI_NetLine::addToSchematic()
     auto sg = scopeGuard([&](){mStartPoint->unregisterNetLine(*this);});
     mEndPoint->registerNetLine(*this); // can throw
 
+    createGraphicsItems();
     mHighlightChangedConnection = connect(&getNetSignalOfNetSegment(),
                                           &NetSignal::highlightedChanged,
-                                          [this](){mGraphicsItem->update();});
+                                          [this](){if (mGraphicsItem) mGraphicsItem->update();});
     SI_Base::addToSchematic(mGraphicsItem.data());
     sg.dismiss();
 }
@@ -187,10 +187,19 @@ void SI_NetLine::removeFromSchematic()
     sg.dismiss();
 }
 
+void SI_NetLine::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem || (!mSchematic.hasGraphicsScene())) {
+        return;
+    }
+    mGraphicsItem.reset(new SGI_NetLine(*this));
+    addCreatedGraphicsItem(*mGraphicsItem);
+}
+
 void SI_NetLine::updateLine() noexcept
 {
     mPosition = (mStartPoint->getPosition() + mEndPoint->getPosition()) / 2;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void SI_NetLine::serialize(SExpression& root) const
@@ -209,13 +218,14 @@ void SI_NetLine::serialize(SExpression& root) const
 
 QPainterPath SI_NetLine::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->shape();
 }
 
 void SI_NetLine::setSelected(bool selected) noexcept
 {
     SI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
@@ -75,6 +75,7 @@ class SI_NetLine final : public SI_Base, public SerializableObject
         // General Methods
         void addToSchematic() override;
         void removeFromSchematic() override;
+        void createGraphicsItems() noexcept override;
         void updateLine() noexcept;
 
         /// @copydoc librepcb::SerializableObject::serialize()
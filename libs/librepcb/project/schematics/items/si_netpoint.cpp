@@ -94,10 +94,6 @@ SI_NetPoint::SI_NetPoint(SI_NetSegment& segment, SI_SymbolPin& pin) :
 
 void SI_NetPoint::init()
 {
-    // create the graphics item
-    mGraphicsItem.reset(new SGI_NetPoint(*this));
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
-
     // create ERC messages
     mErcMsgDeadNetPoint.reset(new ErcMsg(mSchematic.getProject(), *this,
         mUuid.toStr(), "Dead", ErcMsg::ErcMsgType_t::SchematicError,
@@ -168,14 +164,14 @@ void SI_NetPoint::setPinToAttach(SI_SymbolPin* pin)
         sgl.dismiss();
     }
     mSymbolPin = pin;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void SI_NetPoint::setPosition(const Point& position) noexcept
 {
     if (position != mPosition) {
         mPosition = position;
-        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        if (mGraphicsItem) mGraphicsItem->setPos(mPosition.toPxQPointF());
         updateLines();
     }
 }
@@ -198,11 +194,12 @@ void SI_NetPoint::addToSchematic()
         mSymbolPin->registerNetPoint(*this); // can throw
     }
 
+    createGraphicsItems();
     mHighlightChangedConnection = connect(&getNetSignalOfNetSegment(),
                                           &NetSignal::highlightedChanged,
-                                          [this](){mGraphicsItem->update();});
-    mErcMsgDeadNetPoint->setVisible(true);
+                                          [this](){if (mGraphicsItem) mGraphicsItem->update();});
     SI_Base::addToSchematic(mGraphicsItem.data());
+    updateErcMessages();
 }
 
 void SI_NetPoint::removeFromSchematic()
@@ -220,8 +217,18 @@ void SI_NetPoint::removeFromSchematic()
     }
 
     disconnect(mHighlightChangedConnection);
-    mErcMsgDeadNetPoint->setVisible(false);
     SI_Base::removeFromSchematic(mGraphicsItem.data());
+    updateErcMessages();
+}
+
+void SI_NetPoint::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem || (!mSchematic.hasGraphicsScene())) {
+        return;
+    }
+    mGraphicsItem.reset(new SGI_NetPoint(*this));
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    addCreatedGraphicsItem(*mGraphicsItem);
 }
 
 void SI_NetPoint::registerNetLine(SI_NetLine& netline)
@@ -233,8 +240,8 @@ void SI_NetPoint::registerNetLine(SI_NetLine& netline)
     }
     mRegisteredLines.append(&netline);
     netline.updateLine();
-    mGraphicsItem->updateCacheAndRepaint();
-    mErcMsgDeadNetPoint->setVisible(mRegisteredLines.isEmpty());
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+    updateErcMessages();
 }
 
 void SI_NetPoint::unregisterNetLine(SI_NetLine& netline)
@@ -244,8 +251,8 @@ void SI_NetPoint::unregisterNetLine(SI_NetLine& netline)
     }
     mRegisteredLines.removeOne(&netline);
     netline.updateLine();
-    mGraphicsItem->updateCacheAndRepaint();
-    mErcMsgDeadNetPoint->setVisible(mRegisteredLines.isEmpty());
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+    updateErcMessages();
 }
 
 void SI_NetPoint::updateLines() const noexcept
@@ -274,13 +281,14 @@ void SI_NetPoint::serialize(SExpression& root) const
 
 QPainterPath SI_NetPoint::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->shape().translated(mPosition.toPxQPointF());
 }
 
 void SI_NetPoint::setSelected(bool selected) noexcept
 {
     SI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
@@ -294,6 +302,11 @@ bool SI_NetPoint::checkAttributesValidity() const noexcept
     return true;
 }
 
+void SI_NetPoint::updateErcMessages() noexcept
+{
+    mErcMsgDeadNetPoint->setVisible(isAddedToSchematic() && mRegisteredLines.isEmpty());
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
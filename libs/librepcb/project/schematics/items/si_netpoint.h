@@ -85,6 +85,7 @@ class SI_NetPoint final : public SI_Base, public SerializableObject,
         // General Methods
         void addToSchematic() override;
         void removeFromSchematic() override;
+        void createGraphicsItems() noexcept override;
         void registerNetLine(SI_NetLine& netline);
         void unregisterNetLine(SI_NetLine& netline);
         void updateLines() const noexcept;
@@ -108,6 +109,7 @@ class SI_NetPoint final : public SI_Base, public SerializableObject,
     private:
 
         void init();
+        void updateErcMessages() noexcept override;
         bool checkAttributesValidity() const noexcept;
 
 
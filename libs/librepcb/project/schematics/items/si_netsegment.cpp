@@ -137,6 +137,13 @@ bool SI_NetSegment::isUsed() const noexcept
     return ((!mNetPoints.isEmpty()) || (!mNetLines.isEmpty()) || (!mNetLabels.isEmpty()));
 }
 
+qint64 SI_NetSegment::getApproxMemoryUsage() const noexcept
+{
+    return sizeof(*this) + (mNetPoints.count() * sizeof(SI_NetPoint)) +
+           (mNetLines.count() * sizeof(SI_NetLine)) +
+           (mNetLabels.count() * sizeof(SI_NetLabel));
+}
+
 int SI_NetSegment::getNetPointsAtScenePos(const Point& pos, QList<SI_NetPoint*>& points) const noexcept
 {
     int count = 0;
@@ -457,6 +464,19 @@ void SI_NetSegment::removeFromSchematic()
     sgl.dismiss();
 }
 
+void SI_NetSegment::createGraphicsItems() noexcept
+{
+    foreach (SI_NetPoint* netpoint, mNetPoints) {
+        netpoint->createGraphicsItems();
+    }
+    foreach (SI_NetLine* netline, mNetLines) {
+        netline->createGraphicsItems();
+    }
+    foreach (SI_NetLabel* netlabel, mNetLabels) {
+        netlabel->createGraphicsItems();
+    }
+}
+
 void SI_NetSegment::setSelectionRect(const QRectF rectPx) noexcept
 {
     foreach (SI_NetPoint* netpoint, mNetPoints)
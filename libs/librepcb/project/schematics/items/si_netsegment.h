@@ -72,6 +72,14 @@ class SI_NetSegment final : public SI_Base, public SerializableObject
         QString getForcedNetName() const noexcept;
         Point calcNearestPoint(const Point& p) const noexcept;
 
+        /**
+         * @brief Get the approximate amount of heap memory used by this net segment (including all its elements)
+         *
+         * Used by undo commands which keep removed items alive (see
+         * librepcb::UndoCommand::getApproxMemoryUsage()).
+         */
+        qint64 getApproxMemoryUsage() const noexcept;
+
         // Setters
         void setNetSignal(NetSignal& netsignal);
 
@@ -99,6 +107,7 @@ class SI_NetSegment final : public SI_Base, public SerializableObject
         // General Methods
         void addToSchematic() override;
         void removeFromSchematic() override;
+        void createGraphicsItems() noexcept override;
         void setSelectionRect(const QRectF rectPx) noexcept;
         void clearSelection() const noexcept;
 
@@ -84,10 +84,6 @@ void SI_Symbol::init(const Uuid& symbVarItemUuid)
             .arg(mSymbVarItem->getSymbolUuid().toStr()));
     }
 
-    mGraphicsItem.reset(new SGI_Symbol(*this));
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
-    mGraphicsItem->setRotation(-mRotation.toDeg());
-
     for (const library::SymbolPin& libPin : mSymbol->getPins()) {
         SI_SymbolPin* pin = new SI_SymbolPin(*this, libPin.getUuid()); // can throw
         if (mPins.contains(libPin.getUuid())) {
@@ -125,6 +121,11 @@ QString SI_Symbol::getName() const noexcept
     return mComponentInstance->getName() % mSymbVarItem->getSuffix();
 }
 
+qint64 SI_Symbol::getApproxMemoryUsage() const noexcept
+{
+    return sizeof(*this) + (mPins.count() * sizeof(SI_SymbolPin));
+}
+
 /*****************************************************************************************
  *  Setters
  ****************************************************************************************/
@@ -133,8 +134,10 @@ void SI_Symbol::setPosition(const Point& newPos) noexcept
 {
     if (newPos != mPosition) {
         mPosition = newPos;
-        mGraphicsItem->setPos(newPos.toPxQPointF());
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) {
+            mGraphicsItem->setPos(newPos.toPxQPointF());
+            mGraphicsItem->updateCacheAndRepaint();
+        }
         foreach (SI_SymbolPin* pin, mPins) {
             pin->updatePosition();
         }
@@ -145,8 +148,10 @@ void SI_Symbol::setRotation(const Angle& newRotation) noexcept
 {
     if (newRotation != mRotation) {
         mRotation = newRotation;
-        mGraphicsItem->setRotation(-newRotation.toDeg());
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) {
+            mGraphicsItem->setRotation(-newRotation.toDeg());
+            mGraphicsItem->updateCacheAndRepaint();
+        }
         foreach (SI_SymbolPin* pin, mPins) {
             pin->updatePosition();
         }
@@ -169,6 +174,7 @@ void SI_Symbol::addToSchematic()
         pin->addToSchematic(); // can throw
         sgl.add([pin](){pin->removeFromSchematic();});
     }
+    createGraphicsItems();
     SI_Base::addToSchematic(mGraphicsItem.data());
     sgl.dismiss();
 }
@@ -189,6 +195,20 @@ void SI_Symbol::removeFromSchematic()
     sgl.dismiss();
 }
 
+void SI_Symbol::createGraphicsItems() noexcept
+{
+    foreach (SI_SymbolPin* pin, mPins) {
+        pin->createGraphicsItems();
+    }
+    if (mGraphicsItem || (!mSchematic.hasGraphicsScene())) {
+        return;
+    }
+    mGraphicsItem.reset(new SGI_Symbol(*this));
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    mGraphicsItem->setRotation(-mRotation.toDeg());
+    addCreatedGraphicsItem(*mGraphicsItem);
+}
+
 void SI_Symbol::serialize(SExpression& root) const
 {
     if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
@@ -233,13 +253,14 @@ QVector<const AttributeProvider*> SI_Symbol::getAttributeProviderParents() const
 
 QPainterPath SI_Symbol::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
 void SI_Symbol::setSelected(bool selected) noexcept
 {
     SI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
     foreach (SI_SymbolPin* pin, mPins) {
         pin->setSelected(selected);
     }
@@ -251,7 +272,7 @@ void SI_Symbol::setSelected(bool selected) noexcept
 
 void SI_Symbol::schematicOrComponentAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 /*****************************************************************************************
@@ -81,6 +81,14 @@ class SI_Symbol final : public SI_Base, public SerializableObject,
         const library::Symbol& getLibSymbol() const noexcept {return *mSymbol;}
         const library::ComponentSymbolVariantItem& getCompSymbVarItem() const noexcept {return *mSymbVarItem;}
 
+        /**
+         * @brief Get the approximate amount of heap memory used by this symbol (including its pins)
+         *
+         * Used by undo commands which keep removed items alive (see
+         * librepcb::UndoCommand::getApproxMemoryUsage()).
+         */
+        qint64 getApproxMemoryUsage() const noexcept;
+
         // Setters
         void setPosition(const Point& newPos) noexcept;
         void setRotation(const Angle& newRotation) noexcept;
@@ -88,6 +96,7 @@ class SI_Symbol final : public SI_Base, public SerializableObject,
         // General Methods
         void addToSchematic() override;
         void removeFromSchematic() override;
+        void createGraphicsItems() noexcept override;
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
@@ -30,6 +30,7 @@
 #include "si_netpoint.h"
 #include "../../circuit/componentsignalinstance.h"
 #include "../../erc/ercmsg.h"
+#include "../../erc/ercmsglist.h"
 #include "../schematic.h"
 #include "../../project.h"
 #include "../../circuit/circuit.h"
@@ -59,7 +60,6 @@ SI_SymbolPin::SI_SymbolPin(SI_Symbol& symbol, const Uuid& pinUuid) :
     Uuid cmpSignalUuid = mPinSignalMapItem->getSignalUuid();
     mComponentSignalInstance = mSymbol.getComponentInstance().getSignalInstance(cmpSignalUuid);
 
-    mGraphicsItem.reset(new SGI_SymbolPin(*this));
     updatePosition();
 
     // create ERC messages
@@ -72,6 +72,7 @@ SI_SymbolPin::SI_SymbolPin(SI_Symbol& symbol, const Uuid& pinUuid) :
 SI_SymbolPin::~SI_SymbolPin()
 {
     Q_ASSERT(!isUsed());
+    mSchematic.getProject().getErcMsgList().unscheduleUpdate(*this);
     mGraphicsItem.reset();
 }
 
@@ -141,12 +142,13 @@ void SI_SymbolPin::addToSchematic()
     if (mComponentSignalInstance) {
         mComponentSignalInstance->registerSymbolPin(*this); // can throw
     }
+    createGraphicsItems();
     if (getCompSigInstNetSignal()) {
         mHighlightChangedConnection = connect(getCompSigInstNetSignal(), &NetSignal::highlightedChanged,
-                                              [this](){mGraphicsItem->update();});
+                                              [this](){if (mGraphicsItem) mGraphicsItem->update();});
     }
     SI_Base::addToSchematic(mGraphicsItem.data());
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void SI_SymbolPin::removeFromSchematic()
@@ -161,7 +163,19 @@ void SI_SymbolPin::removeFromSchematic()
         disconnect(mHighlightChangedConnection);
     }
     SI_Base::removeFromSchematic(mGraphicsItem.data());
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
+}
+
+void SI_SymbolPin::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem || (!mSchematic.hasGraphicsScene())) {
+        return;
+    }
+    mGraphicsItem.reset(new SGI_SymbolPin(*this));
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    mGraphicsItem->setRotation(-mRotation.toDeg());
+    mGraphicsItem->updateCacheAndRepaint();
+    addCreatedGraphicsItem(*mGraphicsItem);
 }
 
 void SI_SymbolPin::registerNetPoint(SI_NetPoint& netpoint)
@@ -173,7 +187,7 @@ void SI_SymbolPin::registerNetPoint(SI_NetPoint& netpoint)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredNetPoint = &netpoint;
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void SI_SymbolPin::unregisterNetPoint(SI_NetPoint& netpoint)
@@ -185,16 +199,18 @@ void SI_SymbolPin::unregisterNetPoint(SI_NetPoint& netpoint)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredNetPoint = nullptr;
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void SI_SymbolPin::updatePosition() noexcept
 {
     mPosition = mSymbol.mapToScene(mSymbolPin->getPosition());
     mRotation = mSymbol.getRotation() + mSymbolPin->getRotation();
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
-    mGraphicsItem->setRotation(-mRotation.toDeg());
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        mGraphicsItem->setRotation(-mRotation.toDeg());
+        mGraphicsItem->updateCacheAndRepaint();
+    }
     if (mRegisteredNetPoint) {
         mRegisteredNetPoint->setPosition(mPosition);
     }
@@ -206,19 +222,25 @@ void SI_SymbolPin::updatePosition() noexcept
 
 QPainterPath SI_SymbolPin::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
 void SI_SymbolPin::setSelected(bool selected) noexcept
 {
     SI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
  *  Private Slots
  ****************************************************************************************/
 
+void SI_SymbolPin::scheduleErcMessagesUpdate() noexcept
+{
+    mSchematic.getProject().getErcMsgList().scheduleUpdate(*this);
+}
+
 void SI_SymbolPin::updateErcMessages() noexcept
 {
     mErcMsgUnconnectedRequiredPin->setMsg(
@@ -83,6 +83,7 @@ class SI_SymbolPin final : public SI_Base, public IF_ErcMsgProvider
         // General Methods
         void addToSchematic() override;
         void removeFromSchematic() override;
+        void createGraphicsItems() noexcept override;
         void registerNetPoint(SI_NetPoint& netpoint);
         void unregisterNetPoint(SI_NetPoint& netpoint);
         void updatePosition() noexcept;
@@ -99,7 +100,8 @@ class SI_SymbolPin final : public SI_Base, public IF_ErcMsgProvider
 
     private slots:
 
-        void updateErcMessages() noexcept;
+        void scheduleErcMessagesUpdate() noexcept;
+        void updateErcMessages() noexcept override;
 
 
     private:
@@ -50,14 +50,14 @@ namespace project {
  ****************************************************************************************/
 
 Schematic::Schematic(Project& project, const FilePath& filepath, bool restore,
-                     bool readOnly, bool create, const QString& newName):
+                     bool readOnly, bool create, const QString& newName,
+                     const SExpression* parsedRoot, const QByteArray& parsedContent):
     QObject(&project), AttributeProvider(), mProject(project), mFilePath(filepath),
-    mIsAddedToProject(false)
+    mIsAddedToProject(false), mPreparedGraphicsItemsCount(0),
+    mAllGraphicsItemsPrepared(false)
 {
     try
     {
-        mGraphicsScene.reset(new GraphicsScene());
-
         // try to open/create the schematic file
         if (create)
         {
@@ -73,7 +73,15 @@ Schematic::Schematic(Project& project, const FilePath& filepath, bool restore,
         else
         {
             mFile.reset(new SmartSExprFile(mFilePath, restore, readOnly));
-            SExpression root = mFile->parseFileAndBuildDomTree();
+            SExpression parsedFile;
+            if (parsedRoot) {
+                // parsed in advance, but this file object needs to know the content too
+                mFile->setOpenedFileContent(parsedContent);
+            } else {
+                parsedFile = mFile->parseFileAndBuildDomTree();
+                parsedRoot = &parsedFile;
+            }
+            const SExpression& root = *parsedRoot;
 
             // the schematic seems to be ready to open, so we will create all needed objects
 
@@ -230,6 +238,18 @@ QList<SI_SymbolPin*> Schematic::getPinsAtScenePos(const Point& pos) const noexce
     return list;
 }
 
+/*****************************************************************************************
+ *  Getters: Attributes
+ ****************************************************************************************/
+
+const QIcon& Schematic::getIcon() noexcept
+{
+    if (mIcon.isNull()) {
+        updateIcon(); // rendering the icon requires the graphics items
+    }
+    return mIcon;
+}
+
 /*****************************************************************************************
  *  Setters: General
  ****************************************************************************************/
@@ -342,7 +362,7 @@ void Schematic::addToProject()
     }
 
     mIsAddedToProject = true;
-    updateIcon();
+    mIcon = QIcon(); // will be updated on next access
     sgl.dismiss();
 }
 
@@ -373,15 +393,7 @@ bool Schematic::save(bool toOriginal, QStringList& errors) noexcept
     // save schematic file
     try
     {
-        if (mIsAddedToProject)
-        {
-            SExpression doc(serializeToDomElement("librepcb_schematic"));
-            mFile->save(doc, toOriginal);
-        }
-        else
-        {
-            mFile->removeFile(toOriginal);
-        }
+        prepareSave(toOriginal)(); // can throw
     }
     catch (Exception& e)
     {
@@ -392,14 +404,70 @@ bool Schematic::save(bool toOriginal, QStringList& errors) noexcept
     return success;
 }
 
+std::function<void()> Schematic::prepareSave(bool toOriginal)
+{
+    SmartSExprFile* file = mFile.data();
+    if (mIsAddedToProject) {
+        SExpression doc(serializeToDomElement("librepcb_schematic")); // can throw
+        return [file, doc, toOriginal](){file->save(doc, toOriginal);};
+    } else {
+        return [file, toOriginal](){file->removeFile(toOriginal);};
+    }
+}
+
+bool Schematic::prepareGraphicsItems(int maxDurationMs) noexcept
+{
+    if (mAllGraphicsItemsPrepared) {
+        return true;
+    }
+    QElapsedTimer timer;
+    timer.start();
+    if (!mGraphicsScene) {
+        mGraphicsScene.reset(new GraphicsScene());
+    }
+
+    // Items added from now on create their graphics items on their own. If items were
+    // removed since the last call, some items may be skipped here, but the loop over
+    // all items below creates them as well (createGraphicsItems() does nothing if the
+    // graphics items exist already).
+    QList<SI_Base*> items;
+    foreach (SI_Symbol* symbol, mSymbols) {
+        items.append(symbol);
+    }
+    foreach (SI_NetSegment* netsegment, mNetSegments) {
+        items.append(netsegment);
+    }
+    while (mPreparedGraphicsItemsCount < items.count()) {
+        items.at(mPreparedGraphicsItemsCount++)->createGraphicsItems();
+        if ((maxDurationMs >= 0) && (timer.elapsed() >= maxDurationMs) &&
+            (mPreparedGraphicsItemsCount < items.count()))
+        {
+            return false; // continue on the next call
+        }
+    }
+    foreach (SI_Base* item, items) {
+        item->createGraphicsItems();
+    }
+    mAllGraphicsItemsPrepared = true;
+    return true;
+}
+
+void Schematic::initGraphicsScene() noexcept
+{
+    prepareGraphicsItems(-1);
+}
+
 void Schematic::showInView(GraphicsView& view) noexcept
 {
+    initGraphicsScene();
     view.setScene(mGraphicsScene.data());
 }
 
 void Schematic::setSelectionRect(const Point& p1, const Point& p2, bool updateItems) noexcept
 {
-    mGraphicsScene->setSelectionRect(p1, p2);
+    if (mGraphicsScene) {
+        mGraphicsScene->setSelectionRect(p1, p2);
+    }
     if (updateItems)
     {
         QRectF rectPx = QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized();
@@ -434,8 +502,9 @@ void Schematic::updateAllNetLabelAnchors() noexcept
     }
 }
 
-void Schematic::renderToQPainter(QPainter& painter) const noexcept
+void Schematic::renderToQPainter(QPainter& painter) noexcept
 {
+    initGraphicsScene();
     mGraphicsScene->render(&painter, QRectF(), mGraphicsScene->itemsBoundingRect(), Qt::KeepAspectRatio);
 }
 
@@ -471,6 +540,7 @@ QVector<const AttributeProvider*> Schematic::getAttributeProviderParents() const
 
 void Schematic::updateIcon() noexcept
 {
+    initGraphicsScene();
     QRectF source = mGraphicsScene->itemsBoundingRect().adjusted(-20, -20, 20, 20);
     QRect target(0, 0, 297, 210); // DIN A4 format :-)
 
@@ -479,6 +549,7 @@ void Schematic::updateIcon() noexcept
     QPainter painter(&pixmap);
     mGraphicsScene->render(&painter, target, source);
     mIcon = QIcon(pixmap);
+    emit iconChanged();
 }
 
 bool Schematic::checkAttributesValidity() const noexcept
@@ -509,7 +580,8 @@ void Schematic::serialize(SExpression& root) const
 Schematic* Schematic::create(Project& project, const FilePath& filepath,
                              const QString& name)
 {
-    return new Schematic(project, filepath, false, false, true, name);
+    return new Schematic(project, filepath, false, false, true, name, nullptr,
+                         QByteArray());
 }
 
 /*****************************************************************************************
@@ -24,6 +24,7 @@
  *  Includes
  ****************************************************************************************/
 #include <memory>
+#include <functional>
 #include <QtCore>
 #include <QtWidgets>
 #include <librepcb/common/uuid.h>
@@ -108,13 +109,18 @@ class Schematic final : public QObject, public AttributeProvider,
         Schematic() = delete;
         Schematic(const Schematic& other) = delete;
         Schematic(Project& project, const FilePath& filepath, bool restore, bool readOnly) :
-            Schematic(project, filepath, restore, readOnly, false, QString()) {}
+            Schematic(project, filepath, restore, readOnly, false, QString(), nullptr,
+                      QByteArray()) {}
+        Schematic(Project& project, const FilePath& filepath, bool restore, bool readOnly,
+                  const SExpression& root, const QByteArray& content) :
+            Schematic(project, filepath, restore, readOnly, false, QString(), &root, content) {}
         ~Schematic() noexcept;
 
         // Getters: General
         Project& getProject() const noexcept {return mProject;}
         const FilePath& getFilePath() const noexcept {return mFilePath;}
         const GridProperties& getGridProperties() const noexcept {return *mGridProperties;}
+        bool hasGraphicsScene() const noexcept {return !mGraphicsScene.isNull();}
         GraphicsScene& getGraphicsScene () const noexcept {return *mGraphicsScene;}
         bool isEmpty() const noexcept;
         QList<SI_Base*> getItemsAtScenePos(const Point& pos) const noexcept;
@@ -129,7 +135,15 @@ class Schematic final : public QObject, public AttributeProvider,
         // Getters: Attributes
         const Uuid& getUuid() const noexcept {return mUuid;}
         const QString& getName() const noexcept {return mName;}
-        const QIcon& getIcon() const noexcept {return mIcon;}
+
+        /**
+         * @brief Get the icon (thumbnail) of the schematic
+         *
+         * The icon is rendered on the first call, which also creates the graphics items
+         * of the schematic (only call it from the GUI thread, e.g. from editors).
+         */
+        const QIcon& getIcon() noexcept;
+        bool hasIcon() const noexcept {return !mIcon.isNull();}
 
         // Symbol Methods
         SI_Symbol* getSymbolByUuid(const Uuid& uuid) const noexcept;
@@ -145,13 +159,51 @@ class Schematic final : public QObject, public AttributeProvider,
         void addToProject();
         void removeFromProject();
         bool save(bool toOriginal, QStringList& errors) noexcept;
+        /**
+         * @brief Serialize the schematic and return a function which writes it to the file
+         *
+         * This allows to serialize the schematic in the main thread, but to write the file
+         * (which is much slower) in a worker thread.
+         *
+         * @param toOriginal    See #save()
+         *
+         * @return A function which writes the file (and throws on error)
+         *
+         * @throw Exception on error
+         */
+        std::function<void()> prepareSave(bool toOriginal);
+
+        /**
+         * @brief Create the graphics items step by step (e.g. while the GUI is idle)
+         *
+         * Creates the graphics scene (if not done yet) and then the graphics items of
+         * the schematic items until the given time is elapsed. Call this method again
+         * until it returns true to prepare the whole schematic without blocking the event
+         * loop for a long time. Showing or rendering the schematic creates all remaining
+         * graphics items immediately.
+         *
+         * @param maxDurationMs     Time after which no more items are prepared [ms]
+         *                          (-1 = unlimited)
+         *
+         * @return True if all graphics items are created, false if not
+         */
+        bool prepareGraphicsItems(int maxDurationMs) noexcept;
+
+        /**
+         * @brief Show the schematic in a graphics view
+         *
+         * The graphics scene and all graphics items are created on the first call (or
+         * when rendering the schematic with #renderToQPainter()).
+         *
+         * @param view      The view to show the schematic in
+         */
         void showInView(GraphicsView& view) noexcept;
         void saveViewSceneRect(const QRectF& rect) noexcept {mViewRect = rect;}
         const QRectF& restoreViewSceneRect() const noexcept {return mViewRect;}
         void setSelectionRect(const Point& p1, const Point& p2, bool updateItems) noexcept;
         void clearSelection() const noexcept;
         void updateAllNetLabelAnchors() noexcept;
-        void renderToQPainter(QPainter& painter) const noexcept;
+        void renderToQPainter(QPainter& painter) noexcept;
         std::unique_ptr<SchematicSelectionQuery> createSelectionQuery() const noexcept;
 
         // Inherited from AttributeProvider
@@ -175,11 +227,16 @@ class Schematic final : public QObject, public AttributeProvider,
         /// @copydoc AttributeProvider::attributesChanged()
         void attributesChanged() override;
 
+        /// Emitted when the icon was rendered (see #getIcon())
+        void iconChanged();
+
 
     private:
 
         Schematic(Project& project, const FilePath& filepath, bool restore,
-                  bool readOnly, bool create, const QString& newName);
+                  bool readOnly, bool create, const QString& newName,
+                  const SExpression* parsedRoot, const QByteArray& parsedContent);
+        void initGraphicsScene() noexcept;
         void updateIcon() noexcept;
         bool checkAttributesValidity() const noexcept;
 
@@ -194,6 +251,8 @@ class Schematic final : public QObject, public AttributeProvider,
         bool mIsAddedToProject;
 
         QScopedPointer<GraphicsScene> mGraphicsScene;
+        int mPreparedGraphicsItemsCount; ///< see #prepareGraphicsItems()
+        bool mAllGraphicsItemsPrepared; ///< see #prepareGraphicsItems()
         QScopedPointer<GridProperties> mGridProperties;
         QRectF mViewRect;
 
@@ -56,6 +56,8 @@ class SchematicLayerProvider final : public IF_GraphicsLayerProvider
         // Getters
         Project& getProject() const noexcept {return mProject;}
 
+        using IF_GraphicsLayerProvider::getLayer;
+
         /// @copydoc IF_GraphicsLayerProvider#getLayer()
         GraphicsLayer* getLayer(const QString& name) const noexcept override {
             foreach (GraphicsLayer* layer, mLayers) {
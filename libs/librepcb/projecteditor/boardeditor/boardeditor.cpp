@@ -32,6 +32,7 @@
 #include <librepcb/common/utils/undostackactiongroup.h>
 #include <librepcb/common/utils/exclusiveactiongroup.h>
 #include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boarddesignrulecheck.h>
 #include <librepcb/project/boards/items/bi_plane.h>
 #include <librepcb/project/circuit/circuit.h>
 #include <librepcb/common/dialogs/gridsettingsdialog.h>
@@ -178,6 +179,20 @@ BoardEditor::BoardEditor(ProjectEditor& projectEditor, Project& project) :
             mUi->statusbar, &StatusBar::setProgressBarPercent, Qt::QueuedConnection);
     connect(mGraphicsView, &GraphicsView::cursorScenePositionChanged,
             mUi->statusbar, &StatusBar::setAbsoluteCursorPosition);
+    connect(&mProjectEditor, &ProjectEditor::autosaveFailed, this, [this](const QString& msg){
+        mUi->statusbar->showMessage(QString(tr("Autosave failed: %1")).arg(msg), 10000);
+    });
+
+    // re-check the design rules after modifications (once the check has been run), but
+    // not while the user is still modifying the board (e.g. moving items with the mouse)
+    mDesignRuleCheckTimer.setSingleShot(true);
+    mDesignRuleCheckTimer.setInterval(300);
+    connect(&mDesignRuleCheckTimer, &QTimer::timeout,
+            this, &BoardEditor::updateDesignRuleCheck);
+    connect(&mProjectEditor.getUndoStack(), &UndoStack::stateModified,
+            this, &BoardEditor::scheduleDesignRuleCheck);
+    connect(&mProjectEditor.getUndoStack(), &UndoStack::commandGroupEnded,
+            this, &BoardEditor::scheduleDesignRuleCheck);
 
     // Restore Window Geometry
     QSettings clientSettings;
@@ -257,6 +272,7 @@ bool BoardEditor::setActiveBoardIndex(int index) noexcept
     }
 
     // active board has changed!
+    mDesignRuleCheck.reset();
     int oldIndex = mActiveBoardIndex;
     mActiveBoardIndex = index;
     mUnplacedComponentsDock->setBoard(board);
@@ -318,6 +334,7 @@ void BoardEditor::boardRemoved(int oldIndex)
     delete action;
 
     if (oldIndex == mActiveBoardIndex) {
+        mDesignRuleCheck.reset();
         setActiveBoardIndex(0);
     } else if (oldIndex < mActiveBoardIndex) {
         mActiveBoardIndex--;
@@ -485,6 +502,30 @@ void BoardEditor::on_actionRebuildPlanes_triggered()
     if (board) board->rebuildAllPlanes();
 }
 
+void BoardEditor::on_actionDesignRuleCheck_triggered()
+{
+    Board* board = getActiveBoard();
+    if (!board) return;
+
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    mDesignRuleCheck.reset(new BoardDesignRuleCheck(*board));
+    int count = mDesignRuleCheck->runFull();
+    QApplication::restoreOverrideCursor();
+
+    QStringList details;
+    foreach (const BoardDesignRuleCheck::Violation& violation,
+             mDesignRuleCheck->getViolations()) {
+        details.append(QString("[%1] %2").arg(violation.layerName, violation.message));
+    }
+    QMessageBox msgBox(count > 0 ? QMessageBox::Warning : QMessageBox::Information,
+                       tr("Design Rule Check"),
+                       QString(tr("%1 clearance violation(s) found.")).arg(count),
+                       QMessageBox::Ok, this);
+    msgBox.setDetailedText(details.join("\n"));
+    msgBox.exec();
+    updateDesignRuleCheck();
+}
+
 void BoardEditor::on_tabBar_currentChanged(int index)
 {
     setActiveBoardIndex(index);
@@ -505,6 +546,23 @@ bool BoardEditor::graphicsViewEventHandler(QEvent* event)
     return mFsm->processEvent(e, true);
 }
 
+void BoardEditor::scheduleDesignRuleCheck() noexcept
+{
+    if (mDesignRuleCheck) {
+        mDesignRuleCheckTimer.start(); // restarts the timer if it is already running
+    }
+}
+
+void BoardEditor::updateDesignRuleCheck() noexcept
+{
+    if (!mDesignRuleCheck) return;
+    if (mProjectEditor.getUndoStack().isCommandGroupActive()) {
+        return; // check again when the command group is finished
+    }
+    int count = mDesignRuleCheck->runIncremental();
+    mUi->statusbar->showMessage(QString(tr("Design rule check: %1 violation(s)")).arg(count));
+}
+
 void BoardEditor::toolActionGroupChangeTriggered(const QVariant& newTool) noexcept
 {
     switch (newTool.toInt()) {
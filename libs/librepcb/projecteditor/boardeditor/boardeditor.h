@@ -42,6 +42,7 @@ namespace project {
 
 class Project;
 class Board;
+class BoardDesignRuleCheck;
 class ComponentInstance;
 
 namespace editor {
@@ -111,6 +112,7 @@ class BoardEditor final : public QMainWindow, public IF_GraphicsViewEventHandler
         void on_actionLayerStackSetup_triggered();
         void on_actionModifyDesignRules_triggered();
         void on_actionRebuildPlanes_triggered();
+        void on_actionDesignRuleCheck_triggered();
         void on_tabBar_currentChanged(int index);
         void boardListActionGroupTriggered(QAction* action);
 
@@ -130,6 +132,8 @@ class BoardEditor final : public QMainWindow, public IF_GraphicsViewEventHandler
         // Private Methods
         bool graphicsViewEventHandler(QEvent* event);
         void toolActionGroupChangeTriggered(const QVariant& newTool) noexcept;
+        void scheduleDesignRuleCheck() noexcept;
+        void updateDesignRuleCheck() noexcept;
 
         // General Attributes
         ProjectEditor& mProjectEditor;
@@ -143,6 +147,8 @@ class BoardEditor final : public QMainWindow, public IF_GraphicsViewEventHandler
         int mActiveBoardIndex;
         QList<QAction*> mBoardListActions;
         QActionGroup mBoardListActionGroup;
+        QScopedPointer<BoardDesignRuleCheck> mDesignRuleCheck; ///< of the active board
+        QTimer mDesignRuleCheckTimer; ///< delays the design rule check after modifications
 
         // Docks
         ErcMsgDock* mErcMsgDock;
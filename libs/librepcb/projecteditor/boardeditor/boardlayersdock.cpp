@@ -173,7 +173,7 @@ QList<QString> BoardLayersDock::getCommonLayers() const noexcept
 {
     QList<QString> layers;
     //layers.append(GraphicsLayer::sBoardBackground));
-    //layers.append(GraphicsLayer::sBoardErcAirWires));
+    layers.append(GraphicsLayer::sBoardAirWires);
     layers.append(GraphicsLayer::sBoardOutlines);
     layers.append(GraphicsLayer::sBoardDrillsNpth);
     layers.append(GraphicsLayer::sBoardViasTht);
@@ -89,7 +89,9 @@ ErcMsgDock::ErcMsgDock(Project& project) :
     mTopLevelItems[static_cast<int>(ErcMsg::ErcMsgType_t::BoardError)]->setExpanded(true);
     mTopLevelItems[static_cast<int>(ErcMsg::ErcMsgType_t::BoardWarning)]->setExpanded(true);
 
-    // add all already existing ERC messages
+    // add all already existing ERC messages (apply pending changes first to not get
+    // messages which are already removed)
+    mProject.getErcMsgList().triggerScheduledUpdates();
     foreach (ErcMsg* ercMsg, mProject.getErcMsgList().getItems())
     {
         QTreeWidgetItem* parent;
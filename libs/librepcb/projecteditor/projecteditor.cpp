@@ -26,6 +26,8 @@
 #include <librepcb/workspace/workspace.h>
 #include <librepcb/workspace/settings/workspacesettings.h>
 #include <librepcb/project/project.h>
+#include <librepcb/project/schematics/schematic.h>
+#include <librepcb/project/boards/board.h>
 #include "schematiceditor/schematiceditor.h"
 #include "boardeditor/boardeditor.h"
 #include "dialogs/projectsettingsdialog.h"
@@ -44,11 +46,17 @@ namespace editor {
 
 ProjectEditor::ProjectEditor(workspace::Workspace& workspace, Project& project) :
     QObject(nullptr), mWorkspace(workspace), mProject(project), mUndoStack(nullptr),
-    mSchematicEditor(nullptr), mBoardEditor(nullptr)
+    mModifiedSinceAutosave(true), mAutosavePending(false), mSchematicEditor(nullptr),
+    mBoardEditor(nullptr)
 {
     try
     {
         mUndoStack = new UndoStack();
+        const workspace::WSI_UndoStackLimits& limits =
+            mWorkspace.getSettings().getUndoStackLimits();
+        mUndoStack->setLimits(limits.getMaxDepth(), limits.getMaxMemoryBytes());
+        connect(&limits, &workspace::WSI_UndoStackLimits::limitsChanged,
+                mUndoStack, &UndoStack::setLimits);
 
         // create the whole schematic/board editor GUI inclusive FSM and so on
         mSchematicEditor = new SchematicEditor(*this, mProject);
@@ -69,14 +77,25 @@ ProjectEditor::ProjectEditor(workspace::Workspace& workspace, Project& project)
     {
         // autosaving is enabled --> start the timer
         connect(&mAutoSaveTimer, &QTimer::timeout, this, &ProjectEditor::autosaveProject);
+        connect(&mAutosaveWatcher, &QFutureWatcher<QStringList>::finished,
+                this, &ProjectEditor::autosaveFinished);
+        connect(mUndoStack, &UndoStack::stateModified,
+                [this](){mModifiedSinceAutosave = true;});
         mAutoSaveTimer.start(1000 * intervalSecs);
     }
+
+    // prepare the graphics of all schematics and boards in the background, starting as
+    // soon as the event loop is idle (i.e. after the first shown page is painted)
+    connect(&mPrefetchTimer, &QTimer::timeout,
+            this, &ProjectEditor::prefetchNextSchematicOrBoard);
+    mPrefetchTimer.start(0);
 }
 
 ProjectEditor::~ProjectEditor() noexcept
 {
-    // stop the autosave timer
+    // stop the autosave and prefetch timers
     mAutoSaveTimer.stop();
+    mPrefetchTimer.stop();
 
     // abort all active commands!
     mSchematicEditor->abortAllCommands();
@@ -184,6 +203,9 @@ bool ProjectEditor::autosaveProject() noexcept
     if ((!mProject.isRestored()) && (mUndoStack->isClean()))
         return false; // do not save if there are no changes
 
+    if (!mModifiedSinceAutosave)
+        return false; // nothing has changed since the last autosave
+
     if (mUndoStack->isCommandGroupActive())
     {
         // the user is executing a command at the moment, so we should not save now,
@@ -196,16 +218,35 @@ bool ProjectEditor::autosaveProject() noexcept
         return false;
     }
 
-    try
+    if (mAutosaveWatcher.isRunning())
     {
-        qDebug() << "Begin autosaving the project to temporary files...";
-        mProject.save(false);
+        // the files of the previous autosave are still being written, so just save
+        // again as soon as that is finished
+        mAutosavePending = true;
+        return false;
+    }
+
+    // the project is serialized immediately, but the files are written in the background
+    qDebug() << "Begin autosaving the project to temporary files...";
+    mModifiedSinceAutosave = false;
+    mAutosaveWatcher.setFuture(mProject.saveTemporaryFilesInBackground());
+    return true;
+}
+
+void ProjectEditor::autosaveFinished() noexcept
+{
+    QStringList errors = mAutosaveWatcher.result();
+    if (errors.isEmpty()) {
         qDebug() << "Project successfully autosaved";
-        return true;
+    } else {
+        mModifiedSinceAutosave = true; // try again with the next autosave
+        qCritical() << "Autosave failed:" << errors;
+        emit autosaveFailed(errors.join("\n"));
     }
-    catch (Exception& exc)
-    {
-        return false;
+
+    if (mAutosavePending) {
+        mAutosavePending = false;
+        autosaveProject();
     }
 }
 
@@ -260,6 +301,28 @@ int ProjectEditor::getCountOfVisibleEditorWindows() const noexcept
     return count;
 }
 
+void ProjectEditor::prefetchNextSchematicOrBoard() noexcept
+{
+    // don't block the event loop longer than this time [ms]
+    static const int timeSlice = 20;
+
+    foreach (Schematic* schematic, mProject.getSchematics()) {
+        if (!schematic->prepareGraphicsItems(timeSlice)) {
+            return; // continue in the next idle cycle
+        }
+        if (!schematic->hasIcon()) {
+            schematic->getIcon(); // renders the icon for the schematic pages dock
+            return; // continue in the next idle cycle
+        }
+    }
+    foreach (Board* board, mProject.getBoards()) {
+        if (!board->prepareGraphicsItems(timeSlice)) {
+            return; // continue in the next idle cycle
+        }
+    }
+    mPrefetchTimer.stop(); // all schematics and boards are prepared
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
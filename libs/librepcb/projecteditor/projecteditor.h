@@ -203,18 +203,50 @@ class ProjectEditor final : public QObject
         void showControlPanelClicked();
         void projectEditorClosed();
 
+        /**
+         * @brief Emitted when writing the files of an autosave has failed
+         *
+         * @param errorMsg  The (translated) error message
+         */
+        void autosaveFailed(const QString& errorMsg);
+
 
     private: // Methods
 
         int getCountOfVisibleEditorWindows() const noexcept;
 
+        /**
+         * @brief Prepare the graphics of the next schematic or board not shown yet
+         *
+         * Schematics and boards create their graphics items only when they are shown
+         * the first time. To still switch between pages without delay, this method is
+         * called by #mPrefetchTimer whenever the event loop is idle and creates the
+         * graphics items of the next schematic or board for a few milliseconds (see
+         * librepcb::project::Board::prepareGraphicsItems()), so the GUI stays
+         * responsive even for big pages. The icons of the schematics are rendered
+         * afterwards, one per call. When all pages are prepared, the timer is stopped.
+         */
+        void prefetchNextSchematicOrBoard() noexcept;
+
+        /**
+         * @brief Called when the files of an autosave have been written
+         *
+         * If the project was modified while writing the files, the next autosave is
+         * started immediately (instead of waiting for the next autosave interval).
+         */
+        void autosaveFinished() noexcept;
+
 
     private: // Data
 
         workspace::Workspace& mWorkspace;
         Project& mProject;
         QTimer mAutoSaveTimer; ///< the timer for the periodically automatic saving functionality (see also @ref doc_project_save)
+        QTimer mPrefetchTimer; ///< idle timer to prepare not yet shown schematics and boards
         UndoStack* mUndoStack; ///< See @ref doc_project_undostack
+        bool mModifiedSinceAutosave; ///< whether the undo stack has changed since the last autosave
+        bool mAutosavePending; ///< whether an autosave was requested while another one was running
+        QFutureWatcher<QStringList> mAutosaveWatcher; ///< watches the autosave running in the background
         SchematicEditor* mSchematicEditor; ///< The schematic editor (GUI)
         BoardEditor* mBoardEditor; ///< The board editor (GUI)
 };
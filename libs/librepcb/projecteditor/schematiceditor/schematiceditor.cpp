@@ -149,6 +149,9 @@ SchematicEditor::SchematicEditor(ProjectEditor& projectEditor, Project& project)
             mUi->statusbar, &StatusBar::setProgressBarPercent, Qt::QueuedConnection);
     connect(mGraphicsView, &GraphicsView::cursorScenePositionChanged,
             mUi->statusbar, &StatusBar::setAbsoluteCursorPosition);
+    connect(&mProjectEditor, &ProjectEditor::autosaveFailed, this, [this](const QString& msg){
+        mUi->statusbar->showMessage(QString(tr("Autosave failed: %1")).arg(msg), 10000);
+    });
 
     // Restore Window Geometry
     QSettings clientSettings;
@@ -320,6 +323,7 @@ void SchematicEditor::on_actionPDF_Export_triggered()
         if (!filename.endsWith(".pdf")) filename.append(".pdf");
         FilePath filepath(filename);
         mProject.exportSchematicsAsPdf(filepath); // this method can throw an exception
+        QDesktopServices::openUrl(QUrl::fromLocalFile(filepath.toStr()));
     }
     catch (Exception& e)
     {
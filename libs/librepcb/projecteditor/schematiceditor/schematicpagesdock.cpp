@@ -98,8 +98,12 @@ void SchematicPagesDock::schematicAdded(int newIndex)
 
     QListWidgetItem* item = new QListWidgetItem();
     item->setText(QString("%1: %2").arg(newIndex+1).arg(schematic->getName()));
-    item->setIcon(schematic->getIcon());
+    if (schematic->hasIcon()) {
+        item->setIcon(schematic->getIcon());
+    } // otherwise the icon is set as soon as it was rendered (see #schematicIconChanged())
     mUi->listWidget->insertItem(newIndex, item);
+    connect(schematic, &Schematic::iconChanged, this,
+            &SchematicPagesDock::schematicIconChanged, Qt::UniqueConnection);
 }
 
 void SchematicPagesDock::schematicRemoved(int oldIndex)
@@ -111,6 +115,18 @@ void SchematicPagesDock::schematicRemoved(int oldIndex)
  *  Private Slots
  ****************************************************************************************/
 
+void SchematicPagesDock::schematicIconChanged()
+{
+    Schematic* schematic = qobject_cast<Schematic*>(sender());
+    Q_ASSERT(schematic); if (!schematic) return;
+
+    int index = mProject.getSchematicIndex(*schematic);
+    QListWidgetItem* item = mUi->listWidget->item(index);
+    if (item) {
+        item->setIcon(schematic->getIcon());
+    }
+}
+
 void SchematicPagesDock::on_btnNewSchematic_clicked()
 {
     bool ok = false;
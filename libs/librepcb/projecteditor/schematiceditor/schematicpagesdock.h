@@ -70,6 +70,8 @@ class SchematicPagesDock final : public QDockWidget
 
     private slots:
 
+        void schematicIconChanged();
+
         // UI
         void on_btnNewSchematic_clicked();
         void on_btnRemoveSchematic_clicked();
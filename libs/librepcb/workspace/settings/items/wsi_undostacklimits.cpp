@@ -0,0 +1,139 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include "wsi_undostacklimits.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace workspace {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+WSI_UndoStackLimits::WSI_UndoStackLimits(const SExpression& node) :
+    WSI_Base(),
+    mMaxDepth(0), mMaxDepthTmp(mMaxDepth),
+    mMaxMemoryMb(256), mMaxMemoryMbTmp(mMaxMemoryMb)
+{
+    if (const SExpression* child = node.tryGetChildByPath("undo_stack_max_depth")) {
+        mMaxDepth = child->getValueOfFirstChild<uint>(true);
+    }
+    if (const SExpression* child = node.tryGetChildByPath("undo_stack_max_memory")) {
+        mMaxMemoryMb = child->getValueOfFirstChild<uint>(true);
+    }
+    mMaxDepthTmp = mMaxDepth;
+    mMaxMemoryMbTmp = mMaxMemoryMb;
+
+    // create spinboxes
+    mDepthSpinBox.reset(new QSpinBox());
+    mDepthSpinBox->setMinimum(0);
+    mDepthSpinBox->setMaximum(100000);
+    mDepthSpinBox->setValue(mMaxDepth);
+    mDepthSpinBox->setSpecialValueText(tr("Unlimited"));
+    mDepthSpinBox->setSuffix(tr(" Steps"));
+    mDepthSpinBox->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
+    connect(mDepthSpinBox.data(), static_cast<void (QSpinBox::*)(int)>(&QSpinBox::valueChanged),
+            this, &WSI_UndoStackLimits::depthSpinBoxValueChanged);
+    mMemorySpinBox.reset(new QSpinBox());
+    mMemorySpinBox->setMinimum(0);
+    mMemorySpinBox->setMaximum(65536);
+    mMemorySpinBox->setValue(mMaxMemoryMb);
+    mMemorySpinBox->setSpecialValueText(tr("Unlimited"));
+    mMemorySpinBox->setSuffix(tr(" MB"));
+    mMemorySpinBox->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
+    connect(mMemorySpinBox.data(), static_cast<void (QSpinBox::*)(int)>(&QSpinBox::valueChanged),
+            this, &WSI_UndoStackLimits::memorySpinBoxValueChanged);
+
+    // create a QWidget
+    mWidget.reset(new QWidget());
+    QHBoxLayout* layout = new QHBoxLayout(mWidget.data());
+    layout->setContentsMargins(0, 0, 0, 0);
+    layout->addWidget(mDepthSpinBox.data());
+    layout->addWidget(mMemorySpinBox.data());
+    layout->addStretch();
+}
+
+WSI_UndoStackLimits::~WSI_UndoStackLimits() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void WSI_UndoStackLimits::restoreDefault() noexcept
+{
+    mMaxDepthTmp = 0;
+    mMaxMemoryMbTmp = 256;
+    mDepthSpinBox->setValue(mMaxDepthTmp);
+    mMemorySpinBox->setValue(mMaxMemoryMbTmp);
+}
+
+void WSI_UndoStackLimits::apply() noexcept
+{
+    if ((mMaxDepth == mMaxDepthTmp) && (mMaxMemoryMb == mMaxMemoryMbTmp)) {
+        return;
+    }
+    mMaxDepth = mMaxDepthTmp;
+    mMaxMemoryMb = mMaxMemoryMbTmp;
+    emit limitsChanged(mMaxDepth, getMaxMemoryBytes());
+}
+
+void WSI_UndoStackLimits::revert() noexcept
+{
+    mMaxDepthTmp = mMaxDepth;
+    mMaxMemoryMbTmp = mMaxMemoryMb;
+    mDepthSpinBox->setValue(mMaxDepthTmp);
+    mMemorySpinBox->setValue(mMaxMemoryMbTmp);
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void WSI_UndoStackLimits::depthSpinBoxValueChanged(int value) noexcept
+{
+    mMaxDepthTmp = value;
+}
+
+void WSI_UndoStackLimits::memorySpinBoxValueChanged(int value) noexcept
+{
+    mMaxMemoryMbTmp = value;
+}
+
+void WSI_UndoStackLimits::serialize(SExpression& root) const
+{
+    root.appendTokenChild("undo_stack_max_depth", mMaxDepth, true);
+    root.appendTokenChild("undo_stack_max_memory", mMaxMemoryMb, true);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace workspace
+} // namespace librepcb
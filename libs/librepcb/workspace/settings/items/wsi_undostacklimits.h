@@ -0,0 +1,127 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_WSI_UNDOSTACKLIMITS_H
+#define LIBREPCB_WSI_UNDOSTACKLIMITS_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include "wsi_base.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace workspace {
+
+/*****************************************************************************************
+ *  Class WSI_UndoStackLimits
+ ****************************************************************************************/
+
+/**
+ * @brief The WSI_UndoStackLimits class represents the size limits of undo stacks
+ *
+ * This setting is used by the project editor to limit the count of undo steps and the
+ * memory used by them (see librepcb::UndoStack::setLimits()). A value of zero means
+ * that the corresponding limit is disabled.
+ */
+class WSI_UndoStackLimits final : public WSI_Base
+{
+        Q_OBJECT
+
+    public:
+
+        // Constructors / Destructor
+        WSI_UndoStackLimits() = delete;
+        WSI_UndoStackLimits(const WSI_UndoStackLimits& other) = delete;
+        explicit WSI_UndoStackLimits(const SExpression& node);
+        ~WSI_UndoStackLimits() noexcept;
+
+        // Getters
+        uint getMaxDepth() const noexcept {return mMaxDepth;}
+        uint getMaxMemoryMb() const noexcept {return mMaxMemoryMb;}
+        qint64 getMaxMemoryBytes() const noexcept {return qint64(mMaxMemoryMb) * 1024 * 1024;}
+
+        // Getters: Widgets
+        QString getLabelText() const noexcept {return tr("Undo Stack Limits:");}
+        QWidget* getWidget() const noexcept {return mWidget.data();}
+
+        // General Methods
+        void restoreDefault() noexcept override;
+        void apply() noexcept override;
+        void revert() noexcept override;
+
+        /// @copydoc librepcb::SerializableObject::serialize()
+        void serialize(SExpression& root) const override;
+
+        // Operator Overloadings
+        WSI_UndoStackLimits& operator=(const WSI_UndoStackLimits& rhs) = delete;
+
+
+    signals:
+
+        /**
+         * @brief Emitted by #apply() if the limits have been changed
+         *
+         * @param maxDepth          See #getMaxDepth()
+         * @param maxMemoryBytes    See #getMaxMemoryBytes()
+         */
+        void limitsChanged(int maxDepth, qint64 maxMemoryBytes);
+
+
+    private: // Methods
+        void depthSpinBoxValueChanged(int value) noexcept;
+        void memorySpinBoxValueChanged(int value) noexcept;
+
+
+    private: // Data
+
+        // General Attributes
+
+        /**
+         * @brief the maximum count of undo steps (0 = unlimited)
+         *
+         * Default: 0 (unlimited)
+         */
+        uint mMaxDepth;
+        uint mMaxDepthTmp;
+
+        /**
+         * @brief the maximum memory used by the undo steps [MB] (0 = unlimited)
+         *
+         * Default: 256 MB
+         */
+        uint mMaxMemoryMb;
+        uint mMaxMemoryMbTmp;
+
+        // Widgets
+        QScopedPointer<QWidget> mWidget;
+        QScopedPointer<QSpinBox> mDepthSpinBox;
+        QScopedPointer<QSpinBox> mMemorySpinBox;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace workspace
+} // namespace librepcb
+
+#endif // LIBREPCB_WSI_UNDOSTACKLIMITS_H
@@ -56,6 +56,7 @@ WorkspaceSettings::WorkspaceSettings(const Workspace& workspace) :
     loadSettingsItem(mAppLocale,                root);
     loadSettingsItem(mAppDefMeasUnits,          root);
     loadSettingsItem(mProjectAutosaveInterval,  root);
+    loadSettingsItem(mUndoStackLimits,          root);
     loadSettingsItem(mAppearance,               root);
     loadSettingsItem(mLibraryLocaleOrder,       root);
     loadSettingsItem(mLibraryNormOrder,         root);
@@ -31,6 +31,7 @@
 #include "items/wsi_applocale.h"
 #include "items/wsi_appdefaultmeasurementunits.h"
 #include "items/wsi_projectautosaveinterval.h"
+#include "items/wsi_undostacklimits.h"
 #include "items/wsi_librarylocaleorder.h"
 #include "items/wsi_librarynormorder.h"
 #include "items/wsi_debugtools.h"
@@ -81,6 +82,7 @@ class WorkspaceSettings final : public QObject, public SerializableObject
         WSI_AppLocale& getAppLocale() const noexcept {return *mAppLocale;}
         WSI_AppDefaultMeasurementUnits& getAppDefMeasUnits() const noexcept {return *mAppDefMeasUnits;}
         WSI_ProjectAutosaveInterval& getProjectAutosaveInterval() const noexcept {return *mProjectAutosaveInterval;}
+        WSI_UndoStackLimits& getUndoStackLimits() const noexcept {return *mUndoStackLimits;}
         WSI_Appearance& getAppearance() const noexcept {return *mAppearance;}
         WSI_LibraryLocaleOrder& getLibLocaleOrder() const noexcept {return *mLibraryLocaleOrder;}
         WSI_LibraryNormOrder& getLibNormOrder() const noexcept {return *mLibraryNormOrder;}
@@ -128,6 +130,7 @@ class WorkspaceSettings final : public QObject, public SerializableObject
         QScopedPointer<WSI_AppLocale> mAppLocale;
         QScopedPointer<WSI_AppDefaultMeasurementUnits> mAppDefMeasUnits;
         QScopedPointer<WSI_ProjectAutosaveInterval> mProjectAutosaveInterval;
+        QScopedPointer<WSI_UndoStackLimits> mUndoStackLimits;
         QScopedPointer<WSI_Appearance> mAppearance;
         QScopedPointer<WSI_LibraryLocaleOrder> mLibraryLocaleOrder;
         QScopedPointer<WSI_LibraryNormOrder> mLibraryNormOrder;
@@ -51,6 +51,8 @@ WorkspaceSettingsDialog::WorkspaceSettingsDialog(WorkspaceSettings& settings) :
                                mSettings.getAppDefMeasUnits().getLengthUnitComboBox());
     mUi->generalLayout->addRow(mSettings.getProjectAutosaveInterval().getLabelText(),
                                mSettings.getProjectAutosaveInterval().getWidget());
+    mUi->generalLayout->addRow(mSettings.getUndoStackLimits().getLabelText(),
+                               mSettings.getUndoStackLimits().getWidget());
 
     // tab: appearance
     mUi->appearanceLayout->addRow(mSettings.getAppearance().getUseOpenGlLabelText(),
@@ -88,6 +90,7 @@ WorkspaceSettingsDialog::~WorkspaceSettingsDialog()
     mSettings.getAppLocale().getWidget()->setParent(0);
     mSettings.getAppDefMeasUnits().getLengthUnitComboBox()->setParent(0);
     mSettings.getProjectAutosaveInterval().getWidget()->setParent(0);
+    mSettings.getUndoStackLimits().getWidget()->setParent(0);
 
     // tab: appearance
     mSettings.getAppearance().getUseOpenGlWidget()->setParent(0);
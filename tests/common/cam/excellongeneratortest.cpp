@@ -0,0 +1,140 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/cam/excellongenerator.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class ExcellonGeneratorTest : public ::testing::Test
+{
+    protected:
+
+        // Parse the hits of the generated output, grouped by tool number
+        static QMap<int, QVector<QPointF>> parseDrills(const QString& output) noexcept
+        {
+            QMap<int, QVector<QPointF>> drills;
+            int tool = 0;
+            bool inBody = false;
+            QRegularExpression toolRx("^T(\\d+)$");
+            QRegularExpression drillRx("^X([-0-9.]+)Y([-0-9.]+)$");
+            foreach (const QString& line, output.split('\n')) {
+                if (line == "%") {
+                    inBody = true;
+                } else if (inBody && toolRx.match(line).hasMatch()) {
+                    tool = toolRx.match(line).captured(1).toInt();
+                } else if (drillRx.match(line).hasMatch()) {
+                    QRegularExpressionMatch match = drillRx.match(line);
+                    drills[tool].append(QPointF(match.captured(1).toDouble(),
+                                                match.captured(2).toDouble()));
+                }
+            }
+            return drills;
+        }
+
+        static qreal travelDistance(const QVector<QPointF>& drills) noexcept
+        {
+            qreal distance = 0;
+            for (int i = 1; i < drills.count(); ++i) {
+                distance += QLineF(drills[i-1], drills[i]).length();
+            }
+            return distance;
+        }
+
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(ExcellonGeneratorTest, testAllDrillsAreKeptPerTool)
+{
+    QMultiMap<int, QPointF> expected;
+    ExcellonGenerator gen;
+    gen.setOptimizeDrillOrder(true);
+    for (int i = 0; i < 50; ++i) {
+        Point pos(Length::fromMm((i * 37) % 50), Length::fromMm((i * 13) % 20));
+        Length dia = Length::fromMm((i % 3 == 0) ? 0.8 : 0.3);
+        gen.drill(pos, dia);
+        expected.insert((i % 3 == 0) ? 2 : 1, QPointF(pos.getX().toMm(), pos.getY().toMm()));
+    }
+    gen.generate();
+
+    QMap<int, QVector<QPointF>> drills = parseDrills(gen.toStr());
+    ASSERT_EQ(2, drills.count());
+    foreach (int tool, drills.keys()) {
+        QList<QPointF> actual = drills.value(tool).toList();
+        QList<QPointF> expectedDrills = expected.values(tool);
+        EXPECT_EQ(expectedDrills.count(), actual.count());
+        foreach (const QPointF& p, expectedDrills) {
+            EXPECT_TRUE(actual.removeOne(p)) << qPrintable(QString("%1/%2").arg(p.x()).arg(p.y()));
+        }
+        EXPECT_TRUE(actual.isEmpty());
+    }
+}
+
+TEST_F(ExcellonGeneratorTest, testDrillOrderIsKeptByDefault)
+{
+    QVector<QPointF> expected;
+    ExcellonGenerator gen;
+    for (int i = 0; i < 20; ++i) {
+        Point pos(Length::fromMm((i * 7) % 20), Length(0));
+        gen.drill(pos, Length::fromMm(0.3));
+        expected.append(QPointF(pos.getX().toMm(), pos.getY().toMm()));
+    }
+    gen.generate();
+    EXPECT_EQ(expected, parseDrills(gen.toStr()).value(1));
+}
+
+TEST_F(ExcellonGeneratorTest, testOptimizedDrillOrderOfLine)
+{
+    // hits on a line in shuffled order must be drilled from one end to the other
+    ExcellonGenerator gen;
+    gen.setOptimizeDrillOrder(true);
+    for (int i = 0; i < 50; ++i) {
+        gen.drill(Point(Length::fromMm((i * 17) % 50), Length::fromMm(5)),
+                  Length::fromMm(0.3));
+    }
+    gen.generate();
+    QVector<QPointF> drills = parseDrills(gen.toStr()).value(1);
+    ASSERT_EQ(50, drills.count());
+    EXPECT_EQ(QPointF(0, 5), drills.first());
+    EXPECT_NEAR(49.0, travelDistance(drills), 1e-6);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,235 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <QtConcurrent>
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/filesavetransaction.h>
+#include <librepcb/common/fileio/fileutils.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class FileSaveTransactionTest : public ::testing::Test
+{
+    protected:
+
+        virtual void SetUp() override
+        {
+            // create temporary, empty directory
+            mTempDir = FilePath::getApplicationTempPath().getPathTo("FileSaveTransactionTest");
+            if (mTempDir.isExistingDir()) {
+                FileUtils::removeDirRecursively(mTempDir); // can throw
+            }
+            FileUtils::makePath(mTempDir);
+        }
+
+        virtual void TearDown() override
+        {
+            // remove temporary directory
+            FileUtils::removeDirRecursively(mTempDir); // can throw
+        }
+
+        int countFilesInTempDir() const
+        {
+            return QDir(mTempDir.toStr()).entryList(QDir::Files | QDir::Hidden).count();
+        }
+
+        FilePath mTempDir;
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(FileSaveTransactionTest, testCommit)
+{
+    FilePath existingFile = mTempDir.getPathTo("existing.txt");
+    FilePath newFile = mTempDir.getPathTo("subdir/new.txt");
+    FileUtils::writeFile(existingFile, "old");
+
+    FileSaveTransaction transaction;
+    transaction.writeFile(existingFile, "new");
+    transaction.writeFile(newFile, "foo");
+    EXPECT_FALSE(transaction.isEmpty());
+    EXPECT_EQ(QByteArray("old"), FileUtils::readFile(existingFile));
+    EXPECT_FALSE(newFile.isExistingFile());
+
+    transaction.commit();
+    EXPECT_TRUE(transaction.isCommitted());
+    EXPECT_TRUE(transaction.isEmpty());
+    EXPECT_EQ(QByteArray("new"), FileUtils::readFile(existingFile));
+    EXPECT_EQ(QByteArray("foo"), FileUtils::readFile(newFile));
+    EXPECT_EQ(1, countFilesInTempDir()); // no temporary files left
+}
+
+TEST_F(FileSaveTransactionTest, testWriteSameFileTwice)
+{
+    FilePath file = mTempDir.getPathTo("file.txt");
+    FileSaveTransaction transaction;
+    transaction.writeFile(file, "first");
+    transaction.writeFile(file, "second");
+    transaction.commit();
+    EXPECT_EQ(QByteArray("second"), FileUtils::readFile(file));
+    EXPECT_EQ(1, countFilesInTempDir());
+}
+
+TEST_F(FileSaveTransactionTest, testRollbackOnDestruction)
+{
+    FilePath existingFile = mTempDir.getPathTo("existing.txt");
+    FileUtils::writeFile(existingFile, "old");
+    bool rolledBack = false;
+    {
+        FileSaveTransaction transaction;
+        transaction.writeFile(existingFile, "new");
+        transaction.writeFile(mTempDir.getPathTo("new.txt"), "foo");
+        transaction.addRollbackHandler([&rolledBack](){rolledBack = true;});
+    }
+    EXPECT_TRUE(rolledBack);
+    EXPECT_EQ(QByteArray("old"), FileUtils::readFile(existingFile));
+    EXPECT_EQ(1, countFilesInTempDir());
+}
+
+TEST_F(FileSaveTransactionTest, testRollbackHandlersNotCalledAfterCommit)
+{
+    bool rolledBack = false;
+    {
+        FileSaveTransaction transaction;
+        transaction.addRollbackHandler([&rolledBack](){rolledBack = true;});
+        transaction.commit();
+    }
+    EXPECT_FALSE(rolledBack);
+}
+
+TEST_F(FileSaveTransactionTest, testCommitHandlers)
+{
+    bool committed = false;
+    FileSaveTransaction transaction;
+    transaction.addCommitHandler([&committed](){committed = true;});
+    EXPECT_FALSE(committed);
+    transaction.commit();
+    EXPECT_TRUE(committed);
+}
+
+TEST_F(FileSaveTransactionTest, testRemoveFile)
+{
+    FilePath removedFile = mTempDir.getPathTo("removed.txt");
+    FilePath writtenFile = mTempDir.getPathTo("written.txt");
+    FileUtils::writeFile(removedFile, "old");
+    FileSaveTransaction transaction;
+    {
+        FileSaveTransaction::Scope scope(transaction);
+        FileUtils::removeFile(removedFile); // removed within the transaction
+        FileUtils::writeFile(writtenFile, "foo");
+        FileUtils::removeFile(writtenFile); // discards the pending write
+    }
+    EXPECT_TRUE(removedFile.isExistingFile());
+    EXPECT_EQ(1, countFilesInTempDir()); // the temporary file is already removed
+    transaction.commit();
+    EXPECT_FALSE(removedFile.isExistingFile());
+    EXPECT_FALSE(writtenFile.isExistingFile());
+}
+
+TEST_F(FileSaveTransactionTest, testRemoveFileRollback)
+{
+    FilePath file = mTempDir.getPathTo("file.txt");
+    FileUtils::writeFile(file, "old");
+    {
+        FileSaveTransaction transaction;
+        transaction.removeFile(file);
+    }
+    EXPECT_EQ(QByteArray("old"), FileUtils::readFile(file));
+}
+
+TEST_F(FileSaveTransactionTest, testWriteAfterCommitThrows)
+{
+    FileSaveTransaction transaction;
+    transaction.commit();
+    EXPECT_THROW(transaction.writeFile(mTempDir.getPathTo("file.txt"), "foo"), Exception);
+    EXPECT_THROW(transaction.commit(), Exception);
+    EXPECT_EQ(0, countFilesInTempDir());
+}
+
+TEST_F(FileSaveTransactionTest, testScope)
+{
+    FilePath file = mTempDir.getPathTo("file.txt");
+    EXPECT_EQ(nullptr, FileSaveTransaction::getCurrent());
+    FileSaveTransaction outer;
+    FileSaveTransaction inner;
+    {
+        FileSaveTransaction::Scope outerScope(outer);
+        EXPECT_EQ(&outer, FileSaveTransaction::getCurrent());
+        {
+            FileSaveTransaction::Scope innerScope(inner);
+            EXPECT_EQ(&inner, FileSaveTransaction::getCurrent());
+        }
+        EXPECT_EQ(&outer, FileSaveTransaction::getCurrent());
+        FileUtils::writeFile(file, "foo"); // written into the transaction
+    }
+    EXPECT_EQ(nullptr, FileSaveTransaction::getCurrent());
+    EXPECT_FALSE(file.isExistingFile());
+    EXPECT_TRUE(inner.isEmpty());
+    outer.commit();
+    EXPECT_EQ(QByteArray("foo"), FileUtils::readFile(file));
+}
+
+TEST_F(FileSaveTransactionTest, testSuspendingScope)
+{
+    FilePath file = mTempDir.getPathTo("file.txt");
+    FileSaveTransaction transaction;
+    {
+        FileSaveTransaction::Scope scope(transaction);
+        {
+            FileSaveTransaction::Scope noTransaction(nullptr);
+            EXPECT_EQ(nullptr, FileSaveTransaction::getCurrent());
+            FileUtils::writeFile(file, "foo"); // written immediately
+        }
+        EXPECT_EQ(&transaction, FileSaveTransaction::getCurrent());
+    }
+    EXPECT_TRUE(transaction.isEmpty());
+    EXPECT_EQ(QByteArray("foo"), FileUtils::readFile(file));
+}
+
+TEST_F(FileSaveTransactionTest, testScopeIsPerThread)
+{
+    FileSaveTransaction transaction;
+    FileSaveTransaction::Scope scope(transaction);
+    QFuture<FileSaveTransaction*> future = QtConcurrent::run([](){
+        return FileSaveTransaction::getCurrent();
+    });
+    EXPECT_EQ(nullptr, future.result());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,131 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/fileio/filepath.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class FileUtilsTest : public ::testing::Test
+{
+    protected:
+
+        virtual void SetUp() override
+        {
+            // create temporary, empty directory
+            mTempDir = FilePath::getApplicationTempPath().getPathTo("FileUtilsTest");
+            if (mTempDir.isExistingDir()) {
+                FileUtils::removeDirRecursively(mTempDir); // can throw
+            }
+            FileUtils::makePath(mTempDir);
+        }
+
+        virtual void TearDown() override
+        {
+            // remove temporary directory
+            FileUtils::removeDirRecursively(mTempDir); // can throw
+        }
+
+        FilePath mTempDir;
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(FileUtilsTest, testCopyFile)
+{
+    FilePath source = mTempDir.getPathTo("source.txt");
+    FilePath dest = mTempDir.getPathTo("dest.txt");
+    FileUtils::writeFile(source, "content");
+    FileUtils::copyFile(source, dest);
+    EXPECT_EQ(QByteArray("content"), FileUtils::readFile(dest));
+    EXPECT_THROW(FileUtils::copyFile(source, dest), Exception); // dest exists already
+}
+
+TEST_F(FileUtilsTest, testCopyEmptyFile)
+{
+    FilePath source = mTempDir.getPathTo("source.txt");
+    FilePath dest = mTempDir.getPathTo("dest.txt");
+    FileUtils::writeFile(source, QByteArray());
+    FileUtils::copyFile(source, dest);
+    EXPECT_TRUE(dest.isExistingFile());
+    EXPECT_EQ(QByteArray(), FileUtils::readFile(dest));
+}
+
+TEST_F(FileUtilsTest, testCopyDirRecursively)
+{
+    FilePath source = mTempDir.getPathTo("source");
+    FilePath dest = mTempDir.getPathTo("dest");
+    QByteArray bigContent(1000000, 'x');
+    FileUtils::writeFile(source.getPathTo("file.txt"), "foo");
+    FileUtils::writeFile(source.getPathTo(".hidden"), "bar");
+    FileUtils::writeFile(source.getPathTo("a/b/big.bin"), bigContent);
+    FileUtils::makePath(source.getPathTo("empty"));
+
+    QList<QPair<qint64, qint64>> progress;
+    FileUtils::copyDirRecursively(source, dest, [&progress](qint64 copied, qint64 total){
+        progress.append(qMakePair(copied, total));
+    });
+
+    EXPECT_EQ(QByteArray("foo"), FileUtils::readFile(dest.getPathTo("file.txt")));
+    EXPECT_EQ(QByteArray("bar"), FileUtils::readFile(dest.getPathTo(".hidden")));
+    EXPECT_EQ(bigContent, FileUtils::readFile(dest.getPathTo("a/b/big.bin")));
+    EXPECT_TRUE(dest.getPathTo("empty").isExistingDir());
+
+    // progress is reported once per file, up to the total size
+    qint64 totalSize = 3 + 3 + bigContent.size();
+    ASSERT_EQ(3, progress.count());
+    for (int i = 0; i < progress.count(); ++i) {
+        EXPECT_EQ(totalSize, progress[i].second);
+        if (i > 0) EXPECT_GT(progress[i].first, progress[i-1].first);
+    }
+    EXPECT_EQ(totalSize, progress.last().first);
+}
+
+TEST_F(FileUtilsTest, testCopyDirRecursivelyToExistingDirThrows)
+{
+    FilePath source = mTempDir.getPathTo("source");
+    FilePath dest = mTempDir.getPathTo("dest");
+    FileUtils::writeFile(source.getPathTo("file.txt"), "foo");
+    FileUtils::makePath(dest);
+    EXPECT_THROW(FileUtils::copyDirRecursively(source, dest), Exception);
+    EXPECT_FALSE(dest.getPathTo("file.txt").isExistingFile());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -284,6 +284,79 @@ TEST_F(SerializableObjectListTest, testClear)
     EXPECT_EQ(0, l.count());
 }
 
+TEST_F(SerializableObjectListTest, testIndexOfInLargeList)
+{
+    List l;
+    for (int i = 0; i < 100; ++i) {
+        l.append(std::make_shared<Mock>(Uuid::createRandom(), QString::number(i)));
+    }
+    l.append(mMocks[0]);
+    l.append(std::make_shared<Mock>(*mMocks[0]));   // duplicate -> first one is found
+    EXPECT_EQ(100, l.indexOf(mMocks[0]->mUuid));
+    EXPECT_EQ(100, l.indexOf(mMocks[0]->mName));
+    EXPECT_EQ(42, l.indexOf(QString("42")));
+    EXPECT_EQ(-1, l.indexOf(mMocks[1]->mUuid));
+    EXPECT_EQ(-1, l.indexOf(mMocks[1]->mName));
+
+    // modify the list
+    l.insert(10, mMocks[1]);
+    EXPECT_EQ(10, l.indexOf(mMocks[1]->mUuid));
+    EXPECT_EQ(101, l.indexOf(mMocks[0]->mUuid));
+    l.remove(0);
+    EXPECT_EQ(9, l.indexOf(mMocks[1]->mName));
+    EXPECT_EQ(100, l.indexOf(mMocks[0]->mName));
+    l.swap(9, 100);
+    EXPECT_EQ(9, l.indexOf(mMocks[0]->mUuid));
+    EXPECT_EQ(100, l.indexOf(mMocks[1]->mUuid));
+
+    // names may be modified at any time
+    l[50]->mName = "renamed";
+    EXPECT_EQ(50, l.indexOf(QString("renamed")));
+    EXPECT_EQ(-1, l.indexOf(QString("50")));  // was at index 50
+    EXPECT_EQ(51, l.indexOf(QString("51")));
+}
+
+TEST_F(SerializableObjectListTest, testUuidIndexIsUpdatedOnModifications)
+{
+    // compare every lookup with a linear search after each kind of modification
+    List l;
+    for (int i = 0; i < 40; ++i) {
+        l.append(std::make_shared<Mock>(Uuid::createRandom(), QString::number(i)));
+    }
+    l.append(std::make_shared<Mock>(*l[5]));    // duplicate UUID
+    auto checkAllUuids = [this, &l](){
+        QList<Uuid> uuids = l.getUuids().toList() << mMocks[0]->mUuid;
+        foreach (const Uuid& uuid, uuids) {
+            int expected = -1;
+            for (int i = 0; i < l.count(); ++i) {
+                if (l[i]->mUuid == uuid) {expected = i; break;}
+            }
+            EXPECT_EQ(expected, l.indexOf(uuid)) << qPrintable(uuid.toStr());
+        }
+    };
+    checkAllUuids(); // builds the index
+
+    l.append(std::make_shared<Mock>(Uuid::createRandom(), "appended"));
+    checkAllUuids();
+    l.insert(0, std::make_shared<Mock>(Uuid::createRandom(), "inserted"));
+    checkAllUuids();
+    l.insert(3, std::make_shared<Mock>(*l[20]));  // duplicate before the original
+    checkAllUuids();
+    l.remove(3);                                  // remove it again
+    checkAllUuids();
+    l.remove(6);                                  // first one of the duplicates
+    checkAllUuids();
+    l.swap(1, 30);
+    checkAllUuids();
+    l.swap(35, 2);
+    checkAllUuids();
+    l.remove(l.count() - 1);
+    checkAllUuids();
+    l.clear();
+    checkAllUuids();
+    EXPECT_EQ(-1, l.indexOf(mMocks[1]->mUuid));
+}
+
 TEST_F(SerializableObjectListTest, testSerialize)
 {
     SExpression e = SExpression::createList("list");
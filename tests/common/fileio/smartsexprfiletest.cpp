@@ -0,0 +1,111 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/smartsexprfile.h>
+#include <librepcb/common/fileio/sexpression.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/fileio/filepath.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class SmartSExprFileTest : public ::testing::Test
+{
+    protected:
+
+        virtual void SetUp() override
+        {
+            // create temporary, empty directory
+            mTempDir = FilePath::getApplicationTempPath().getPathTo("SmartSExprFileTest");
+            if (mTempDir.isExistingDir()) {
+                FileUtils::removeDirRecursively(mTempDir); // can throw
+            }
+            FileUtils::makePath(mTempDir);
+
+            // create a file with exactly the content SmartSExprFile would write
+            mFilePath = mTempDir.getPathTo("file.lp");
+            FileUtils::writeFile(mFilePath, serialize(createDocument("foo")));
+        }
+
+        virtual void TearDown() override
+        {
+            // remove temporary directory
+            FileUtils::removeDirRecursively(mTempDir); // can throw
+        }
+
+        static SExpression createDocument(const QString& value)
+        {
+            SExpression root = SExpression::createList("test");
+            root.appendTokenChild("value", value, true);
+            return root;
+        }
+
+        static QByteArray serialize(const SExpression& root)
+        {
+            return QString(root.toString(0) % "\n").toUtf8();
+        }
+
+        FilePath mTempDir;
+        FilePath mFilePath;
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(SmartSExprFileTest, testSaveUnmodifiedDocumentDoesNotWriteFile)
+{
+    SmartSExprFile file(mFilePath, false, false);
+    SExpression root = file.parseFileAndBuildDomTree();
+
+    // modify the file behind the back of SmartSExprFile to detect whether it writes it
+    FileUtils::writeFile(mFilePath, "modified");
+    file.save(root, true);
+    EXPECT_EQ(QByteArray("modified"), FileUtils::readFile(mFilePath));
+}
+
+TEST_F(SmartSExprFileTest, testSaveModifiedDocumentWritesFile)
+{
+    SmartSExprFile file(mFilePath, false, false);
+    file.parseFileAndBuildDomTree();
+
+    SExpression root = createDocument("bar");
+    file.save(root, true);
+    EXPECT_EQ(serialize(root), FileUtils::readFile(mFilePath));
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,111 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class GraphicsLayerTest : public ::testing::Test
+{
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(GraphicsLayerTest, testLayerIdOfUnknownName)
+{
+    EXPECT_EQ(GraphicsLayer::Id::Unknown, GraphicsLayer::getLayerId(""));
+    EXPECT_EQ(GraphicsLayer::Id::Unknown, GraphicsLayer::getLayerId("foo_bar"));
+    EXPECT_EQ(QString(), GraphicsLayer::getLayerName(GraphicsLayer::Id::Unknown));
+    EXPECT_EQ(GraphicsLayer::Id::Unknown, GraphicsLayer("foo_bar").getId());
+}
+
+TEST_F(GraphicsLayerTest, testLayerIdAndNameRoundTrip)
+{
+    for (int i = 1; i < static_cast<int>(GraphicsLayer::Id::_COUNT); ++i) {
+        GraphicsLayer::Id id = static_cast<GraphicsLayer::Id>(i);
+        QString name = GraphicsLayer::getLayerName(id);
+        EXPECT_FALSE(name.isEmpty()) << i;
+        EXPECT_EQ(id, GraphicsLayer::getLayerId(name)) << qPrintable(name);
+        EXPECT_EQ(id, GraphicsLayer(name).getId()) << qPrintable(name);
+    }
+}
+
+TEST_F(GraphicsLayerTest, testInnerLayerIds)
+{
+    EXPECT_EQ(GraphicsLayer::Id::Unknown, GraphicsLayer::getInnerLayerId(0));
+    EXPECT_EQ(GraphicsLayer::Id::Unknown, GraphicsLayer::getInnerLayerId(
+                  GraphicsLayer::getInnerLayerCount() + 1));
+    for (int i = 1; i <= GraphicsLayer::getInnerLayerCount(); ++i) {
+        GraphicsLayer::Id id = GraphicsLayer::getInnerLayerId(i);
+        EXPECT_EQ(GraphicsLayer::getInnerLayerName(i), GraphicsLayer::getLayerName(id));
+        EXPECT_TRUE(GraphicsLayer::isInnerLayer(id));
+        EXPECT_TRUE(GraphicsLayer::isCopperLayer(id));
+        EXPECT_EQ(id, GraphicsLayer::getMirroredLayerId(id));
+    }
+}
+
+TEST_F(GraphicsLayerTest, testPropertiesMatchNames)
+{
+    for (int i = 0; i < static_cast<int>(GraphicsLayer::Id::_COUNT); ++i) {
+        GraphicsLayer::Id id = static_cast<GraphicsLayer::Id>(i);
+        QString name = GraphicsLayer::getLayerName(id);
+        EXPECT_EQ(GraphicsLayer::isTopLayer(name), GraphicsLayer::isTopLayer(id));
+        EXPECT_EQ(GraphicsLayer::isBottomLayer(name), GraphicsLayer::isBottomLayer(id));
+        EXPECT_EQ(GraphicsLayer::isInnerLayer(name), GraphicsLayer::isInnerLayer(id));
+        EXPECT_EQ(GraphicsLayer::isCopperLayer(name), GraphicsLayer::isCopperLayer(id));
+        EXPECT_EQ(GraphicsLayer::getMirroredLayerName(name),
+                  GraphicsLayer::getLayerName(GraphicsLayer::getMirroredLayerId(id)));
+    }
+}
+
+TEST_F(GraphicsLayerTest, testMirroredLayerId)
+{
+    EXPECT_EQ(GraphicsLayer::Id::BotCopper,
+              GraphicsLayer::getMirroredLayerId(GraphicsLayer::Id::TopCopper));
+    EXPECT_EQ(GraphicsLayer::Id::TopCopper,
+              GraphicsLayer::getMirroredLayerId(GraphicsLayer::Id::BotCopper));
+    EXPECT_EQ(GraphicsLayer::Id::BotStopMask,
+              GraphicsLayer::getMirroredLayerId(GraphicsLayer::Id::TopStopMask));
+    EXPECT_EQ(GraphicsLayer::Id::BoardOutlines,
+              GraphicsLayer::getMirroredLayerId(GraphicsLayer::Id::BoardOutlines));
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
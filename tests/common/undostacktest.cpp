@@ -0,0 +1,249 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/undostack.h>
+#include <librepcb/common/undocommand.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Command
+ ****************************************************************************************/
+
+class UndoStackTestCmd final : public UndoCommand
+{
+    public:
+        UndoStackTestCmd(int& value, int newValue, int mergeId = NoMergeId) noexcept :
+            UndoCommand("test"), mValue(value), mOldValue(value), mNewValue(newValue),
+            mMergeId(mergeId) {}
+        qint64 getApproxMemoryUsage() const noexcept override {return 100;}
+        int getMergeId() const noexcept override {return mMergeId;}
+    private:
+        bool performExecute() override {performRedo(); return true;}
+        void performUndo() override {mValue = mOldValue;}
+        void performRedo() override {mValue = mNewValue;}
+        bool performMergeWith(const UndoCommand& other) noexcept override {
+            const UndoStackTestCmd* cmd = dynamic_cast<const UndoStackTestCmd*>(&other);
+            if ((!cmd) || (&cmd->mValue != &mValue)) return false;
+            mNewValue = cmd->mNewValue;
+            return true;
+        }
+        int& mValue;
+        int mOldValue;
+        int mNewValue;
+        int mMergeId;
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST(UndoStackTest, testMemoryUsage)
+{
+    int value = 0;
+    UndoStack stack;
+    EXPECT_EQ(0, stack.getApproxMemoryUsage());
+    stack.execCmd(new UndoStackTestCmd(value, 1));
+    stack.execCmd(new UndoStackTestCmd(value, 2));
+    EXPECT_EQ(200, stack.getApproxMemoryUsage());
+    stack.undo();
+    stack.execCmd(new UndoStackTestCmd(value, 3)); // removes the redoable command
+    EXPECT_EQ(200, stack.getApproxMemoryUsage());
+    stack.clear();
+    EXPECT_EQ(0, stack.getApproxMemoryUsage());
+}
+
+TEST(UndoStackTest, testMaxDepth)
+{
+    int value = 0;
+    UndoStack stack;
+    stack.setLimits(3, 0);
+    for (int i = 1; i <= 10; ++i) {
+        stack.execCmd(new UndoStackTestCmd(value, i));
+    }
+    EXPECT_EQ(3, stack.getCommandCount());
+    EXPECT_EQ(300, stack.getApproxMemoryUsage());
+    stack.undo();
+    stack.undo();
+    stack.undo();
+    EXPECT_FALSE(stack.canUndo());
+    EXPECT_EQ(7, value);
+}
+
+TEST(UndoStackTest, testMaxMemoryUsage)
+{
+    int value = 0;
+    UndoStack stack;
+    for (int i = 1; i <= 10; ++i) {
+        stack.execCmd(new UndoStackTestCmd(value, i));
+    }
+    stack.setLimits(0, 450);
+    EXPECT_EQ(4, stack.getCommandCount());
+    EXPECT_EQ(400, stack.getApproxMemoryUsage());
+}
+
+TEST(UndoStackTest, testLastCommandIsNeverRemoved)
+{
+    int value = 0;
+    UndoStack stack;
+    stack.setLimits(0, 1);
+    stack.execCmd(new UndoStackTestCmd(value, 1));
+    stack.execCmd(new UndoStackTestCmd(value, 2));
+    EXPECT_EQ(1, stack.getCommandCount());
+    EXPECT_TRUE(stack.canUndo());
+}
+
+TEST(UndoStackTest, testRemovedCleanState)
+{
+    int value = 0;
+    UndoStack stack;
+    stack.setLimits(2, 0);
+    stack.execCmd(new UndoStackTestCmd(value, 1));
+    stack.setClean();
+    stack.execCmd(new UndoStackTestCmd(value, 2));
+    stack.execCmd(new UndoStackTestCmd(value, 3)); // clean state is still reachable
+    stack.undo();
+    stack.undo();
+    EXPECT_FALSE(stack.canUndo());
+    EXPECT_TRUE(stack.isClean());
+    stack.redo();
+    stack.redo();
+    stack.execCmd(new UndoStackTestCmd(value, 4)); // removes the clean state
+    stack.undo();
+    stack.undo();
+    EXPECT_FALSE(stack.canUndo());
+    EXPECT_FALSE(stack.isClean());
+}
+
+TEST(UndoStackTest, testRedoableCommandsRemovedIfLimitExceeded)
+{
+    int value = 0;
+    UndoStack stack;
+    for (int i = 1; i <= 5; ++i) {
+        stack.execCmd(new UndoStackTestCmd(value, i));
+    }
+    stack.undo();
+    stack.undo();
+    stack.undo();
+    stack.setLimits(3, 0);
+    EXPECT_EQ(3, stack.getCommandCount());
+    EXPECT_EQ(2, value);
+    stack.redo();
+    stack.redo();
+    EXPECT_EQ(4, value);
+    EXPECT_FALSE(stack.canRedo()); // the newest command was removed
+    stack.undo();
+    stack.undo();
+    stack.undo();
+    EXPECT_EQ(1, value);
+    EXPECT_FALSE(stack.canUndo()); // the oldest command was removed
+}
+
+TEST(UndoStackTest, testMerge)
+{
+    int value = 0;
+    int id = UndoCommand::UserMergeId;
+    UndoStack stack;
+    stack.execCmd(new UndoStackTestCmd(value, 1, id));
+    stack.execCmd(new UndoStackTestCmd(value, 2, id));
+    stack.execCmd(new UndoStackTestCmd(value, 3, id));
+    EXPECT_EQ(1, stack.getCommandCount());
+    EXPECT_EQ(3, value);
+    stack.undo();
+    EXPECT_EQ(0, value);
+    stack.redo();
+    EXPECT_EQ(3, value);
+}
+
+TEST(UndoStackTest, testMergeRequiresSameMergeId)
+{
+    int value = 0;
+    UndoStack stack;
+    stack.execCmd(new UndoStackTestCmd(value, 1));
+    stack.execCmd(new UndoStackTestCmd(value, 2));
+    stack.execCmd(new UndoStackTestCmd(value, 3, UndoCommand::UserMergeId));
+    stack.execCmd(new UndoStackTestCmd(value, 4, UndoCommand::UserMergeId + 1));
+    EXPECT_EQ(4, stack.getCommandCount());
+}
+
+TEST(UndoStackTest, testMergeTimeWindow)
+{
+    int value = 0;
+    int id = UndoCommand::UserMergeId;
+    qint64 time = 0;
+    UndoStack stack;
+    stack.setClock([&time](){return time;});
+    stack.setMergeTimeWindow(20);
+    stack.execCmd(new UndoStackTestCmd(value, 1, id));
+    time += 20;
+    stack.execCmd(new UndoStackTestCmd(value, 2, id)); // merged
+    EXPECT_EQ(1, stack.getCommandCount());
+    time += 21;
+    stack.execCmd(new UndoStackTestCmd(value, 3, id)); // not merged
+    EXPECT_EQ(2, stack.getCommandCount());
+    stack.setMergeTimeWindow(0); // disables merging
+    stack.execCmd(new UndoStackTestCmd(value, 4, id));
+    EXPECT_EQ(3, stack.getCommandCount());
+}
+
+TEST(UndoStackTest, testNoMergeAfterUndo)
+{
+    int value = 0;
+    int id = UndoCommand::UserMergeId;
+    UndoStack stack;
+    stack.execCmd(new UndoStackTestCmd(value, 1, id));
+    stack.execCmd(new UndoStackTestCmd(value, 2));
+    stack.undo();
+    stack.execCmd(new UndoStackTestCmd(value, 3, id));
+    EXPECT_EQ(2, stack.getCommandCount());
+    stack.undo();
+    EXPECT_EQ(1, value);
+}
+
+TEST(UndoStackTest, testMergeKeepsCleanState)
+{
+    int value = 0;
+    int id = UndoCommand::UserMergeId;
+    UndoStack stack;
+    stack.execCmd(new UndoStackTestCmd(value, 1, id));
+    stack.setClean();
+    stack.execCmd(new UndoStackTestCmd(value, 2, id));
+    stack.execCmd(new UndoStackTestCmd(value, 3, id));
+    EXPECT_EQ(2, stack.getCommandCount());
+    stack.undo();
+    EXPECT_EQ(1, value);
+    EXPECT_TRUE(stack.isClean());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
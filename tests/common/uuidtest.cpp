@@ -206,6 +206,22 @@ TEST_P(UuidTest, testOperatorComparisons)
     }
 }
 
+TEST_P(UuidTest, testQHash)
+{
+    const UuidTestData& data = GetParam();
+
+    Uuid uuid1(data.uuid);
+    Uuid uuid2(data.uuid.toUpper());
+    EXPECT_EQ(qHash(uuid1, 0), qHash(uuid2, 0));
+    EXPECT_EQ(qHash(uuid1, 42), qHash(uuid2, 42));
+    if (data.valid) {
+        QHash<Uuid, int> hash;
+        hash.insert(uuid1, 1);
+        EXPECT_EQ(1, hash.value(uuid2, 0));
+        EXPECT_EQ(0, hash.value(Uuid("d2c30518-5cd1-4ce9-a569-44f783a3f66a"), 0));
+    }
+}
+
 TEST(UuidTest, testCreateRandom)
 {
     for (int i = 0; i < 1000; i++) {
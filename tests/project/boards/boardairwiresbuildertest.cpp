@@ -0,0 +1,148 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/project/boards/boardairwiresbuilder.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class BoardAirWiresBuilderTest : public ::testing::Test
+{
+    protected:
+
+        static qreal getLength(const QVector<Point>& points,
+                               const QVector<QPair<int, int>>& airwires) noexcept
+        {
+            qreal length = 0;
+            typedef QPair<int, int> IndexPair;
+            foreach (const IndexPair& airwire, airwires) {
+                length += (points.at(airwire.first) - points.at(airwire.second)).getLength().toMm();
+            }
+            return length;
+        }
+
+        /// Length of the minimum spanning tree, calculated with Prim's algorithm in O(n^2)
+        static qreal getMinimumSpanningTreeLength(const QVector<Point>& points,
+                                                  const QVector<int>& clusters) noexcept
+        {
+            QList<int> ids = clusters.toList().toSet().toList();
+            QVector<qreal> distances(ids.count(), std::numeric_limits<qreal>::max());
+            QVector<bool> connected(ids.count(), false);
+            qreal length = 0;
+            distances[0] = 0;
+            for (int n = 0; n < ids.count(); ++n) {
+                int next = -1;
+                for (int i = 0; i < ids.count(); ++i) {
+                    if ((!connected[i]) && ((next < 0) || (distances[i] < distances[next]))) {
+                        next = i;
+                    }
+                }
+                connected[next] = true;
+                length += distances[next];
+                for (int i = 0; i < points.count(); ++i) {
+                    if (clusters[i] != ids[next]) continue;
+                    for (int k = 0; k < points.count(); ++k) {
+                        int cluster = ids.indexOf(clusters[k]);
+                        qreal dist = (points[i] - points[k]).getLength().toMm();
+                        if ((!connected[cluster]) && (dist < distances[cluster])) {
+                            distances[cluster] = dist;
+                        }
+                    }
+                }
+            }
+            return length;
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(BoardAirWiresBuilderTest, testNoAirWires)
+{
+    EXPECT_EQ(0, BoardAirWiresBuilder::calcAirWires({}, {}).count());
+    EXPECT_EQ(0, BoardAirWiresBuilder::calcAirWires({Point(0, 0)}, {0}).count());
+    EXPECT_EQ(0, BoardAirWiresBuilder::calcAirWires({Point(0, 0), Point(1000, 0),
+                                                     Point(0, 1000)}, {5, 5, 5}).count());
+}
+
+TEST_F(BoardAirWiresBuilderTest, testConnectsClosestPoints)
+{
+    QVector<Point> points = {Point(0, 0), Point(10000000, 0), Point(11000000, 0),
+                             Point(30000000, 0)};
+    QVector<int> clusters = {0, 0, 1, 1};
+    QVector<QPair<int, int>> airwires = BoardAirWiresBuilder::calcAirWires(points, clusters);
+    ASSERT_EQ(1, airwires.count());
+    EXPECT_EQ(qMakePair(1, 2), qMakePair(qMin(airwires[0].first, airwires[0].second),
+                                         qMax(airwires[0].first, airwires[0].second)));
+}
+
+TEST_F(BoardAirWiresBuilderTest, testCollinearAndDuplicatePoints)
+{
+    QVector<Point> points;
+    QVector<int> clusters;
+    for (int i = 0; i < 200; ++i) {
+        points.append(Point(Length(((i * 37) % 100) * 1270000), Length(0)));
+        clusters.append(i);
+    }
+    QVector<QPair<int, int>> airwires = BoardAirWiresBuilder::calcAirWires(points, clusters);
+    EXPECT_EQ(199, airwires.count());
+    EXPECT_NEAR(99 * 1.27, getLength(points, airwires), 1e-6);
+}
+
+TEST_F(BoardAirWiresBuilderTest, testMinimumSpanningTreeOfRandomPoints)
+{
+    qsrand(42);
+    for (int run = 0; run < 10; ++run) {
+        QVector<Point> points;
+        QVector<int> clusters;
+        int count = 50 + (qrand() % 500);
+        for (int i = 0; i < count; ++i) {
+            // integer micrometers to avoid any rounding in the triangulation
+            points.append(Point(Length(LengthBase_t(qrand() % 100000) * 1000),
+                                Length(LengthBase_t(qrand() % 100000) * 1000)));
+            clusters.append(qrand() % (count / 2));
+        }
+        QVector<QPair<int, int>> airwires = BoardAirWiresBuilder::calcAirWires(points, clusters);
+        EXPECT_EQ(clusters.toList().toSet().count() - 1, airwires.count());
+        EXPECT_NEAR(getMinimumSpanningTreeLength(points, clusters),
+                    getLength(points, airwires), 1e-3);
+    }
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace project
+} // namespace librepcb
@@ -0,0 +1,206 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/boarddesignrules.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boarddesignrulecheck.h>
+#include <librepcb/project/boards/items/bi_hole.h>
+#include <librepcb/project/boards/items/bi_netsegment.h>
+#include <librepcb/project/boards/items/bi_polygon.h>
+#include <librepcb/project/boards/items/bi_via.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/netsignal.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+/**
+ * @brief The BoardDesignRuleCheckTest checks the clearance rules of the DRC
+ *
+ * The default board outline of a new board is 160x100mm, so all items are placed around
+ * (50mm, 50mm) to keep them away from it. The board has no inner layers, thus every
+ * violation involving vias or holes is reported on the top and on the bottom layer.
+ */
+class BoardDesignRuleCheckTest : public ::testing::Test
+{
+    protected:
+        FilePath mProjectDir;
+        QScopedPointer<Project> mProject;
+        Board* mBoard;
+        NetSignal* mNetA;
+        NetSignal* mNetB;
+
+        BoardDesignRuleCheckTest() {
+            mProjectDir = FilePath::getRandomTempPath().getPathTo("test project dir");
+            mProject.reset(Project::create(mProjectDir.getPathTo("test project.lpp")));
+            mBoard = mProject->createBoard("test");
+            mProject->addBoard(*mBoard);
+            mBoard->getDesignRules().setCopperClearance(Length(200000));
+            mBoard->getDesignRules().setCopperBoardClearance(Length(300000));
+            mNetA = addNetSignal("A");
+            mNetB = addNetSignal("B");
+        }
+
+        virtual ~BoardDesignRuleCheckTest() {
+            mProject.reset();
+            QDir(mProjectDir.getParentDir().toStr()).removeRecursively();
+        }
+
+        NetSignal* addNetSignal(const QString& name) {
+            Circuit& circuit = mProject->getCircuit();
+            NetSignal* netsignal = new NetSignal(circuit, *circuit.getNetClasses().first(),
+                                                 name, false);
+            circuit.addNetSignal(*netsignal);
+            return netsignal;
+        }
+
+        BI_Via* addVia(NetSignal& netsignal, const Point& position) {
+            BI_NetSegment* netsegment = new BI_NetSegment(*mBoard, netsignal);
+            mBoard->addNetSegment(*netsegment);
+            BI_Via* via = new BI_Via(*netsegment, position, BI_Via::Shape::Round,
+                                     Length(700000), Length(300000));
+            netsegment->addElements({via}, {}, {});
+            return via;
+        }
+
+        void addHole(const Point& position, const Length& diameter) {
+            BI_Hole* hole = new BI_Hole(*mBoard, Hole(Uuid::createRandom(), position,
+                                                      diameter));
+            mBoard->addHole(*hole);
+        }
+
+        void addCopperPolygon(const Point& p1, const Point& p2) {
+            BI_Polygon* polygon = new BI_Polygon(*mBoard, Polygon(Uuid::createRandom(),
+                GraphicsLayer::sTopCopper, Length(200000), true, false, Path::rect(p1, p2)));
+            mBoard->addPolygon(*polygon);
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(BoardDesignRuleCheckTest, testSameNetSignalIsNoViolation)
+{
+    addVia(*mNetA, Point::fromMm(50, 50));
+    addVia(*mNetA, Point::fromMm(50.5, 50));
+
+    BoardDesignRuleCheck drc(*mBoard);
+    EXPECT_EQ(0, drc.runFull());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testCopperClearance)
+{
+    // gap of 0.1mm < 0.2mm
+    addVia(*mNetA, Point::fromMm(50, 50));
+    addVia(*mNetB, Point::fromMm(50.8, 50));
+    // gap of 0.3mm >= 0.2mm
+    addVia(*mNetA, Point::fromMm(60, 50));
+    addVia(*mNetB, Point::fromMm(61, 50));
+
+    BoardDesignRuleCheck drc(*mBoard);
+    EXPECT_EQ(2, drc.runFull());
+    foreach (const BoardDesignRuleCheck::Violation& violation, drc.getViolations()) {
+        EXPECT_EQ(Length(100000), violation.distance);
+        EXPECT_EQ(Length(200000), violation.clearance);
+    }
+}
+
+TEST_F(BoardDesignRuleCheckTest, testCopperBoardClearance)
+{
+    // gap of 0.15mm < 0.3mm, but it would be enough for the copper clearance
+    addHole(Point::fromMm(50, 50), Length(1000000));
+    addVia(*mNetA, Point::fromMm(51, 50));
+    // gap of 0.35mm >= 0.3mm
+    addHole(Point::fromMm(60, 50), Length(1000000));
+    addVia(*mNetA, Point::fromMm(61.2, 50));
+
+    BoardDesignRuleCheck drc(*mBoard);
+    EXPECT_EQ(2, drc.runFull());
+    foreach (const BoardDesignRuleCheck::Violation& violation, drc.getViolations()) {
+        EXPECT_EQ(Length(300000), violation.clearance);
+    }
+}
+
+TEST_F(BoardDesignRuleCheckTest, testUnconnectedCopperIsNotChecked)
+{
+    addCopperPolygon(Point::fromMm(40, 40), Point::fromMm(50, 50));
+    addCopperPolygon(Point::fromMm(45, 45), Point::fromMm(55, 55));
+
+    BoardDesignRuleCheck drc(*mBoard);
+    EXPECT_EQ(0, drc.runFull());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testViaInsideUnconnectedPolygon)
+{
+    addCopperPolygon(Point::fromMm(40, 40), Point::fromMm(60, 60));
+    addVia(*mNetA, Point::fromMm(50, 50));
+
+    BoardDesignRuleCheck drc(*mBoard);
+    ASSERT_EQ(1, drc.runFull()); // only on the top layer
+    EXPECT_EQ(Length(0), drc.getViolations().first().distance);
+}
+
+TEST_F(BoardDesignRuleCheckTest, testIncrementalEqualsFull)
+{
+    addVia(*mNetA, Point::fromMm(50, 50));
+    BI_Via* via = addVia(*mNetB, Point::fromMm(60, 50));
+    addVia(*mNetB, Point::fromMm(70, 50));
+
+    BoardDesignRuleCheck drc(*mBoard);
+    EXPECT_EQ(0, drc.runFull());
+
+    // move a via near to another via
+    via->setPosition(Point::fromMm(50.8, 50));
+    EXPECT_EQ(2, drc.runIncremental());
+    EXPECT_EQ(BoardDesignRuleCheck(*mBoard).runFull(), drc.runIncremental());
+
+    // changing the design rules requires a full check
+    mBoard->getDesignRules().setCopperClearance(Length(50000));
+    EXPECT_EQ(0, drc.runIncremental());
+
+    // move the via back
+    mBoard->getDesignRules().setCopperClearance(Length(200000));
+    EXPECT_EQ(2, drc.runIncremental());
+    via->setPosition(Point::fromMm(60, 50));
+    EXPECT_EQ(0, drc.runIncremental());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace project
+} // namespace librepcb
@@ -65,10 +65,15 @@ PRE_TARGETDEPS += \
 SOURCES += \
     common/applicationtest.cpp \
     common/attributes/attributesubstitutortest.cpp \
+    common/cam/excellongeneratortest.cpp \
     common/directorylocktest.cpp \
     common/filedownloadtest.cpp \
+    common/fileio/filesavetransactiontest.cpp \
+    common/fileio/fileutilstest.cpp \
     common/fileio/serializableobjectlisttest.cpp \
+    common/fileio/smartsexprfiletest.cpp \
     common/filepathtest.cpp \
+    common/graphics/graphicslayertest.cpp \
     common/networkrequesttest.cpp \
     common/pointtest.cpp \
     common/ratiotest.cpp \
@@ -76,6 +81,7 @@ SOURCES += \
     common/sqlitedatabasetest.cpp \
     common/systeminfotest.cpp \
     common/toolboxtest.cpp \
+    common/undostacktest.cpp \
     common/uuidtest.cpp \
     common/versiontest.cpp \
     eagleimport/deviceconvertertest.cpp \
@@ -83,6 +89,8 @@ SOURCES += \
     eagleimport/packageconvertertest.cpp \
     eagleimport/symbolconvertertest.cpp \
     main.cpp \
+    project/boards/boardairwiresbuildertest.cpp \
+    project/boards/boarddesignrulechecktest.cpp \
     project/boards/boardplanefragmentsbuildertest.cpp \
     project/projecttest.cpp \
     workspace/workspacetest.cpp \